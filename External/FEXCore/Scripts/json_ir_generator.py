@@ -210,7 +210,134 @@ def print_ir_arg_printer(ops, defines):
 
 
     output_file.write("#undef IROP_ARGPRINTER_HELPER\n")
-    output_file.write("#endif\n")
+    output_file.write("#endif\n\n")
+
+# Print out IR argument parsing
+# Mirrors the argument printer so anything Dump writes out can be parsed back in
+def print_ir_arg_parser(ops, defines):
+    output_file.write("#ifdef IROP_ARGPARSER_HELPER\n")
+    output_file.write("switch (IROp->Op) {\n")
+    for op_key, op_vals in ops.items():
+        if not ("Last" in op_vals):
+            SSAArgs = 0
+            HasArgs = False
+
+            # Ops without a printer need to be parsed by hand
+            if ("ArgPrinter" in op_vals and op_vals["ArgPrinter"] == False):
+                continue
+
+            if ("SSAArgs" in op_vals):
+                SSAArgs = int(op_vals["SSAArgs"])
+
+            if ("Args" in op_vals and len(op_vals["Args"]) != 0):
+                HasArgs = True
+
+            output_file.write("case IROps::OP_%s: {\n" % op_key.upper())
+            if (HasArgs or SSAArgs != 0):
+                output_file.write("\tauto Op = IROp->CW<IR::IROp_%s>();\n" % op_key)
+                output_file.write("\tOp->Header.NumArgs = %d;\n" % SSAArgs)
+
+                # SSA args come first
+                if (SSAArgs != 0):
+                    for i in range(0, SSAArgs):
+                        LastArg = (SSAArgs - i - 1) == 0 and not HasArgs
+                        output_file.write("\tOp->Header.Args[%d] = ParseArg<OrderedNodeWrapper>(Lexer);\n" % i)
+                        if not (LastArg):
+                            output_file.write("\tParseSeparator(Lexer);\n")
+
+                # Now parse user defined arguments
+                if (HasArgs):
+                    ArgCount = len(op_vals["Args"])
+
+                    for i in range(0, len(op_vals["Args"]), 2):
+                        data_type = op_vals["Args"][i]
+                        data_name = op_vals["Args"][i+1]
+                        LastArg = (ArgCount - i - 2) == 0
+                        output_file.write("\tOp->%s = ParseArg<%s>(Lexer);\n" % (data_name, data_type))
+                        if not (LastArg):
+                            output_file.write("\tParseSeparator(Lexer);\n")
+
+            output_file.write("break;\n")
+            output_file.write("}\n")
+
+    output_file.write("#undef IROP_ARGPARSER_HELPER\n")
+    output_file.write("#endif\n\n")
+
+# Print out compact binary serialization of IR arguments
+def print_ir_serializer(ops, defines):
+    output_file.write("#ifdef IROP_SERIALIZE_HELPER\n")
+    output_file.write("switch (IROp->Op) {\n")
+    for op_key, op_vals in ops.items():
+        if not ("Last" in op_vals):
+            SSAArgs = 0
+            HasArgs = False
+
+            # Ops without a printer need to be serialized by hand
+            if ("ArgPrinter" in op_vals and op_vals["ArgPrinter"] == False):
+                continue
+
+            if ("SSAArgs" in op_vals):
+                SSAArgs = int(op_vals["SSAArgs"])
+
+            if ("Args" in op_vals and len(op_vals["Args"]) != 0):
+                HasArgs = True
+
+            output_file.write("case IROps::OP_%s: {\n" % op_key.upper())
+            if (HasArgs or SSAArgs != 0):
+                output_file.write("\tauto Op = IROp->C<IR::IROp_%s>();\n" % op_key)
+
+                for i in range(0, SSAArgs):
+                    output_file.write("\tWriteArg(Writer, Op->Header.Args[%d]);\n" % i)
+
+                if (HasArgs):
+                    for i in range(1, len(op_vals["Args"]), 2):
+                        data_name = op_vals["Args"][i]
+                        output_file.write("\tWriteArg(Writer, Op->%s);\n" % data_name)
+
+            output_file.write("break;\n")
+            output_file.write("}\n")
+
+    output_file.write("#undef IROP_SERIALIZE_HELPER\n")
+    output_file.write("#endif\n\n")
+
+# Print out compact binary deserialization of IR arguments
+def print_ir_deserializer(ops, defines):
+    output_file.write("#ifdef IROP_DESERIALIZE_HELPER\n")
+    output_file.write("switch (IROp->Op) {\n")
+    for op_key, op_vals in ops.items():
+        if not ("Last" in op_vals):
+            SSAArgs = 0
+            HasArgs = False
+
+            # Ops without a printer need to be deserialized by hand
+            if ("ArgPrinter" in op_vals and op_vals["ArgPrinter"] == False):
+                continue
+
+            if ("SSAArgs" in op_vals):
+                SSAArgs = int(op_vals["SSAArgs"])
+
+            if ("Args" in op_vals and len(op_vals["Args"]) != 0):
+                HasArgs = True
+
+            output_file.write("case IROps::OP_%s: {\n" % op_key.upper())
+            if (HasArgs or SSAArgs != 0):
+                output_file.write("\tauto Op = IROp->CW<IR::IROp_%s>();\n" % op_key)
+                output_file.write("\tOp->Header.NumArgs = %d;\n" % SSAArgs)
+
+                for i in range(0, SSAArgs):
+                    output_file.write("\tOp->Header.Args[%d] = ReadArg<OrderedNodeWrapper>(Reader);\n" % i)
+
+                if (HasArgs):
+                    for i in range(0, len(op_vals["Args"]), 2):
+                        data_type = op_vals["Args"][i]
+                        data_name = op_vals["Args"][i+1]
+                        output_file.write("\tOp->%s = ReadArg<%s>(Reader);\n" % (data_name, data_type))
+
+            output_file.write("break;\n")
+            output_file.write("}\n")
+
+    output_file.write("#undef IROP_DESERIALIZE_HELPER\n")
+    output_file.write("#endif\n\n")
 
 # Print out IR allocator helpers
 def print_ir_allocator_helpers(ops, defines):
@@ -230,16 +357,17 @@ def print_ir_allocator_helpers(ops, defines):
     output_file.write("\tusing IRPair = Wrapper<T>;\n\n")
 
     output_file.write("\tIRPair<IROp_Header> AllocateRawOp(size_t HeaderSize) {\n")
-    output_file.write("\t\tauto Op = reinterpret_cast<IROp_Header*>(Data.Allocate(HeaderSize));\n")
+    output_file.write("\t\tauto Node = CreateNode(HeaderSize);\n")
+    output_file.write("\t\tauto Op = Node->Op(Data.Begin());\n")
     output_file.write("\t\tmemset(Op, 0, HeaderSize);\n")
     output_file.write("\t\tOp->Op = IROps::OP_DUMMY;\n")
-    output_file.write("\t\treturn IRPair<IROp_Header>{Op, CreateNode(Op)};\n")
+    output_file.write("\t\treturn IRPair<IROp_Header>{Op, Node};\n")
     output_file.write("\t}\n\n")
 
     output_file.write("\ttemplate<class T, IROps T2>\n")
     output_file.write("\tT *AllocateOrphanOp() {\n")
     output_file.write("\t\tsize_t Size = FEXCore::IR::GetSize(T2);\n")
-    output_file.write("\t\tauto Op = reinterpret_cast<T*>(Data.Allocate(Size));\n")
+    output_file.write("\t\tauto Op = reinterpret_cast<T*>(AllocateListData(Size));\n")
     output_file.write("\t\tmemset(Op, 0, Size);\n")
     output_file.write("\t\tOp->Header.Op = T2;\n")
     output_file.write("\t\treturn Op;\n")
@@ -248,10 +376,11 @@ def print_ir_allocator_helpers(ops, defines):
     output_file.write("\ttemplate<class T, IROps T2>\n")
     output_file.write("\tIRPair<T> AllocateOp() {\n")
     output_file.write("\t\tsize_t Size = FEXCore::IR::GetSize(T2);\n")
-    output_file.write("\t\tauto Op = reinterpret_cast<T*>(Data.Allocate(Size));\n")
+    output_file.write("\t\tauto Node = CreateNode(Size);\n")
+    output_file.write("\t\tauto Op = reinterpret_cast<T*>(Node->Op(Data.Begin()));\n")
     output_file.write("\t\tmemset(Op, 0, Size);\n")
     output_file.write("\t\tOp->Header.Op = T2;\n")
-    output_file.write("\t\treturn IRPair<T>{Op, CreateNode(&Op->Header)};\n")
+    output_file.write("\t\treturn IRPair<T>{Op, Node};\n")
     output_file.write("\t}\n\n")
 
     output_file.write("\tuint8_t GetOpSize(OrderedNode *Op) const {\n")
@@ -333,7 +462,7 @@ def print_ir_allocator_helpers(ops, defines):
 
             if (SSAArgs != 0):
                 for i in range(0, SSAArgs):
-                    output_file.write("\t\tOp.first->Header.Args[%d] = ssa%d->Wrapped(ListData.Begin());\n" % (i, i))
+                    output_file.write("\t\tOp.first->Header.Args[%d] = ssa%d->Wrapped(Data.Begin());\n" % (i, i))
                     output_file.write("\t\tssa%d->AddUse();\n" % (i))
 
             if (HasArgs):
@@ -388,6 +517,9 @@ print_ir_sizes(ops, defines)
 print_ir_getname(ops, defines)
 print_ir_getraargs(ops, defines)
 print_ir_arg_printer(ops, defines)
+print_ir_arg_parser(ops, defines)
+print_ir_serializer(ops, defines)
+print_ir_deserializer(ops, defines)
 print_ir_allocator_helpers(ops, defines)
 
 output_file.close()
@@ -1,35 +1,186 @@
 #include "Common/JitSymbols.h"
 
+#include <FEXCore/Debug/InternalThreadState.h>
+
+#include <elf.h>
 #include <string>
 #include <sstream>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <time.h>
 #include <unistd.h>
+#include <vector>
 
-namespace FEXCore {
-  JITSymbols::JITSymbols() {
-    std::stringstream PerfMap;
-    PerfMap << "/tmp/perf-" << getpid() << ".map";
+namespace {
+  // Layout from tools/perf/Documentation/jitdump-specification.txt
+  constexpr uint32_t JITDUMP_MAGIC = 0x4A695444;
+  constexpr uint32_t JITDUMP_VERSION = 1;
 
-    fp = fopen(PerfMap.str().c_str(), "wb");
-    if (fp) {
-      // Disable buffering on this file
-      setvbuf(fp, nullptr, _IONBF, 0);
-    }
+  enum RecordType : uint32_t {
+    JIT_CODE_LOAD = 0,
+    JIT_CODE_DEBUG_INFO = 2,
+  };
+
+  struct FileHeader {
+    uint32_t Magic;
+    uint32_t Version;
+    uint32_t TotalSize;
+    uint32_t ELFMach;
+    uint32_t Pad1;
+    uint32_t PID;
+    uint64_t Timestamp;
+    uint64_t Flags;
+  };
+
+  struct RecordHeader {
+    uint32_t ID;
+    uint32_t TotalSize;
+    uint64_t Timestamp;
+  };
+
+  struct CodeLoadRecord {
+    RecordHeader Header;
+    uint32_t PID;
+    uint32_t TID;
+    uint64_t VMA;
+    uint64_t CodeAddr;
+    uint64_t CodeSize;
+    uint64_t CodeIndex;
+    // Followed by the null terminated name and the code itself
+  };
+
+  struct DebugInfoRecord {
+    RecordHeader Header;
+    uint64_t CodeAddr;
+    uint64_t NumEntries;
+    // Followed by the entries
+  };
+
+  struct DebugEntry {
+    uint64_t CodeAddr;
+    uint32_t Line;
+    uint32_t Discriminator;
+    // Followed by the null terminated file name
+  };
+
+  // perf has to be recording with the same clock, `perf record -k 1`
+  uint64_t GetTimestamp() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000000ULL + ts.tv_nsec;
   }
 
+  void Append(std::vector<uint8_t> *Buffer, void const *Data, size_t Size) {
+    auto Bytes = reinterpret_cast<uint8_t const*>(Data);
+    Buffer->insert(Buffer->end(), Bytes, Bytes + Size);
+  }
+
+  void AppendString(std::vector<uint8_t> *Buffer, std::string const &String) {
+    Append(Buffer, String.c_str(), String.size() + 1);
+  }
+}
+
+namespace FEXCore {
   JITSymbols::~JITSymbols() {
+    if (Marker) {
+      munmap(Marker, sysconf(_SC_PAGESIZE));
+    }
+
     if (fp) {
       fclose(fp);
     }
   }
 
-  void JITSymbols::Register(void *HostAddr, uint64_t GuestAddr, uint32_t CodeSize) {
+  void JITSymbols::Init(uint64_t GuestBase) {
+    this->GuestBase = GuestBase;
+
+    // perf inject looks for this exact name
+    std::stringstream DumpPath;
+    DumpPath << "/tmp/jit-" << getpid() << ".dump";
+
+    fp = fopen(DumpPath.str().c_str(), "w+b");
+    if (!fp) {
+      return;
+    }
+
+    // Records are written in one go, disable buffering so a crash doesn't lose them
+    setvbuf(fp, nullptr, _IONBF, 0);
+
+    FileHeader Header{};
+    Header.Magic = JITDUMP_MAGIC;
+    Header.Version = JITDUMP_VERSION;
+    Header.TotalSize = sizeof(FileHeader);
+#if _M_X86_64
+    Header.ELFMach = EM_X86_64;
+#elif _M_ARM_64
+    Header.ELFMach = EM_AARCH64;
+#endif
+    Header.PID = getpid();
+    Header.Timestamp = GetTimestamp();
+    fwrite(&Header, sizeof(Header), 1, fp);
+
+    // perf only finds the dump through an executable mapping of it in the recording
+    Marker = mmap(nullptr, sysconf(_SC_PAGESIZE), PROT_READ | PROT_EXEC, MAP_PRIVATE, fileno(fp), 0);
+    if (Marker == MAP_FAILED) {
+      Marker = nullptr;
+    }
+  }
+
+  void JITSymbols::Register(void *HostAddr, uint64_t GuestAddr, char const *Name, FEXCore::Core::DebugData const *DebugData) {
     if (!fp) return;
 
-    // Linux perf format is very straightforward
-    // `<HostPtr> <Size> <Name>\n`
-    std::stringstream String;
-    String << std::hex << HostAddr << " " << CodeSize << " " << "JIT_0x" << GuestAddr << std::endl;
-    fwrite(String.str().c_str(), 1, String.str().size(), fp);
+    uint64_t CodeAddr = reinterpret_cast<uint64_t>(HostAddr);
+    uint64_t CodeSize = DebugData->HostCodeSize;
+
+    std::string SymbolName;
+    if (Name) {
+      SymbolName = Name;
+    }
+    else {
+      std::stringstream String;
+      String << "JIT_0x" << std::hex << GuestAddr - GuestBase;
+      SymbolName = String.str();
+    }
+    std::string FileName = Name ? Name : "guest";
+
+    // Timestamps have to stay in file order when several threads compile
+    std::lock_guard<std::mutex> lk(WriteMutex);
+    std::vector<uint8_t> Buffer;
+
+    // The line table has to be in front of the code it describes
+    auto &GuestOpcodes = DebugData->GuestOpcodes;
+    if (!GuestOpcodes.empty()) {
+      DebugInfoRecord Info{};
+      Info.Header.ID = JIT_CODE_DEBUG_INFO;
+      Info.Header.TotalSize = sizeof(DebugInfoRecord) + GuestOpcodes.size() * (sizeof(DebugEntry) + FileName.size() + 1);
+      Info.Header.Timestamp = GetTimestamp();
+      Info.CodeAddr = CodeAddr;
+      Info.NumEntries = GuestOpcodes.size();
+      Append(&Buffer, &Info, sizeof(Info));
+
+      for (auto &GuestOpcode : GuestOpcodes) {
+        DebugEntry Entry{};
+        Entry.CodeAddr = CodeAddr + GuestOpcode.HostEntryOffset;
+        Entry.Line = GuestOpcode.GuestRIP - GuestBase;
+        Append(&Buffer, &Entry, sizeof(Entry));
+        AppendString(&Buffer, FileName);
+      }
+    }
+
+    CodeLoadRecord Load{};
+    Load.Header.ID = JIT_CODE_LOAD;
+    Load.Header.TotalSize = sizeof(CodeLoadRecord) + SymbolName.size() + 1 + CodeSize;
+    Load.PID = getpid();
+    Load.TID = syscall(SYS_gettid);
+    Load.VMA = CodeAddr;
+    Load.CodeAddr = CodeAddr;
+    Load.CodeSize = CodeSize;
+    Load.CodeIndex = CodeIndex++;
+    Load.Header.Timestamp = GetTimestamp();
+    Append(&Buffer, &Load, sizeof(Load));
+    AppendString(&Buffer, SymbolName);
+    Append(&Buffer, HostAddr, CodeSize);
+
+    fwrite(Buffer.data(), 1, Buffer.size(), fp);
   }
 }
-
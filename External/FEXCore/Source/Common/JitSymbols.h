@@ -1,14 +1,47 @@
 #pragma once
 #include <cstdint>
 #include <cstdio>
+#include <mutex>
+
+namespace FEXCore::Core {
+  struct DebugData;
+}
 
 namespace FEXCore {
+/**
+ * @brief Writes the generated code in perf's jitdump format
+ *
+ * Record with `perf record -k 1`, then `perf inject --jit` turns every block in to an ELF object with a line table.
+ * Samples get attributed to the guest symbol of the block and, through the line table, to the guest instruction.
+ * Line numbers are guest addresses, relative to the memory base with unified memory.
+ *
+ * jitdump has no record for unloading code. Evicted blocks keep their entries, even once the x86_64 JIT reuses their
+ * code memory after a cache flush. perf resolves samples by load time, so a later block at the same host address
+ * takes over from its load onward.
+ */
 class JITSymbols final {
 public:
-  JITSymbols();
+  JITSymbols() = default;
   ~JITSymbols();
-  void Register(void *HostAddr, uint64_t GuestAddr, uint32_t CodeSize);
+
+  /**
+   * @brief Creates /tmp/jit-<pid>.dump, nothing gets recorded before this
+   *
+   * @param GuestBase Subtracted from guest RIPs before they are reported
+   */
+  void Init(uint64_t GuestBase);
+
+  /**
+   * @param Name Guest symbol the block belongs to, nullptr if unknown
+   * @param DebugData Host code size and line table of the block
+   */
+  void Register(void *HostAddr, uint64_t GuestAddr, char const *Name, FEXCore::Core::DebugData const *DebugData);
+
 private:
   FILE* fp{};
+  void *Marker{};
+  uint64_t GuestBase{};
+  uint64_t CodeIndex{};
+  std::mutex WriteMutex;
 };
 }
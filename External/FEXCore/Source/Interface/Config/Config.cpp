@@ -27,6 +27,36 @@ namespace FEXCore::Config {
     case FEXCore::Config::CONFIG_UNIFIED_MEMORY:
       CTX->Config.UnifiedMemory = Config != 0;
     break;
+    case FEXCore::Config::CONFIG_OPTIMIZATION_LEVEL:
+      CTX->Config.OptimizationLevel = static_cast<FEXCore::Config::ConfigOptimizationLevel>(Config);
+    break;
+    case FEXCore::Config::CONFIG_PASS_FIXEDPOINT_ITERATIONS:
+      CTX->Config.PassFixedPointIterations = Config;
+    break;
+    case FEXCore::Config::CONFIG_PASS_STATISTICS:
+      CTX->PassManager.EnableStatistics(Config != 0);
+    break;
+    case FEXCore::Config::CONFIG_IR_CACHE_RETAIN:
+      CTX->Config.RetainIR = Config != 0;
+    break;
+    case FEXCore::Config::CONFIG_IR_CACHE_SIZE:
+      CTX->Config.IRCacheSize = Config;
+    break;
+    case FEXCore::Config::CONFIG_REGISTER_ALLOCATOR:
+      CTX->Config.RegisterAllocator = static_cast<FEXCore::Config::ConfigRegisterAllocator>(Config);
+    break;
+    case FEXCore::Config::CONFIG_HOST_FEATURES:
+      CTX->Config.HostFeatures = static_cast<FEXCore::Config::ConfigHostFeatures>(Config);
+    break;
+    case FEXCore::Config::CONFIG_JIT_WX:
+      CTX->Config.JITWXorX = Config != 0;
+    break;
+    case FEXCore::Config::CONFIG_X87_REDUCED_PRECISION:
+      CTX->Config.X87ReducedPrecision = Config != 0;
+    break;
+    case FEXCore::Config::CONFIG_JIT_SYMBOLS:
+      CTX->Config.JITSymbols = Config != 0;
+    break;
     default: LogMan::Msg::A("Unknown configuration option");
     }
   }
@@ -36,6 +66,12 @@ namespace FEXCore::Config {
     case CONFIG_ROOTFSPATH:
       CTX->Config.RootFSPath = Config;
       break;
+    case CONFIG_PASS_PIPELINE:
+      CTX->Config.PassPipeline = Config;
+      break;
+    case CONFIG_IR_SERIALIZE_PATH:
+      CTX->Config.IRSerializePath = Config;
+      break;
     default: LogMan::Msg::A("Unknown configuration option");
     }
   }
@@ -62,6 +98,36 @@ namespace FEXCore::Config {
     case FEXCore::Config::CONFIG_UNIFIED_MEMORY:
       return CTX->Config.UnifiedMemory;
     break;
+    case FEXCore::Config::CONFIG_OPTIMIZATION_LEVEL:
+      return CTX->Config.OptimizationLevel;
+    break;
+    case FEXCore::Config::CONFIG_PASS_FIXEDPOINT_ITERATIONS:
+      return CTX->Config.PassFixedPointIterations;
+    break;
+    case FEXCore::Config::CONFIG_PASS_STATISTICS:
+      return CTX->PassManager.GetStatisticsEnabled();
+    break;
+    case FEXCore::Config::CONFIG_IR_CACHE_RETAIN:
+      return CTX->Config.RetainIR;
+    break;
+    case FEXCore::Config::CONFIG_IR_CACHE_SIZE:
+      return CTX->Config.IRCacheSize;
+    break;
+    case FEXCore::Config::CONFIG_REGISTER_ALLOCATOR:
+      return CTX->Config.RegisterAllocator;
+    break;
+    case FEXCore::Config::CONFIG_HOST_FEATURES:
+      return CTX->Config.HostFeatures;
+    break;
+    case FEXCore::Config::CONFIG_JIT_WX:
+      return CTX->Config.JITWXorX;
+    break;
+    case FEXCore::Config::CONFIG_X87_REDUCED_PRECISION:
+      return CTX->Config.X87ReducedPrecision;
+    break;
+    case FEXCore::Config::CONFIG_JIT_SYMBOLS:
+      return CTX->Config.JITSymbols;
+    break;
     default: LogMan::Msg::A("Unknown configuration option");
     }
 
@@ -148,6 +148,18 @@ namespace Debug {
     return CTX->GetThreadState();
   }
 
+  void GetPassStatistics(FEXCore::Context::Context *CTX, std::vector<FEXCore::IR::PassStatistics> *Stats) {
+    CTX->PassManager.GetStatistics(Stats);
+  }
+
+  void ResetPassStatistics(FEXCore::Context::Context *CTX) {
+    CTX->PassManager.ResetStatistics();
+  }
+
+  bool OptimizeIR(FEXCore::Context::Context *CTX, FEXCore::IR::IRListView<true> const *IR, bool Compile, IRCompileResult *Result) {
+    return CTX->OptimizeIR(IR, Compile, Result);
+  }
+
 
 }
 
@@ -8,6 +8,7 @@
 #include "Interface/IR/PassManager.h"
 #include <FEXCore/Config/Config.h>
 #include <FEXCore/Core/CPUBackend.h>
+#include <FEXCore/Debug/ContextDebug.h>
 #include <FEXCore/Utils/Event.h>
 #include <stdint.h>
 
@@ -48,6 +49,22 @@ namespace FEXCore::Context {
       bool UnifiedMemory {false};
       std::string RootFSPath;
 
+      // IR pass pipeline options
+      FEXCore::Config::ConfigOptimizationLevel OptimizationLevel {FEXCore::Config::CONFIG_O2};
+      std::string PassPipeline;
+      uint32_t PassFixedPointIterations {1};
+      std::string IRSerializePath;
+      FEXCore::Config::ConfigRegisterAllocator RegisterAllocator {FEXCore::Config::CONFIG_RA_AUTO};
+      FEXCore::Config::ConfigHostFeatures HostFeatures {FEXCore::Config::CONFIG_HOSTFEATURES_AUTO};
+      bool JITWXorX {false}; ///< JIT code memory is never writable and executable through the same mapping
+      bool X87ReducedPrecision {false}; ///< x87 stack registers are host doubles instead of 80bit values
+      bool JITSymbols {false}; ///< Write a perf jitdump with guest symbols and line tables of the JIT code
+
+      // IR cache options
+      // IR is always retained for backends that execute from it and while the gdbserver is running
+      bool RetainIR {false};
+      uint64_t IRCacheSize {64ULL * 1024 * 1024}; ///< Bytes of retained IR per thread before blocks get evicted. 0 is unlimited
+
       // LLVM JIT options
       bool LLVM_MemoryValidation {false};
       bool LLVM_IRValidation {false};
@@ -108,6 +125,9 @@ namespace FEXCore::Context {
     FEXCore::Core::ThreadState *GetThreadState();
     void LoadEntryList();
 
+    // Offline IR tooling
+    bool OptimizeIR(FEXCore::IR::IRListView<true> const *IR, bool Compile, FEXCore::Context::Debug::IRCompileResult *Result);
+
     uintptr_t CompileBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP);
     uintptr_t CompileFallbackBlock(FEXCore::Core::InternalThreadState *Thread, uint64_t GuestRIP);
 
@@ -123,6 +143,7 @@ namespace FEXCore::Context {
     IR::RegisterAllocationPass *GetRegisterAllocatorPass();
 
   private:
+    void InitializePassPipeline();
     void WaitForIdle();
     void *MapRegion(FEXCore::Core::InternalThreadState *Thread, uint64_t Offset, uint64_t Size, bool Fixed = false);
     void *ShmBase();
@@ -132,24 +153,45 @@ namespace FEXCore::Context {
     void HandleExit(FEXCore::Core::InternalThreadState *Thread);
 
     uintptr_t AddBlockMapping(FEXCore::Core::InternalThreadState *Thread, uint64_t Address, void *Ptr);
+    /**
+     * @brief Drops every block mapping of the thread along with the IR it was compiled from
+     *
+     * @param KeepRIP Block that is in the middle of being added, its IR is kept
+     */
+    void ClearCodeCache(FEXCore::Core::InternalThreadState *Thread, uint64_t KeepRIP);
+
+    bool ShouldRetainIR(FEXCore::Core::InternalThreadState *Thread);
+    /**
+     * @brief Evicts the least recently used IR until the thread is back under its IR cache budget
+     *
+     * Block mappings of evicted blocks are dropped if the backend executes from the IR, they get decoded again on demand
+     *
+     * @param KeepRIP Block that is in the middle of being compiled, its IR is kept
+     */
+    void TrimIRCache(FEXCore::Core::InternalThreadState *Thread, uint64_t KeepRIP);
+    /**
+     * @brief Copies the retained IR in to a fresh slab so the memory of evicted IR can be released
+     */
+    void CompactIRCache(FEXCore::Core::InternalThreadState *Thread);
 
     FEXCore::CodeLoader *LocalLoader{};
 
     // Entry Cache
     bool GetFilenameHash(std::string const &Filename, std::string &Hash);
-    void AddThreadRIPsToEntryList(FEXCore::Core::InternalThreadState *Thread);
     void SaveEntryList();
+    // Every thread adds the blocks it compiles
+    std::mutex EntryListMutex;
     std::set<uint64_t> EntryList;
     std::vector<uint64_t> InitLocations;
     uint64_t StartingRIP;
     IR::RegisterAllocationPass *RAPass {};
+    // Thread that is never run, used to get a CPU backend for offline compiles
+    FEXCore::Core::InternalThreadState *OfflineThread {};
     std::mutex ExitMutex;
     std::unique_ptr<GdbServer> DebugServer;
 
     bool StartPaused = false;
-#if ENABLE_JITSYMBOLS
     FEXCore::JITSymbols Symbols;
-#endif
 
   };
 }
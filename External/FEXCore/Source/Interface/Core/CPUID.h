@@ -19,6 +19,21 @@ public:
     LogMan::Throw::A(FunctionHandlers.find(Function) != FunctionHandlers.end(), "Don't have a CPUID handler for 0x%08x", Function);
     return FunctionHandlers[Function]();
   }
+
+  /**
+   * @brief Returns false instead of asserting when there is no handler for the function
+   *
+   * Results don't change after Init, so the IR can fold CPUID ops with a constant function
+   */
+  bool TryRunFunction(uint32_t Function, FunctionResults *Results) {
+    auto Handler = FunctionHandlers.find(Function);
+    if (Handler == FunctionHandlers.end()) {
+      return false;
+    }
+
+    *Results = Handler->second();
+    return true;
+  }
 private:
 
   using FunctionHandler = std::function<FunctionResults()>;
@@ -20,6 +20,8 @@
 #include <FEXCore/Core/X86Enums.h>
 
 
+#include <algorithm>
+#include <chrono>
 #include <fstream>
 
 #include "Interface/Core/GdbServer.h"
@@ -128,7 +130,6 @@ namespace FEXCore::Context {
     : FrontendDecoder {this}
     , SyscallHandler {FEXCore::CreateHandler(OperatingMode::MODE_64BIT, this)} {
     FallbackCPUFactory = FEXCore::Core::DefaultFallbackCore::CPUCreationFactory;
-    PassManager.AddDefaultPasses();
     PassManager.AddDefaultValidationPasses();
 #ifdef BLOCKSTATS
     BlockData = std::make_unique<FEXCore::BlockSamplingData>();
@@ -154,12 +155,6 @@ namespace FEXCore::Context {
     return false;
   }
 
-  void Context::AddThreadRIPsToEntryList(FEXCore::Core::InternalThreadState *Thread) {
-    for (auto &IR : Thread->IRLists) {
-      EntryList.insert(IR.first);
-    }
-  }
-
   void Context::SaveEntryList() {
     std::string const &Filename = SyscallHandler->GetFilename();
     std::string hash_string;
@@ -170,6 +165,7 @@ namespace FEXCore::Context {
 
       std::ofstream Output (DataPath.c_str(), std::ios::out | std::ios::binary);
       if (Output.is_open()) {
+        std::lock_guard<std::mutex> lk(EntryListMutex);
         for (auto Entry : EntryList) {
           Output.write(reinterpret_cast<char const*>(&Entry), sizeof(Entry));
         }
@@ -198,6 +194,7 @@ namespace FEXCore::Context {
         size_t EntryCount = Size / sizeof(uint64_t);
         uint64_t *Entries = reinterpret_cast<uint64_t*>(&Data.at(0));
 
+        std::lock_guard<std::mutex> lk(EntryListMutex);
         for (size_t i = 0; i < EntryCount; ++i) {
           EntryList.insert(Entries[i]);
         }
@@ -212,11 +209,9 @@ namespace FEXCore::Context {
     {
       std::lock_guard<std::mutex> lk(ThreadCreationMutex);
       for (auto &Thread : Threads) {
-        Thread->ExecutionThread.join();
-      }
-
-      for (auto &Thread : Threads) {
-        AddThreadRIPsToEntryList(Thread);
+        if (Thread->ExecutionThread.joinable()) {
+          Thread->ExecutionThread.join();
+        }
       }
 
       for (auto &Thread : Threads) {
@@ -228,8 +223,19 @@ namespace FEXCore::Context {
     SaveEntryList();
   }
 
+  void Context::InitializePassPipeline() {
+    if (Config.PassPipeline.empty() || !PassManager.AddPipeline(Config.PassPipeline)) {
+      PassManager.AddDefaultPasses(Config.OptimizationLevel);
+    }
+    PassManager.SetFixedPointIterations(Config.PassFixedPointIterations);
+  }
+
   bool Context::InitCore(FEXCore::CodeLoader *Loader) {
     LocalLoader = Loader;
+
+    // Configuration is all set by now
+    InitializePassPipeline();
+
     using namespace FEXCore::Core;
     FEXCore::Core::CPUState NewThreadState{};
 
@@ -256,6 +262,10 @@ namespace FEXCore::Context {
     uintptr_t MemoryBase = MemoryMapper.GetBaseOffset<uintptr_t>(0);
     Loader->SetMemoryBase(MemoryBase, Config.UnifiedMemory);
 
+    if (Config.JITSymbols) {
+      Symbols.Init(Config.UnifiedMemory ? MemoryBase : 0);
+    }
+
     auto MemoryMapperFunction = [&](uint64_t Base, uint64_t Size) -> void* {
       Thread->BlockCache->HintUsedRange(Base, Base);
       return MapRegion(Thread, Base, Size, true);
@@ -398,11 +408,18 @@ namespace FEXCore::Context {
     Thread->FallbackBackend->Initialize();
 
     // Compile all of our cached entries
-    LogMan::Msg::D("Precompiling: %ld blocks...", EntryList.size());
-    for (auto Entry : EntryList) {
+    // Work from a copy, compiling adds to the list and other threads may be compiling as well
+    std::set<uint64_t> Entries;
+    {
+      std::lock_guard<std::mutex> lk(EntryListMutex);
+      Entries = EntryList;
+    }
+
+    LogMan::Msg::D("Precompiling: %ld blocks...", Entries.size());
+    for (auto Entry : Entries) {
       CompileRIP(Thread, Entry);
     }
-    LogMan::Msg::D("Done", EntryList.size());
+    LogMan::Msg::D("Done", Entries.size());
 
     // This will create the execution thread but it won't actually start executing
     Thread->ExecutionThread = std::thread(&Context::ExecutionThread, this, Thread);
@@ -441,7 +458,7 @@ namespace FEXCore::Context {
 
     // Create CPU backend
     switch (Config.Core) {
-    case FEXCore::Config::CONFIG_INTERPRETER: Thread->CPUBackend.reset(FEXCore::CPU::CreateInterpreterCore(this)); break;
+    case FEXCore::Config::CONFIG_INTERPRETER: Thread->CPUBackend.reset(FEXCore::CPU::CreateInterpreterCore(this, Thread)); break;
     case FEXCore::Config::CONFIG_IRJIT:       Thread->CPUBackend.reset(FEXCore::CPU::CreateJITCore(this, Thread)); break;
     case FEXCore::Config::CONFIG_LLVMJIT:     Thread->CPUBackend.reset(FEXCore::CPU::CreateLLVMCore(Thread)); break;
     case FEXCore::Config::CONFIG_CUSTOM:      Thread->CPUBackend.reset(CustomCPUFactory(this, &Thread->State)); break;
@@ -455,19 +472,147 @@ namespace FEXCore::Context {
     return Thread;
   }
 
+  bool Context::OptimizeIR(FEXCore::IR::IRListView<true> const *IR, bool Compile, FEXCore::Context::Debug::IRCompileResult *Result) {
+    if (!OfflineThread) {
+      InitializePassPipeline();
+
+      FEXCore::Core::CPUState NewThreadState{};
+      OfflineThread = CreateThread(&NewThreadState, 0, 0);
+      OfflineThread->CPUBackend->Initialize();
+    }
+
+    *Result = {};
+
+    auto Dispatcher = OfflineThread->OpDispatcher.get();
+    Dispatcher->LoadIR(IR);
+
+    auto PassStart = std::chrono::high_resolution_clock::now();
+    PassManager.Run(Dispatcher);
+    auto PassEnd = std::chrono::high_resolution_clock::now();
+    Result->PassTimeNS = std::chrono::duration_cast<std::chrono::nanoseconds>(PassEnd - PassStart).count();
+    Result->SpillSlots = RAPass ? RAPass->SpillSlots() : 0;
+
+    Result->IR = Dispatcher->CreateIRCopy();
+    Dispatcher->ResetWorkingList();
+
+    if (!Compile) {
+      return true;
+    }
+
+    FEXCore::Core::DebugData DebugData{};
+    auto CompileStart = std::chrono::high_resolution_clock::now();
+    void *CodePtr = OfflineThread->CPUBackend->CompileCode(Result->IR, &DebugData);
+    auto CompileEnd = std::chrono::high_resolution_clock::now();
+    Result->CompileTimeNS = std::chrono::duration_cast<std::chrono::nanoseconds>(CompileEnd - CompileStart).count();
+    Result->HostCodeSize = DebugData.HostCodeSize;
+
+    return CodePtr != nullptr;
+  }
+
   IR::RegisterAllocationPass *Context::GetRegisterAllocatorPass() {
     if (!RAPass) {
-      RAPass = IR::CreateRegisterAllocationPass();
-      PassManager.InsertPass(RAPass);
+      // Linear scan spills more, but it is a lot cheaper to run when the rest of the pipeline is cut down for compile speed
+      bool LinearScan = Config.RegisterAllocator == FEXCore::Config::CONFIG_RA_LINEARSCAN ||
+        (Config.RegisterAllocator == FEXCore::Config::CONFIG_RA_AUTO && Config.OptimizationLevel < FEXCore::Config::CONFIG_O2);
+      RAPass = LinearScan ? IR::CreateLinearScanRegisterAllocationPass() : IR::CreateRegisterAllocationPass();
+      PassManager.InsertPass(RAPass, "RegisterAllocation");
     }
 
     return RAPass;
   }
 
+  void Context::ClearCodeCache(FEXCore::Core::InternalThreadState *Thread, uint64_t KeepRIP) {
+    Thread->BlockCache->ClearCache();
+    Thread->CPUBackend->ClearCache();
+
+    // The IR copies can only be freed all at once
+    // The block that is being mapped still needs its IR, so it gets copied out and back in to the fresh slab
+    std::unique_ptr<FEXCore::IR::IRListView<true>> KeepIR;
+    FEXCore::Core::DebugData KeepDebugData{};
+    std::shared_ptr<void> KeepBackendData;
+    auto IR = Thread->IRLists.find(KeepRIP);
+    if (IR != Thread->IRLists.end()) {
+      KeepIR.reset(new FEXCore::IR::IRListView<true>(reinterpret_cast<void*>(IR->second.IR->GetData()), IR->second.IR->GetDataSize()));
+      KeepDebugData = IR->second.DebugData;
+      KeepBackendData = IR->second.BackendData;
+    }
+
+    Thread->IRLists.clear();
+    Thread->IRListAllocator.Reset();
+    Thread->IRCacheBytes = 0;
+
+    if (KeepIR) {
+      auto &Entry = Thread->IRLists[KeepRIP];
+      Entry.IR.reset(new FEXCore::IR::IRListView<true>(reinterpret_cast<void*>(KeepIR->GetData()), KeepIR->GetDataSize(), &Thread->IRListAllocator));
+      Entry.DebugData = KeepDebugData;
+      Entry.BackendData = KeepBackendData;
+      Thread->IRCacheBytes = KeepIR->GetDataSize();
+    }
+  }
+
+  bool Context::ShouldRetainIR(FEXCore::Core::InternalThreadState *Thread) {
+    return Config.RetainIR || GetGdbServerStatus() || Thread->CPUBackend->NeedsRetainedIR();
+  }
+
+  void Context::TrimIRCache(FEXCore::Core::InternalThreadState *Thread, uint64_t KeepRIP) {
+    if (Config.IRCacheSize == 0 || Thread->IRCacheBytes <= Config.IRCacheSize) {
+      return;
+    }
+
+    // Oldest first
+    std::vector<std::pair<uint64_t, uint64_t>> Blocks;
+    Blocks.reserve(Thread->IRLists.size());
+    for (auto &IR : Thread->IRLists) {
+      if (IR.first != KeepRIP) {
+        Blocks.emplace_back(IR.second.DebugData.LastUsed, IR.first);
+      }
+    }
+    std::sort(Blocks.begin(), Blocks.end());
+
+    // Go a bit below the budget so we don't end up here again on the next compile
+    uint64_t Target = Config.IRCacheSize / 4 * 3;
+    bool EraseMapping = Thread->CPUBackend->NeedsRetainedIR();
+    for (auto &Block : Blocks) {
+      if (Thread->IRCacheBytes <= Target) {
+        break;
+      }
+
+      auto IR = Thread->IRLists.find(Block.second);
+      Thread->IRCacheBytes -= IR->second.IR->GetDataSize();
+      Thread->IRLists.erase(IR);
+      if (EraseMapping) {
+        Thread->BlockCache->Erase(Block.second);
+      }
+    }
+
+    // Evicted IR stays in the slab, repack once most of it is dead
+    if (Thread->IRListAllocator.GetAllocatedSize() > Thread->IRCacheBytes * 2) {
+      CompactIRCache(Thread);
+    }
+  }
+
+  void Context::CompactIRCache(FEXCore::Core::InternalThreadState *Thread) {
+    std::vector<std::unique_ptr<FEXCore::IR::IRListView<true>>> Live;
+    Live.reserve(Thread->IRLists.size());
+    for (auto &IR : Thread->IRLists) {
+      Live.emplace_back(new FEXCore::IR::IRListView<true>(reinterpret_cast<void*>(IR.second.IR->GetData()), IR.second.IR->GetDataSize()));
+      IR.second.IR.reset();
+    }
+
+    Thread->IRListAllocator.Reset();
+
+    // Iteration order is stable as long as nothing is inserted
+    size_t i = 0;
+    for (auto &IR : Thread->IRLists) {
+      IR.second.IR.reset(new FEXCore::IR::IRListView<true>(reinterpret_cast<void*>(Live[i]->GetData()), Live[i]->GetDataSize(), &Thread->IRListAllocator));
+      ++i;
+    }
+  }
+
   uintptr_t Context::AddBlockMapping(FEXCore::Core::InternalThreadState *Thread, uint64_t Address, void *Ptr) {
     auto BlockMapPtr = Thread->BlockCache->AddBlockMapping(Address, Ptr);
     if (BlockMapPtr == 0) {
-      Thread->BlockCache->ClearCache();
+      ClearCodeCache(Thread, Address);
       BlockMapPtr = Thread->BlockCache->AddBlockMapping(Address, Ptr);
       LogMan::Throw::A(BlockMapPtr, "Couldn't add mapping after clearing mapping cache");
     }
@@ -490,10 +635,15 @@ namespace FEXCore::Context {
     }
 
     // Do we already have this in the IR cache?
+    bool RetainIR = ShouldRetainIR(Thread);
     auto IR = Thread->IRLists.find(GuestRIP);
     FEXCore::IR::IRListView<true> *IRList {};
     FEXCore::Core::DebugData *DebugData {};
 
+    // Backends that are done with the IR once the code is compiled get a copy that is freed right after
+    std::unique_ptr<FEXCore::IR::IRListView<true>> TemporaryIR;
+    FEXCore::Core::DebugData TemporaryDebugData {};
+
     if (IR == Thread->IRLists.end()) {
       bool HadDispatchError {false};
 
@@ -529,6 +679,9 @@ namespace FEXCore::Context {
 
           if (TableInfo->OpcodeDispatcher) {
             auto Fn = TableInfo->OpcodeDispatcher;
+            if (Config.JITSymbols) {
+              Thread->OpDispatcher->StartGuestOpcode(DecodedInfo->PC);
+            }
             std::invoke(Fn, Thread->OpDispatcher, DecodedInfo);
             if (Thread->OpDispatcher->HadDecodeFailure()) {
               if (Config.BreakOnFrontendFailure) {
@@ -571,6 +724,17 @@ namespace FEXCore::Context {
 
       Thread->OpDispatcher->Finalize();
 
+      if (!Config.IRSerializePath.empty()) {
+        // Unoptimized IR for offline pass testing
+        char Filename[32];
+        snprintf(Filename, sizeof(Filename), "/%lx.fexir", GuestRIP);
+        std::ofstream Output(Config.IRSerializePath + Filename, std::ios::out | std::ios::binary);
+        if (Output.is_open()) {
+          auto NewIR = Thread->OpDispatcher->ViewIR();
+          FEXCore::IR::Serialize(&Output, &NewIR);
+        }
+      }
+
       // Run the passmanager over the IR from the dispatcher
       PassManager.Run(Thread->OpDispatcher.get());
 
@@ -581,30 +745,51 @@ namespace FEXCore::Context {
         printf("IR 0x%lx:\n%s\n@@@@@\n", GuestRIP, out.str().c_str());
       }
 
-      // Create a copy of the IR and place it in this thread's IR cache
-      auto AddedIR = Thread->IRLists.try_emplace(GuestRIP, Thread->OpDispatcher->CreateIRCopy());
+      if (RetainIR) {
+        // Create a copy of the IR and place it in this thread's IR cache
+        auto &Entry = Thread->IRLists[GuestRIP];
+        Entry.IR.reset(Thread->OpDispatcher->CreateIRCopy(&Thread->IRListAllocator));
+        IRList = Entry.IR.get();
+        DebugData = &Entry.DebugData;
+        Thread->IRCacheBytes += IRList->GetDataSize();
+      }
+      else {
+        TemporaryIR.reset(Thread->OpDispatcher->CreateIRCopy());
+        IRList = TemporaryIR.get();
+        DebugData = &TemporaryDebugData;
+      }
       Thread->OpDispatcher->ResetWorkingList();
 
-      auto Debugit = Thread->DebugData.try_emplace(GuestRIP);
-      Debugit.first->second.GuestCodeSize = TotalInstructionsLength;
-      Debugit.first->second.GuestInstructionCount = TotalInstructions;
+      DebugData->GuestCodeSize = TotalInstructionsLength;
+      DebugData->GuestInstructionCount = TotalInstructions;
 
-      IRList = AddedIR.first->second.get();
-      DebugData = &Debugit.first->second;
+      {
+        std::lock_guard<std::mutex> lk(EntryListMutex);
+        EntryList.insert(GuestRIP);
+      }
       Thread->Stats.BlocksCompiled.fetch_add(1);
     }
     else {
-      IRList = IR->second.get();
+      IRList = IR->second.IR.get();
+      DebugData = &IR->second.DebugData;
     }
 
     // Attempt to get the CPU backend to compile this code
     CodePtr = Thread->CPUBackend->CompileCode(IRList, DebugData);
 
+    if (RetainIR) {
+      // Can move the IR of this block, IRList isn't valid past this point
+      DebugData->LastUsed = ++Thread->IRCacheStamp;
+      TrimIRCache(Thread, GuestRIP);
+    }
+
     if (CodePtr != nullptr) {
       // The core managed to compile the code.
-#if ENABLE_JITSYMBOLS
-      Symbols.Register(CodePtr, GuestRIP, DebugData->HostCodeSize);
-#endif
+      // The interpreter doesn't generate any host code
+      if (Config.JITSymbols && DebugData->HostCodeSize) {
+        uint64_t GuestBase = Config.UnifiedMemory ? MemoryMapper.GetBaseOffset<uint64_t>(0) : 0;
+        Symbols.Register(CodePtr, GuestRIP, LocalLoader->FindSymbolNameInRange(GuestRIP - GuestBase), DebugData);
+      }
 
       return AddBlockMapping(Thread, GuestRIP, CodePtr);
     }
@@ -830,8 +1015,12 @@ namespace FEXCore::Context {
     Thread->State.State.rip = RIP;
 
     // Erase the RIP from all the storage backings if it exists
-    Thread->IRLists.erase(RIP);
-    Thread->DebugData.erase(RIP);
+    // The old IR copy stays in the slab until the code cache is cleared or compacted
+    auto IR = Thread->IRLists.find(RIP);
+    if (IR != Thread->IRLists.end()) {
+      Thread->IRCacheBytes -= IR->second.IR->GetDataSize();
+      Thread->IRLists.erase(IR);
+    }
     Thread->BlockCache->Erase(RIP);
 
     // We don't care if compilation passes or not
@@ -883,12 +1072,12 @@ namespace FEXCore::Context {
   }
 
   bool Context::GetDebugDataForRIP(uint64_t RIP, FEXCore::Core::DebugData *Data) {
-    auto it = ParentThread->DebugData.find(RIP);
-    if (it == ParentThread->DebugData.end()) {
+    auto it = ParentThread->IRLists.find(RIP);
+    if (it == ParentThread->IRLists.end()) {
       return false;
     }
 
-    memcpy(Data, &it->second, sizeof(FEXCore::Core::DebugData));
+    *Data = it->second.DebugData;
     return true;
   }
 
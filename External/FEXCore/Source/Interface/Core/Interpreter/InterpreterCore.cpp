@@ -10,23 +10,43 @@
 #include <FEXCore/IR/IR.h>
 #include <FEXCore/IR/IntrusiveIRList.h>
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cmath>
 #include <limits>
+#include <memory>
 #include <vector>
 
 namespace FEXCore::CPU {
 
-#define DESTMAP_AS_MAP 0
-#if DESTMAP_AS_MAP
-using DestMapType = std::unordered_map<uint32_t, uint32_t>;
-#else
-using DestMapType = std::vector<uint32_t>;
-#endif
+/**
+ * @brief An IR op that was lowered for direct threaded execution
+ *
+ * Blocks are lowered in to one flat array of these, with markers at the start and end of every block
+ */
+struct DecodedOp {
+  constexpr static size_t MAX_ARGS = 4;
+
+  void const *Handler; ///< Label in ExecuteCode that runs this op
+  uint32_t OpOffset; ///< Offset of the IR op from the start of the IR data
+  uint32_t Dest; ///< Frame offset of the result. For block markers the ID of the block
+  uint32_t DestSize; ///< Size of the result. 0 if the op doesn't have a destination
+  uint32_t Args[MAX_ARGS]; ///< Frame offsets of the arguments. Branch targets are indexes in to the decoded ops instead
+};
+
+/**
+ * @brief An IR list lowered for the interpreter, with every result assigned a fixed slot in the frame
+ */
+struct DecodedList {
+  std::vector<DecodedOp> Ops;
+  std::vector<uint32_t> Slots; ///< SSA ID -> Frame offset, for handlers that read arguments straight from the IR op
+  uint32_t FrameSize;
+};
 
 class InterpreterCore final : public CPUBackend {
 public:
-  explicit InterpreterCore(FEXCore::Context::Context *ctx);
+  explicit InterpreterCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread);
   ~InterpreterCore() override = default;
   std::string GetName() override { return "Interpreter"; }
   void *CompileCode(FEXCore::IR::IRListView<true> const *IR, FEXCore::Core::DebugData *DebugData) override;
@@ -34,23 +54,35 @@ public:
   void *MapRegion(void* HostPtr, uint64_t, uint64_t) override { return HostPtr; }
 
   bool NeedsOpDispatch() override { return true; }
+  // Blocks are executed straight from the IR
+  bool NeedsRetainedIR() override { return true; }
 
   void ExecuteCode(FEXCore::Core::InternalThreadState *Thread);
 private:
   FEXCore::Context::Context *CTX;
-  uint32_t AllocateTmpSpace(size_t Size);
+  FEXCore::Core::InternalThreadState *ThreadState;
+
+  void LowerIR(FEXCore::IR::IRListView<true> const *IR, DecodedList *List);
 
   template<typename Res>
-  Res GetDest(IR::OrderedNodeWrapper Op);
+  Res GetDest(uint32_t Offset) { return reinterpret_cast<Res>(&TmpSpace[Offset]); }
 
   template<typename Res>
-  Res GetSrc(IR::OrderedNodeWrapper Src);
+  Res GetSrc(uint32_t Offset) { return reinterpret_cast<Res>(&TmpSpace[Offset]); }
+
+  template<typename Res>
+  Res GetSrc(IR::OrderedNodeWrapper Src) { return GetSrc<Res>(CurrentList->Slots[Src.ID()]); }
+
+  // Filled in by the first CompileCode call
+  std::array<void const*, FEXCore::IR::OP_LAST + 1> Handlers{};
+  void const *BlockBeginHandler{};
+  void const *BlockFallthroughHandler{};
+  void const *ExitHandler{};
 
   std::vector<uint8_t> TmpSpace;
-  DestMapType DestMap;
-  size_t TmpOffset{};
 
   FEXCore::IR::IRListView<true> *CurrentIR;
+  DecodedList const *CurrentList;
 };
 
 static void InterpreterExecution(FEXCore::Core::InternalThreadState *Thread) {
@@ -58,3791 +90,4174 @@ static void InterpreterExecution(FEXCore::Core::InternalThreadState *Thread) {
   Core->ExecuteCode(Thread);
 }
 
-InterpreterCore::InterpreterCore(FEXCore::Context::Context *ctx)
-  : CTX {ctx} {
-  // Grab our space for temporary data
-  TmpSpace.resize(4096 * 32);
-#if !DESTMAP_AS_MAP
-  DestMap.resize(4096);
-#endif
+InterpreterCore::InterpreterCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread)
+  : CTX {ctx}
+  , ThreadState {Thread} {
+  // Grab our space for temporary data, grows when a block needs a larger frame
+  TmpSpace.resize(4096 * 16);
+}
+
+void *InterpreterCore::CompileCode(FEXCore::IR::IRListView<true> const *IR, [[maybe_unused]] FEXCore::Core::DebugData *DebugData) {
+  if (!BlockBeginHandler) {
+    // Only fills in the handlers without a thread
+    ExecuteCode(nullptr);
+  }
+
+  // Lowered once when the block is compiled, then kept along with the IR
+  // Ops are stored as offsets so they survive the IR being moved around by the IR cache
+  // The block isn't necessarily at the thread's RIP, the IR header knows where it starts
+  // Offline compiles don't have an IR cache entry, nothing will run them
+  uintptr_t ListBegin = IR->GetListData();
+  uintptr_t DataBegin = IR->GetData();
+  auto HeaderOp = IR->begin()()->GetNode(ListBegin)->Op(DataBegin)->C<FEXCore::IR::IROp_IRHeader>();
+
+  auto Entry = ThreadState->IRLists.find(HeaderOp->Entry);
+  if (Entry != ThreadState->IRLists.end() && Entry->second.IR.get() == IR && !Entry->second.BackendData) {
+    auto Lowered = std::make_shared<DecodedList>();
+    LowerIR(IR, Lowered.get());
+    Entry->second.BackendData = Lowered;
+  }
+
+  return reinterpret_cast<void*>(InterpreterExecution);
 }
 
-uint32_t InterpreterCore::AllocateTmpSpace(size_t Size) {
-  // XXX: IR generation has a bug where the size can periodically end up being zero
-  // LogMan::Throw::A(Size !=0, "Dest Op had zero destination size");
-  Size = Size < 16 ? 16 : Size;
+void InterpreterCore::LowerIR(FEXCore::IR::IRListView<true> const *IR, DecodedList *List) {
+  using namespace FEXCore::IR;
+  uintptr_t ListBegin = IR->GetListData();
+  uintptr_t DataBegin = IR->GetData();
+  auto Ops = &List->Ops;
+
+  auto HeaderIterator = IR->begin();
+  auto HeaderOp = HeaderIterator()->GetNode(ListBegin)->Op(DataBegin)->C<IROp_IRHeader>();
+  LogMan::Throw::A(HeaderOp->Header.Op == IR::OP_IRHEADER, "First op wasn't IRHeader");
 
-  // Force alignment by size
-  size_t NewBase = AlignUp(TmpOffset, Size);
-  size_t NewEnd = NewBase + Size;
+  // The block markers don't have an op of their own, point them at the header so reading their op is still safe
+  uint32_t HeaderOffset = reinterpret_cast<uintptr_t>(HeaderOp) - DataBegin;
+
+  size_t SSACount = IR->GetSSACount();
+
+  // SSA IDs leave gaps for the op data in between nodes, so the blocks and nodes get dense indexes for the tables below
+  // Index 0 stands in for anything else
+  std::vector<uint32_t> NodeIndex(SSACount, 0);
+  uint32_t NodeCount = 1;
+  for (OrderedNodeWrapper BlockWrapper = HeaderOp->Blocks;;) {
+    auto BlockIROp = BlockWrapper.GetNode(ListBegin)->Op(DataBegin)->C<IROp_CodeBlock>();
+    NodeIndex[BlockWrapper.ID()] = NodeCount++;
+
+    auto CodeBegin = IR->at(BlockIROp->Begin);
+    auto CodeLast = IR->at(BlockIROp->Last);
+    while (1) {
+      NodeIndex[CodeBegin()->ID()] = NodeCount++;
+      if (CodeBegin == CodeLast) {
+        break;
+      }
+      ++CodeBegin;
+    }
 
-  if (NewEnd >= TmpSpace.size()) {
-    // If we are going to overrun the end of our temporary space then double the size of it
-    TmpSpace.resize(TmpSpace.size() * 2);
+    if (BlockIROp->Next.ID() == 0) {
+      break;
+    }
+    BlockWrapper = BlockIROp->Next;
   }
 
-  // Make sure to set the new offset
-  TmpOffset = NewEnd;
+  // Block index -> Index of its first decoded op
+  std::vector<uint32_t> BlockStart(NodeCount, ~0U);
+  std::vector<size_t> Branches;
+
+  // Live ranges of every result, positions are indexes in to the decoded ops
+  struct LiveRange {
+    uint32_t Block;
+    uint32_t Def;
+    uint32_t LastUse;
+    uint32_t Size;
+    bool Global;
+  };
+  constexpr uint32_t NoDef = ~0U;
+  std::vector<LiveRange> Ranges(NodeCount, LiveRange{0, NoDef, 0, 0, false});
+
+  OrderedNodeWrapper BlockWrapper = HeaderOp->Blocks;
+  while (1) {
+    auto BlockIROp = BlockWrapper.GetNode(ListBegin)->Op(DataBegin)->C<IROp_CodeBlock>();
+    LogMan::Throw::A(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
 
-  return NewBase;
-}
+    BlockStart[NodeIndex[BlockWrapper.ID()]] = Ops->size();
+    Ops->emplace_back(DecodedOp{BlockBeginHandler, HeaderOffset, BlockWrapper.ID()});
 
-template<typename Res>
-Res InterpreterCore::GetDest(IR::OrderedNodeWrapper Op) {
-  auto DstPtr = &TmpSpace.at(DestMap[Op.ID()]);
-  return reinterpret_cast<Res>(DstPtr);
-}
+    auto CodeBegin = IR->at(BlockIROp->Begin);
+    auto CodeLast = IR->at(BlockIROp->Last);
 
-template<typename Res>
-Res InterpreterCore::GetSrc(IR::OrderedNodeWrapper Src) {
-#if DESTMAP_AS_MAP
-  LogMan::Throw::A(DestMap.find(Src.ID()) != DestMap.end(), "Op had source but it wasn't in the destination map");
-#endif
+    while (1) {
+      OrderedNodeWrapper *WrapperOp = CodeBegin();
+      IROp_Header const *IROp = WrapperOp->GetNode(ListBegin)->Op(DataBegin);
 
-  auto DstPtr = &TmpSpace.at(DestMap[Src.ID()]);
-  LogMan::Throw::A(DstPtr != nullptr, "Destmap had slot but didn't get allocated memory");
-  return reinterpret_cast<Res>(DstPtr);
-}
+      DecodedOp Decoded{};
+      Decoded.Handler = Handlers[IROp->Op];
+      Decoded.OpOffset = reinterpret_cast<uintptr_t>(IROp) - DataBegin;
+      Decoded.Dest = WrapperOp->ID();
+      if (IROp->HasDest) {
+        Decoded.DestSize = IROp->Size * std::max(static_cast<uint8_t>(1), IROp->Elements);
 
-void *InterpreterCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const *IR, [[maybe_unused]] FEXCore::Core::DebugData *DebugData) {
-  return reinterpret_cast<void*>(InterpreterExecution);
+        // XXX: IR generation has a bug where the size can periodically end up being zero
+        // Every slot is at least 16 bytes since results get their first 16 bytes cleared
+        uint32_t Size = AlignUp(std::max(Decoded.DestSize, 16U), 16);
+        Ranges[NodeIndex[WrapperOp->ID()]] = LiveRange{BlockWrapper.ID(), static_cast<uint32_t>(Ops->size()), static_cast<uint32_t>(Ops->size()), Size, false};
+      }
+
+      for (uint8_t i = 0; i < std::min(IROp->NumArgs, static_cast<uint8_t>(DecodedOp::MAX_ARGS)); ++i) {
+        Decoded.Args[i] = IROp->Args[i].ID();
+      }
+
+      if (IROp->Op == OP_JUMP || IROp->Op == OP_CONDJUMP) {
+        Branches.emplace_back(Ops->size());
+      }
+      Ops->emplace_back(Decoded);
+
+      // CodeLast is inclusive. So we still need to lower the CodeLast op as well
+      if (CodeBegin == CodeLast) {
+        break;
+      }
+      ++CodeBegin;
+    }
+
+    if (BlockIROp->Next.ID() == 0) {
+      Ops->emplace_back(DecodedOp{ExitHandler, HeaderOffset});
+      break;
+    }
+
+    Ops->emplace_back(DecodedOp{BlockFallthroughHandler, HeaderOffset});
+    BlockWrapper = BlockIROp->Next;
+  }
+
+  // Uses need every def to be known first, arguments can refer to results of later blocks through back edges
+  // A result only gets a block local slot if everything that uses it comes after it in its own block.
+  // Anything else is live across block boundaries and keeps its slot for the whole list.
+  uint32_t CurrentBlock{};
+  for (uint32_t Index = 0; Index < Ops->size(); ++Index) {
+    auto &Decoded = Ops->at(Index);
+    if (Decoded.Handler == BlockBeginHandler) {
+      CurrentBlock = Decoded.Dest;
+      continue;
+    }
+    if (Decoded.Handler == BlockFallthroughHandler || Decoded.Handler == ExitHandler) {
+      continue;
+    }
+
+    // Walk the IR args rather than the decoded ones, Syscall and Phi values have more than fit in a DecodedOp
+    auto IROp = reinterpret_cast<IROp_Header const*>(DataBegin + Decoded.OpOffset);
+    for (uint8_t i = 0; i < IROp->NumArgs; ++i) {
+      auto &Range = Ranges[NodeIndex[IROp->Args[i].ID()]];
+      if (Range.Def == NoDef) {
+        // Blocks and ops without results
+        continue;
+      }
+
+      if (Range.Block != CurrentBlock || Index <= Range.Def) {
+        Range.Global = true;
+      }
+      Range.LastUse = std::max(Range.LastUse, Index);
+    }
+  }
+
+  // Handlers that read arguments straight from the IR op look their slots up by SSA ID, so this one stays sparse
+  List->Slots.assign(SSACount, 0);
+  uint32_t GlobalSize{};
+  for (size_t ID = 0; ID < SSACount; ++ID) {
+    auto &Range = Ranges[NodeIndex[ID]];
+    if (Range.Def != NoDef && Range.Global) {
+      List->Slots[ID] = GlobalSize;
+      GlobalSize += Range.Size;
+    }
+  }
+
+  // Linear scan over every block, block local results reuse the slots of results that are dead
+  // A slot is only freed after the op that last uses it, results never share a slot with their own arguments
+  uint32_t FrameSize = GlobalSize;
+  std::vector<std::pair<uint32_t, uint32_t>> FreeSlots; // Size, Offset
+  std::vector<uint32_t> Active;
+  uint32_t BlockEnd{};
+  for (uint32_t Index = 0; Index < Ops->size(); ++Index) {
+    auto &Decoded = Ops->at(Index);
+    if (Decoded.Handler == BlockBeginHandler) {
+      FreeSlots.clear();
+      Active.clear();
+      BlockEnd = GlobalSize;
+      continue;
+    }
+
+    // Expire the results that were last used before this op
+    for (size_t i = 0; i < Active.size();) {
+      auto &Range = Ranges[NodeIndex[Active[i]]];
+      if (Range.LastUse < Index) {
+        FreeSlots.emplace_back(Range.Size, List->Slots[Active[i]]);
+        Active[i] = Active.back();
+        Active.pop_back();
+      }
+      else {
+        ++i;
+      }
+    }
+
+    uint32_t ID = Decoded.Dest;
+    auto &Range = Ranges[NodeIndex[ID]];
+    if (Range.Def != Index || Range.Global) {
+      continue;
+    }
+
+    auto Free = std::find_if(FreeSlots.begin(), FreeSlots.end(), [&Range](auto const &Slot) { return Slot.first == Range.Size; });
+    if (Free != FreeSlots.end()) {
+      List->Slots[ID] = Free->second;
+      *Free = FreeSlots.back();
+      FreeSlots.pop_back();
+    }
+    else {
+      List->Slots[ID] = BlockEnd;
+      BlockEnd += Range.Size;
+      FrameSize = std::max(FrameSize, BlockEnd);
+    }
+    Active.emplace_back(ID);
+  }
+  List->FrameSize = FrameSize;
+
+  // Rewrite the operands of every op to frame offsets
+  for (uint32_t Index = 0; Index < Ops->size(); ++Index) {
+    auto &Decoded = Ops->at(Index);
+    if (Decoded.Handler == BlockBeginHandler || Decoded.Handler == BlockFallthroughHandler || Decoded.Handler == ExitHandler) {
+      continue;
+    }
+
+    auto IROp = reinterpret_cast<IROp_Header const*>(DataBegin + Decoded.OpOffset);
+    Decoded.Dest = Ranges[NodeIndex[Decoded.Dest]].Def == Index ? List->Slots[Decoded.Dest] : 0;
+    for (uint8_t i = 0; i < std::min(IROp->NumArgs, static_cast<uint8_t>(DecodedOp::MAX_ARGS)); ++i) {
+      Decoded.Args[i] = List->Slots[IROp->Args[i].ID()];
+    }
+  }
+
+  // Branch targets become indexes of the first op of the target block
+  auto ResolveTarget = [&](uint32_t &Target, OrderedNodeWrapper Block) {
+    LogMan::Throw::A(BlockStart[NodeIndex[Block.ID()]] != ~0U, "Branch to %%ssa%d which isn't a block", Block.ID());
+    Target = BlockStart[NodeIndex[Block.ID()]];
+  };
+
+  for (auto Branch : Branches) {
+    auto &Decoded = Ops->at(Branch);
+    auto IROp = reinterpret_cast<IROp_Header const*>(DataBegin + Decoded.OpOffset);
+    if (IROp->Op == OP_JUMP) {
+      ResolveTarget(Decoded.Args[0], IROp->Args[0]);
+    }
+    else {
+      ResolveTarget(Decoded.Args[1], IROp->Args[1]);
+      ResolveTarget(Decoded.Args[2], IROp->Args[2]);
+    }
+  }
 }
 
 void InterpreterCore::ExecuteCode(FEXCore::Core::InternalThreadState *Thread) {
+  using namespace FEXCore::IR;
+
+  if (!BlockBeginHandler) {
+    // Label addresses only exist inside of this function
+    Handlers.fill(&&Op_Unhandled);
+#define REGISTER_OP(Op) Handlers[IR::OP_##Op] = &&Op_##Op
+    REGISTER_OP(DUMMY);
+    REGISTER_OP(GUESTOPCODE);
+    REGISTER_OP(BEGINBLOCK);
+    REGISTER_OP(ENDBLOCK);
+    REGISTER_OP(EXITFUNCTION);
+    REGISTER_OP(CONDJUMP);
+    REGISTER_OP(JUMP);
+    REGISTER_OP(BREAK);
+    REGISTER_OP(SYSCALL);
+    REGISTER_OP(CPUID);
+    REGISTER_OP(PRINT);
+    REGISTER_OP(CYCLECOUNTER);
+    REGISTER_OP(PHI);
+    REGISTER_OP(PHIVALUE);
+    REGISTER_OP(MOV);
+    REGISTER_OP(VBITCAST);
+    REGISTER_OP(VCASTFROMGPR);
+    REGISTER_OP(VEXTRACTTOGPR);
+    REGISTER_OP(VEXTRACTELEMENT);
+    REGISTER_OP(CONSTANT);
+    REGISTER_OP(LOADCONTEXT);
+    REGISTER_OP(LOADCONTEXTINDEXED);
+    REGISTER_OP(STORECONTEXT);
+    REGISTER_OP(STORECONTEXTINDEXED);
+    REGISTER_OP(LOADCONTEXTPAIR);
+    REGISTER_OP(STORECONTEXTPAIR);
+    REGISTER_OP(CREATEELEMENTPAIR);
+    REGISTER_OP(EXTRACTELEMENTPAIR);
+    REGISTER_OP(CASPAIR);
+    REGISTER_OP(TRUNCELEMENTPAIR);
+    REGISTER_OP(LOADFLAG);
+    REGISTER_OP(STOREFLAG);
+    REGISTER_OP(LOADMEM);
+    REGISTER_OP(STOREMEM);
+    REGISTER_OP(MEMCPY);
+    REGISTER_OP(MEMSET);
+    REGISTER_OP(ADD);
+    REGISTER_OP(SUB);
+    REGISTER_OP(NEG);
+    REGISTER_OP(OR);
+    REGISTER_OP(AND);
+    REGISTER_OP(XOR);
+    REGISTER_OP(LSHL);
+    REGISTER_OP(LSHR);
+    REGISTER_OP(ASHR);
+    REGISTER_OP(ROR);
+    REGISTER_OP(ROL);
+    REGISTER_OP(NOT);
+    REGISTER_OP(ZEXT);
+    REGISTER_OP(SEXT);
+    REGISTER_OP(MUL);
+    REGISTER_OP(MULH);
+    REGISTER_OP(UMUL);
+    REGISTER_OP(UMULH);
+    REGISTER_OP(DIV);
+    REGISTER_OP(UDIV);
+    REGISTER_OP(REM);
+    REGISTER_OP(UREM);
+    REGISTER_OP(POPCOUNT);
+    REGISTER_OP(FINDLSB);
+    REGISTER_OP(FINDMSB);
+    REGISTER_OP(REV);
+    REGISTER_OP(FINDTRAILINGZEROS);
+    REGISTER_OP(BFI);
+    REGISTER_OP(BFE);
+    REGISTER_OP(SELECT);
+    REGISTER_OP(CAS);
+    REGISTER_OP(ATOMICADD);
+    REGISTER_OP(ATOMICSUB);
+    REGISTER_OP(ATOMICAND);
+    REGISTER_OP(ATOMICOR);
+    REGISTER_OP(ATOMICXOR);
+    REGISTER_OP(ATOMICSWAP);
+    REGISTER_OP(ATOMICFETCHADD);
+    REGISTER_OP(ATOMICFETCHSUB);
+    REGISTER_OP(ATOMICFETCHAND);
+    REGISTER_OP(ATOMICFETCHOR);
+    REGISTER_OP(ATOMICFETCHXOR);
+    REGISTER_OP(CREATEVECTOR2);
+    REGISTER_OP(SPLATVECTOR4);
+    REGISTER_OP(SPLATVECTOR3);
+    REGISTER_OP(SPLATVECTOR2);
+    REGISTER_OP(VMOV);
+    REGISTER_OP(VOR);
+    REGISTER_OP(VAND);
+    REGISTER_OP(VXOR);
+    REGISTER_OP(VSLI);
+    REGISTER_OP(VSRI);
+    REGISTER_OP(VNOT);
+    REGISTER_OP(VUSHRI);
+    REGISTER_OP(VSSHRI);
+    REGISTER_OP(VSHLI);
+    REGISTER_OP(VADD);
+    REGISTER_OP(VSUB);
+    REGISTER_OP(VUQADD);
+    REGISTER_OP(VUQSUB);
+    REGISTER_OP(VSQADD);
+    REGISTER_OP(VSQSUB);
+    REGISTER_OP(VFADD);
+    REGISTER_OP(VFSUB);
+    REGISTER_OP(VADDP);
+    REGISTER_OP(VFMUL);
+    REGISTER_OP(VFDIV);
+    REGISTER_OP(VFMIN);
+    REGISTER_OP(VFMAX);
+    REGISTER_OP(VFRECP);
+    REGISTER_OP(VFSQRT);
+    REGISTER_OP(VFRSQRT);
+    REGISTER_OP(VUSHRNI);
+    REGISTER_OP(VUSHRNI2);
+    REGISTER_OP(VSQXTN);
+    REGISTER_OP(VSQXTN2);
+    REGISTER_OP(VSQXTUN);
+    REGISTER_OP(VSQXTUN2);
+    REGISTER_OP(VECTOR_UTOF);
+    REGISTER_OP(VECTOR_STOF);
+    REGISTER_OP(VECTOR_FTOZU);
+    REGISTER_OP(VECTOR_FTOZS);
+    REGISTER_OP(VUMUL);
+    REGISTER_OP(VSMUL);
+    REGISTER_OP(VUMULL);
+    REGISTER_OP(VSMULL);
+    REGISTER_OP(VUMULL2);
+    REGISTER_OP(VSMULL2);
+    REGISTER_OP(VSXTL);
+    REGISTER_OP(VSXTL2);
+    REGISTER_OP(VUXTL);
+    REGISTER_OP(VUXTL2);
+    REGISTER_OP(VUMIN);
+    REGISTER_OP(VSMIN);
+    REGISTER_OP(VUMAX);
+    REGISTER_OP(VSMAX);
+    REGISTER_OP(VUSHL);
+    REGISTER_OP(VSSHR);
+    REGISTER_OP(VUSHLS);
+    REGISTER_OP(VUSHRS);
+    REGISTER_OP(VSSHRS);
+    REGISTER_OP(VUSHR);
+    REGISTER_OP(VZIP2);
+    REGISTER_OP(VZIP);
+    REGISTER_OP(VINSELEMENT);
+    REGISTER_OP(VINSSCALARELEMENT);
+    REGISTER_OP(VCMPEQ);
+    REGISTER_OP(VCMPGT);
+    REGISTER_OP(LUDIV);
+    REGISTER_OP(LDIV);
+    REGISTER_OP(LUREM);
+    REGISTER_OP(LREM);
+    REGISTER_OP(VEXTR);
+    REGISTER_OP(VINSGPR);
+    REGISTER_OP(FLOAT_FROMGPR_S);
+    REGISTER_OP(FLOAT_FROMGPR_U);
+    REGISTER_OP(FLOAT_TOGPR_ZS);
+    REGISTER_OP(FLOAT_TOGPR_ZU);
+    REGISTER_OP(FLOAT_FTOF);
+    REGISTER_OP(VECTOR_FTOF);
+    REGISTER_OP(FCMP);
+    REGISTER_OP(GETHOSTFLAG);
+    REGISTER_OP(VFCMPEQ);
+    REGISTER_OP(VFCMPNEQ);
+    REGISTER_OP(VFCMPLT);
+    REGISTER_OP(VFCMPLE);
+    REGISTER_OP(VFCMPUNO);
+    REGISTER_OP(VFCMPORD);
+#undef REGISTER_OP
+    BlockBeginHandler = &&BlockBegin;
+    BlockFallthroughHandler = &&BlockFallthrough;
+    ExitHandler = &&Exit;
+  }
+
+  if (!Thread) {
+    return;
+  }
+
+  // Only blocks with retained IR get mapped, the RIP is always the start of the block that was dispatched to
   auto IR = Thread->IRLists.find(Thread->State.State.rip);
-  auto DebugData = Thread->DebugData.find(Thread->State.State.rip);
-  CurrentIR = IR->second.get();
+  if (IR == Thread->IRLists.end() || !IR->second.BackendData) {
+    LogMan::Msg::E("Interpreter has no lowered IR for RIP: 0x%lx", Thread->State.State.rip);
+    Thread->State.RunningEvents.ShouldStop = true;
+    return;
+  }
 
-  TmpOffset = 0; // Reset where we are in the temp data range
+  auto &Entry = IR->second;
+  auto DebugData = &Entry.DebugData;
+  CurrentIR = Entry.IR.get();
+  // Keeps the block out of IR cache eviction while it is hot
+  DebugData->LastUsed = ++Thread->IRCacheStamp;
 
-  uintptr_t ListBegin = CurrentIR->GetListData();
-  uintptr_t DataBegin = CurrentIR->GetData();
+  CurrentList = static_cast<DecodedList const*>(Entry.BackendData.get());
+  auto const &Ops = CurrentList->Ops;
 
-#if DESTMAP_AS_MAP
-  DestMap.clear();
-#else
-  uintptr_t ListSize = CurrentIR->GetSSACount();
-  if (ListSize > DestMap.size()) {
-    DestMap.resize(std::max(DestMap.size() * 2, ListSize));
+  if (TmpSpace.size() < CurrentList->FrameSize) {
+    TmpSpace.resize(CurrentList->FrameSize);
   }
-#endif
+
+  uintptr_t ListBegin = CurrentIR->GetListData();
+  uintptr_t DataBegin = CurrentIR->GetData();
 
   static_assert(sizeof(FEXCore::IR::IROp_Header) == 4);
   static_assert(sizeof(FEXCore::IR::OrderedNode) == 16);
 
-  auto HeaderIterator = CurrentIR->begin();
-  IR::OrderedNodeWrapper *HeaderNodeWrapper = HeaderIterator();
-  IR::OrderedNode *HeaderNode = HeaderNodeWrapper->GetNode(ListBegin);
-  auto HeaderOp = HeaderNode->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
-  LogMan::Throw::A(HeaderOp->Header.Op == IR::OP_IRHEADER, "First op wasn't IRHeader");
+  DecodedOp const *Current = Ops.data();
+  FEXCore::IR::IROp_Header *IROp;
+  uint8_t OpSize;
+  uint32_t Node;
+
+  // Block we are in and the block we came from, used to select the incoming value of Phi nodes
+  uint32_t CurrentBlock {};
+  uint32_t PredecessorBlock {};
+
+#define GD *GetDest<uint64_t*>(Node)
+#define GDP GetDest<void*>(Node)
+
+// Sets up the state that the handlers use and jumps straight to the handler of the current op
+#define DISPATCH()                                                                      \
+  do {                                                                                  \
+    IROp = reinterpret_cast<FEXCore::IR::IROp_Header*>(DataBegin + Current->OpOffset);  \
+    OpSize = IROp->Size;                                                                \
+    Node = Current->Dest;                                                               \
+    if (Current->DestSize) {                                                            \
+      /* Clear any previous results */                                                  \
+      memset(GDP, 0, 16);                                                               \
+    }                                                                                   \
+    goto *Current->Handler;                                                             \
+  } while (0)
+
+#define NEXT_OP() do { ++Current; DISPATCH(); } while (0)
+
+  DISPATCH();
+
+  BlockBegin:
+    CurrentBlock = Current->Dest;
+    NEXT_OP();
+  BlockFallthrough:
+    // Block ended without a branch, fall in to the next block of the list
+    PredecessorBlock = CurrentBlock;
+    NEXT_OP();
+  Op_DUMMY:
+  Op_GUESTOPCODE:
+  Op_BEGINBLOCK:
+    NEXT_OP();
+  Op_ENDBLOCK: {
+    auto Op = IROp->C<IR::IROp_EndBlock>();
+    Thread->State.State.rip += Op->RIPIncrement;
+    NEXT_OP();
+  }
+  Op_EXITFUNCTION:
+    goto Exit;
+  Op_CONDJUMP: {
+    // Branch targets were resolved to decoded op indexes
+    uint64_t Arg = *GetSrc<uint64_t*>(Current->Args[0]);
+    PredecessorBlock = CurrentBlock;
+    Current = &Ops[!!Arg ? Current->Args[1] : Current->Args[2]];
+    DISPATCH();
+  }
+  Op_JUMP: {
+    PredecessorBlock = CurrentBlock;
+    Current = &Ops[Current->Args[0]];
+    DISPATCH();
+  }
+  Op_BREAK: {
+    auto Op = IROp->C<IR::IROp_Break>();
+    switch (Op->Reason) {
+      case 4: // HLT
+        Thread->State.RunningEvents.ShouldStop = true;
+        goto Exit;
+      break;
+    default: LogMan::Msg::A("Unknown Break Reason: %d", Op->Reason); break;
+    }
+    NEXT_OP();
+  }
+  Op_SYSCALL: {
+    auto Op = IROp->C<IR::IROp_Syscall>();
+
+    FEXCore::HLE::SyscallArguments Args;
+    for (size_t j = 0; j < FEXCore::HLE::SyscallArguments::MAX_ARGS; ++j) {
+      if (Op->Header.Args[j].IsInvalid()) break;
+      Args.Argument[j] = *GetSrc<uint64_t*>(Op->Header.Args[j]);
+    }
 
-  IR::OrderedNode const *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+    uint64_t Res = FEXCore::HandleSyscall(CTX->SyscallHandler, Thread, &Args);
+    GD = Res;
+    NEXT_OP();
+  }
+  Op_CPUID: {
+    uint64_t *DstPtr = GetDest<uint64_t*>(Node);
+    uint64_t Arg = *GetSrc<uint64_t*>(Current->Args[0]);
+
+    auto Results = CTX->CPUID.RunFunction(Arg);
+    memcpy(DstPtr, &Results.Res, sizeof(uint32_t) * 4);
+    NEXT_OP();
+  }
+  Op_PRINT: {
+    if (OpSize <= 8) {
+      uint64_t Src = *GetSrc<uint64_t*>(Current->Args[0]);
+      LogMan::Msg::I(">>>> Value in Arg: 0x%lx, %ld", Src, Src);
+    }
+    else if (OpSize == 16) {
+      __uint128_t Src = *GetSrc<__uint128_t*>(Current->Args[0]);
+      uint64_t Src0 = Src;
+      uint64_t Src1 = Src >> 64;
+      LogMan::Msg::I(">>>> Value[0] in Arg: 0x%lx, %ld", Src0, Src0);
+      LogMan::Msg::I("     Value[1] in Arg: 0x%lx, %ld", Src1, Src1);
+    }
+    else
+      LogMan::Msg::A("Unknown value size: %d", OpSize);
+    NEXT_OP();
+  }
+  Op_CYCLECOUNTER: {
+    #ifdef DEBUG_CYCLES
+      GD = 0;
+    #else
+      timespec time;
+      clock_gettime(CLOCK_REALTIME, &time);
+      GD = time.tv_nsec + time.tv_sec * 1000000000;
+    #endif
+    NEXT_OP();
+  }
+  Op_PHI: {
+    // Pick the value that came from the block we just left
+    auto Op = IROp->C<IR::IROp_Phi>();
+    auto PhiValueNode = Op->PhiBegin;
+    while (PhiValueNode.ID() != 0) {
+      auto PhiValueOp = PhiValueNode.GetNode(ListBegin)->Op(DataBegin)->C<IR::IROp_PhiValue>();
+      if (PhiValueOp->Block.ID() == PredecessorBlock) {
+        memcpy(GDP, GetSrc<void*>(PhiValueOp->Value), OpSize);
+        break;
+      }
+      PhiValueNode = PhiValueOp->Next;
+    }
+    LogMan::Throw::A(PhiValueNode.ID() != 0, "Phi didn't have a value for predecessor block %%ssa%d", PredecessorBlock);
+    NEXT_OP();
+  }
+  Op_PHIVALUE:
+    // Handled by the Phi
+    NEXT_OP();
+  Op_MOV: {
+    memcpy(GDP, GetSrc<void*>(Current->Args[0]), OpSize);
+    NEXT_OP();
+  }
+  Op_VBITCAST: {
+    memcpy(GDP, GetSrc<void*>(Current->Args[0]), 16);
+    NEXT_OP();
+  }
+  Op_VCASTFROMGPR: {
+    auto Op = IROp->C<IR::IROp_VCastFromGPR>();
+    memcpy(GDP, GetSrc<void*>(Current->Args[0]), Op->ElementSize);
+    NEXT_OP();
+  }
+  Op_VEXTRACTTOGPR: {
+    auto Op = IROp->C<IR::IROp_VExtractToGPR>();
+    LogMan::Throw::A(Op->RegisterSize <= 16, "OpSize is too large for VExtractToGPR: %d", OpSize);
+    if (Op->RegisterSize == 16) {
+      __uint128_t SourceMask = (1ULL << (Op->ElementSize * 8)) - 1;
+      uint64_t Shift = Op->ElementSize * Op->Idx * 8;
+      if (Op->ElementSize == 8)
+        SourceMask = ~0ULL;
+
+      __uint128_t Src = *GetSrc<__uint128_t*>(Current->Args[0]);
+      Src >>= Shift;
+      Src &= SourceMask;
+      memcpy(GDP, &Src, Op->ElementSize);
+    }
+    else {
+      uint64_t SourceMask = (1ULL << (Op->ElementSize * 8)) - 1;
+      uint64_t Shift = Op->ElementSize * Op->Idx * 8;
+      if (Op->ElementSize == 8)
+        SourceMask = ~0ULL;
+
+      uint64_t Src = *GetSrc<uint64_t*>(Current->Args[0]);
+      Src >>= Shift;
+      Src &= SourceMask;
+      GD = Src;
+    }
+    NEXT_OP();
+  }
+  Op_VEXTRACTELEMENT: {
+    auto Op = IROp->C<IR::IROp_VExtractElement>();
+    LogMan::Throw::A(Op->RegisterSize <= 16, "OpSize is too large for VExtractToGPR: %d", OpSize);
+    if (Op->RegisterSize == 16) {
+      __uint128_t SourceMask = (1ULL << (Op->ElementSize * 8)) - 1;
+      uint64_t Shift = Op->ElementSize * Op->Index * 8;
+      if (Op->ElementSize == 8)
+        SourceMask = ~0ULL;
+
+      __uint128_t Src = *GetSrc<__uint128_t*>(Current->Args[0]);
+      Src >>= Shift;
+      Src &= SourceMask;
+      memcpy(GDP, &Src, Op->ElementSize);
+    }
+    else {
+      uint64_t SourceMask = (1ULL << (Op->ElementSize * 8)) - 1;
+      uint64_t Shift = Op->ElementSize * Op->Index * 8;
+      if (Op->ElementSize == 8)
+        SourceMask = ~0ULL;
+
+      uint64_t Src = *GetSrc<uint64_t*>(Current->Args[0]);
+      Src >>= Shift;
+      Src &= SourceMask;
+      GD = Src;
+    }
+    NEXT_OP();
+  }
+  Op_CONSTANT: {
+    auto Op = IROp->C<IR::IROp_Constant>();
+    GD = Op->Constant;
+    NEXT_OP();
+  }
+  Op_LOADCONTEXT: {
+    auto Op = IROp->C<IR::IROp_LoadContext>();
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += Op->Offset;
+    #define LOAD_CTX(x, y) \
+      case x: { \
+        y const *Data = reinterpret_cast<y const*>(ContextPtr); \
+        GD = *Data; \
+        break; \
+      }
+    switch (Op->Size) {
+      LOAD_CTX(1, uint8_t)
+      LOAD_CTX(2, uint16_t)
+      LOAD_CTX(4, uint32_t)
+      LOAD_CTX(8, uint64_t)
+      case 16: {
+        void const *Data = reinterpret_cast<void const*>(ContextPtr);
+        memcpy(GDP, Data, Op->Size);
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled LoadContext size: %d", Op->Size);
+    }
+    #undef LOAD_CTX
+    NEXT_OP();
+  }
+  Op_LOADCONTEXTINDEXED: {
+    auto Op = IROp->C<IR::IROp_LoadContextIndexed>();
+    uint64_t Index = *GetSrc<uint64_t*>(Current->Args[0]);
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += Op->BaseOffset;
+    ContextPtr += Index * Op->Stride;
+
+    #define LOAD_CTX(x, y) \
+      case x: { \
+        y const *Data = reinterpret_cast<y const*>(ContextPtr); \
+        GD = *Data; \
+        break; \
+      }
+    switch (Op->Size) {
+      LOAD_CTX(1, uint8_t)
+      LOAD_CTX(2, uint16_t)
+      LOAD_CTX(4, uint32_t)
+      LOAD_CTX(8, uint64_t)
+      case 16: {
+        void const *Data = reinterpret_cast<void const*>(ContextPtr);
+        memcpy(GDP, Data, Op->Size);
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled LoadContextIndexed size: %d", Op->Size);
+    }
+    #undef LOAD_CTX
+    NEXT_OP();
+  }
+  Op_STORECONTEXT: {
+    auto Op = IROp->C<IR::IROp_StoreContext>();
 
-#define GD *GetDest<uint64_t*>(*WrapperOp)
-#define GDP GetDest<void*>(*WrapperOp)
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += Op->Offset;
 
-  while (1) {
-    using namespace FEXCore::IR;
-    auto BlockIROp = BlockNode->Op(DataBegin)->C<FEXCore::IR::IROp_CodeBlock>();
-    LogMan::Throw::A(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
+    void *Data = reinterpret_cast<void*>(ContextPtr);
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    memcpy(Data, Src, Op->Size);
+    NEXT_OP();
+  }
+  Op_STORECONTEXTINDEXED: {
+    auto Op = IROp->C<IR::IROp_StoreContextIndexed>();
+    uint64_t Index = *GetSrc<uint64_t*>(Current->Args[1]);
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += Op->BaseOffset;
+    ContextPtr += Index * Op->Stride;
+
+    void *Data = reinterpret_cast<void*>(ContextPtr);
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    memcpy(Data, Src, Op->Size);
+    NEXT_OP();
+  }
+  Op_LOADCONTEXTPAIR: {
+    auto Op = IROp->C<IR::IROp_LoadContextPair>();
 
-    // We grab these nodes this way so we can iterate easily
-    auto CodeBegin = CurrentIR->at(BlockIROp->Begin);
-    auto CodeLast = CurrentIR->at(BlockIROp->Last);
-    struct {
-      bool Quit;
-      bool Redo;
-    } BlockResults{};
-
-    auto HandleBlock = [&]() {
-      while (1) {
-        OrderedNodeWrapper *WrapperOp = CodeBegin();
-        OrderedNode *RealNode = WrapperOp->GetNode(ListBegin);
-        FEXCore::IR::IROp_Header *IROp = RealNode->Op(DataBegin);
-        uint8_t OpSize = IROp->Size;
-        uint32_t Node = WrapperOp->ID();
-
-        if (IROp->HasDest) {
-          uint64_t AllocSize = OpSize * std::max(static_cast<uint8_t>(1), IROp->Elements);
-          DestMap[Node] = AllocateTmpSpace(AllocSize);
-          // Clear any previous results
-          memset(GDP, 0, 16);
-        }
-
-        switch (IROp->Op) {
-          case IR::OP_DUMMY:
-          case IR::OP_BEGINBLOCK:
-            break;
-          case IR::OP_ENDBLOCK: {
-            auto Op = IROp->C<IR::IROp_EndBlock>();
-            Thread->State.State.rip += Op->RIPIncrement;
-            break;
-          }
-          case IR::OP_EXITFUNCTION:
-            BlockResults.Quit = true;
-            return;
-            break;
-          case IR::OP_CONDJUMP: {
-            auto Op = IROp->C<IR::IROp_CondJump>();
-            uint64_t Arg = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            if (!!Arg) {
-              BlockNode = Op->Header.Args[1].GetNode(ListBegin);
-            }
-            else  {
-              BlockNode = Op->Header.Args[2].GetNode(ListBegin);
-            }
-            BlockResults.Redo = true;
-            return;
-            break;
-          }
-          case IR::OP_JUMP: {
-            auto Op = IROp->C<IR::IROp_Jump>();
-            BlockNode = Op->Header.Args[0].GetNode(ListBegin);
-            BlockResults.Redo = true;
-            return;
-            break;
-          }
-          case IR::OP_BREAK: {
-            auto Op = IROp->C<IR::IROp_Break>();
-            switch (Op->Reason) {
-              case 4: // HLT
-                Thread->State.RunningEvents.ShouldStop = true;
-                BlockResults.Quit = true;
-                return;
-              break;
-            default: LogMan::Msg::A("Unknown Break Reason: %d", Op->Reason); break;
-            }
-            break;
-          }
-          case IR::OP_SYSCALL: {
-            auto Op = IROp->C<IR::IROp_Syscall>();
-
-            FEXCore::HLE::SyscallArguments Args;
-            for (size_t j = 0; j < FEXCore::HLE::SyscallArguments::MAX_ARGS; ++j) {
-              if (Op->Header.Args[j].IsInvalid()) break;
-              Args.Argument[j] = *GetSrc<uint64_t*>(Op->Header.Args[j]);
-            }
-
-            uint64_t Res = FEXCore::HandleSyscall(CTX->SyscallHandler, Thread, &Args);
-            GD = Res;
-            break;
-          }
-          case IR::OP_CPUID: {
-            auto Op = IROp->C<IR::IROp_CPUID>();
-            uint64_t *DstPtr = GetDest<uint64_t*>(*WrapperOp);
-            uint64_t Arg = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-
-            auto Results = CTX->CPUID.RunFunction(Arg);
-            memcpy(DstPtr, &Results.Res, sizeof(uint32_t) * 4);
-            break;
-          }
-          case IR::OP_PRINT: {
-            auto Op = IROp->C<IR::IROp_Print>();
-
-            if (OpSize <= 8) {
-              uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-              LogMan::Msg::I(">>>> Value in Arg: 0x%lx, %ld", Src, Src);
-            }
-            else if (OpSize == 16) {
-              __uint128_t Src = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-              uint64_t Src0 = Src;
-              uint64_t Src1 = Src >> 64;
-              LogMan::Msg::I(">>>> Value[0] in Arg: 0x%lx, %ld", Src0, Src0);
-              LogMan::Msg::I("     Value[1] in Arg: 0x%lx, %ld", Src1, Src1);
-            }
-            else
-              LogMan::Msg::A("Unknown value size: %d", OpSize);
-            break;
-          }
-          case IR::OP_CYCLECOUNTER: {
-            #ifdef DEBUG_CYCLES
-              GD = 0;
-            #else
-              timespec time;
-              clock_gettime(CLOCK_REALTIME, &time);
-              GD = time.tv_nsec + time.tv_sec * 1000000000;
-            #endif
-            break;
-          }
-          case IR::OP_MOV: {
-            auto Op = IROp->C<IR::IROp_Mov>();
-            memcpy(GDP, GetSrc<void*>(Op->Header.Args[0]), OpSize);
-            break;
-          }
-          case IR::OP_VBITCAST: {
-            auto Op = IROp->C<IR::IROp_VBitcast>();
-            memcpy(GDP, GetSrc<void*>(Op->Header.Args[0]), 16);
-            break;
-          }
-          case IR::OP_VCASTFROMGPR: {
-            auto Op = IROp->C<IR::IROp_VCastFromGPR>();
-            memcpy(GDP, GetSrc<void*>(Op->Header.Args[0]), Op->ElementSize);
-            break;
-          }
-          case IR::OP_VEXTRACTTOGPR: {
-            auto Op = IROp->C<IR::IROp_VExtractToGPR>();
-            LogMan::Throw::A(Op->RegisterSize <= 16, "OpSize is too large for VExtractToGPR: %d", OpSize);
-            if (Op->RegisterSize == 16) {
-              __uint128_t SourceMask = (1ULL << (Op->ElementSize * 8)) - 1;
-              uint64_t Shift = Op->ElementSize * Op->Idx * 8;
-              if (Op->ElementSize == 8)
-                SourceMask = ~0ULL;
-
-              __uint128_t Src = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-              Src >>= Shift;
-              Src &= SourceMask;
-              memcpy(GDP, &Src, Op->ElementSize);
-            }
-            else {
-              uint64_t SourceMask = (1ULL << (Op->ElementSize * 8)) - 1;
-              uint64_t Shift = Op->ElementSize * Op->Idx * 8;
-              if (Op->ElementSize == 8)
-                SourceMask = ~0ULL;
-
-              uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-              Src >>= Shift;
-              Src &= SourceMask;
-              GD = Src;
-            }
-            break;
-          }
-          case IR::OP_VEXTRACTELEMENT: {
-            auto Op = IROp->C<IR::IROp_VExtractElement>();
-            LogMan::Throw::A(Op->RegisterSize <= 16, "OpSize is too large for VExtractToGPR: %d", OpSize);
-            if (Op->RegisterSize == 16) {
-              __uint128_t SourceMask = (1ULL << (Op->ElementSize * 8)) - 1;
-              uint64_t Shift = Op->ElementSize * Op->Index * 8;
-              if (Op->ElementSize == 8)
-                SourceMask = ~0ULL;
-
-              __uint128_t Src = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-              Src >>= Shift;
-              Src &= SourceMask;
-              memcpy(GDP, &Src, Op->ElementSize);
-            }
-            else {
-              uint64_t SourceMask = (1ULL << (Op->ElementSize * 8)) - 1;
-              uint64_t Shift = Op->ElementSize * Op->Index * 8;
-              if (Op->ElementSize == 8)
-                SourceMask = ~0ULL;
-
-              uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-              Src >>= Shift;
-              Src &= SourceMask;
-              GD = Src;
-            }
-            break;
-          }
-          case IR::OP_CONSTANT: {
-            auto Op = IROp->C<IR::IROp_Constant>();
-            GD = Op->Constant;
-            break;
-          }
-          case IR::OP_LOADCONTEXT: {
-            auto Op = IROp->C<IR::IROp_LoadContext>();
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += Op->Offset;
-            #define LOAD_CTX(x, y) \
-              case x: { \
-                y const *Data = reinterpret_cast<y const*>(ContextPtr); \
-                GD = *Data; \
-                break; \
-              }
-            switch (Op->Size) {
-              LOAD_CTX(1, uint8_t)
-              LOAD_CTX(2, uint16_t)
-              LOAD_CTX(4, uint32_t)
-              LOAD_CTX(8, uint64_t)
-              case 16: {
-                void const *Data = reinterpret_cast<void const*>(ContextPtr);
-                memcpy(GDP, Data, Op->Size);
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled LoadContext size: %d", Op->Size);
-            }
-            #undef LOAD_CTX
-            break;
-          }
-          case IR::OP_LOADCONTEXTINDEXED: {
-            auto Op = IROp->C<IR::IROp_LoadContextIndexed>();
-            uint64_t Index = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += Op->BaseOffset;
-            ContextPtr += Index * Op->Stride;
-
-            #define LOAD_CTX(x, y) \
-              case x: { \
-                y const *Data = reinterpret_cast<y const*>(ContextPtr); \
-                GD = *Data; \
-                break; \
-              }
-            switch (Op->Size) {
-              LOAD_CTX(1, uint8_t)
-              LOAD_CTX(2, uint16_t)
-              LOAD_CTX(4, uint32_t)
-              LOAD_CTX(8, uint64_t)
-              case 16: {
-                void const *Data = reinterpret_cast<void const*>(ContextPtr);
-                memcpy(GDP, Data, Op->Size);
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled LoadContextIndexed size: %d", Op->Size);
-            }
-            #undef LOAD_CTX
-            break;
-          }
-          case IR::OP_STORECONTEXT: {
-            auto Op = IROp->C<IR::IROp_StoreContext>();
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += Op->Offset;
-
-            void *Data = reinterpret_cast<void*>(ContextPtr);
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            memcpy(Data, Src, Op->Size);
-            break;
-          }
-          case IR::OP_STORECONTEXTINDEXED: {
-            auto Op = IROp->C<IR::IROp_StoreContextIndexed>();
-            uint64_t Index = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += Op->BaseOffset;
-            ContextPtr += Index * Op->Stride;
-
-            void *Data = reinterpret_cast<void*>(ContextPtr);
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            memcpy(Data, Src, Op->Size);
-            break;
-          }
-          case IR::OP_LOADCONTEXTPAIR: {
-            auto Op = IROp->C<IR::IROp_LoadContextPair>();
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += Op->Offset;
-
-            void *Data = reinterpret_cast<void*>(ContextPtr);
-            memcpy(GDP, Data, Op->Size * 2);
-            break;
-          }
-          case IR::OP_STORECONTEXTPAIR: {
-            auto Op = IROp->C<IR::IROp_StoreContextPair>();
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += Op->Offset;
-
-            void *Data = reinterpret_cast<void*>(ContextPtr);
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            memcpy(Data, Src, Op->Size * 2);
-            break;
-          }
-          case IR::OP_CREATEELEMENTPAIR: {
-            auto Op = IROp->C<IR::IROp_CreateElementPair>();
-            void *Src_Lower = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src_Upper = GetSrc<void*>(Op->Header.Args[1]);
-
-            memcpy(GDP, Src_Lower, Op->Header.Size);
-            memcpy(reinterpret_cast<void*>(reinterpret_cast<uint64_t>(GDP) + Op->Header.Size),
-              Src_Upper, Op->Header.Size);
-            break;
-          }
-          case IR::OP_EXTRACTELEMENTPAIR: {
-            auto Op = IROp->C<IR::IROp_ExtractElementPair>();
-            uintptr_t Src = GetSrc<uintptr_t>(Op->Header.Args[0]);
-            memcpy(GDP,
-              reinterpret_cast<void*>(Src + Op->Header.Size * Op->Element), Op->Header.Size);
-            break;
-          }
-          case IR::OP_CASPAIR: {
-            auto Op = IROp->C<IR::IROp_CASPair>();
-            auto Size = OpSize;
-            // Size is the size of each pair element
-            switch (Size) {
-              case 4: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = GetSrc<std::atomic<uint64_t> *>(Op->Header.Args[2]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[2]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[2]));
-                }
-
-                uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-                uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-                uint64_t Expected = Src1;
-                bool Result = Data->compare_exchange_strong(Expected, Src2);
-                GD = Result ? Src1 : Expected;
-                break;
-              }
-              case 8: {
-                std::atomic<__uint128_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = GetSrc<std::atomic<__uint128_t> *>(Op->Header.Args[2]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<__uint128_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[2]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[2]));
-                }
-
-                __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-                __uint128_t Src2 = *GetSrc<__uint128_t*>(Op->Header.Args[1]);
-
-                __uint128_t Expected = Src1;
-                bool Result = Data->compare_exchange_strong(Expected, Src2);
-                memcpy(GDP, Result ? &Src1 : &Expected, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown CAS size: %d", Size); break;
-            }
-            break;
-          }
-          case IR::OP_TRUNCELEMENTPAIR: {
-            auto Op = IROp->C<IR::IROp_TruncElementPair>();
-
-            switch (Op->Size) {
-              case 4: {
-                uint64_t *Src = GetSrc<uint64_t*>(Op->Header.Args[0]);
-                uint64_t Result{};
-                Result = Src[0] & ~0U;
-                Result |= Src[1] << 32;
-                GD = Result;
-                break;
-              }
-              default: LogMan::Msg::A("Unhandled Truncation size: %d", Op->Size); break;
-            }
-            break;
-          }
-          case IR::OP_LOADFLAG: {
-            auto Op = IROp->C<IR::IROp_LoadFlag>();
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += offsetof(FEXCore::Core::CPUState, flags[0]);
-            ContextPtr += Op->Flag;
-            uint8_t const *Data = reinterpret_cast<uint8_t const*>(ContextPtr);
-            GD = *Data;
-            break;
-          }
-          case IR::OP_STOREFLAG: {
-            auto Op = IROp->C<IR::IROp_StoreFlag>();
-            uint8_t Arg = *GetSrc<uint8_t*>(Op->Header.Args[0]) & 1;
-
-            uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
-            ContextPtr += offsetof(FEXCore::Core::CPUState, flags[0]);
-            ContextPtr += Op->Flag;
-            uint8_t *Data = reinterpret_cast<uint8_t*>(ContextPtr);
-            *Data = Arg;
-            break;
-          }
-          case IR::OP_LOADMEM: {
-            auto Op = IROp->C<IR::IROp_LoadMem>();
-            void const *Data{};
-            if (Thread->CTX->Config.UnifiedMemory) {
-              Data = *GetSrc<void const**>(Op->Header.Args[0]);
-            }
-            else {
-              Data = Thread->CTX->MemoryMapper.GetPointer<void const*>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-              LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-            }
-            memcpy(GDP, Data, OpSize);
-            break;
-          }
-          case IR::OP_STOREMEM: {
-            #define STORE_DATA(x, y) \
-              case x: { \
-                y *Data{}; \
-                if (Thread->CTX->Config.UnifiedMemory) { \
-                  Data = *GetSrc<y**>(Op->Header.Args[0]); \
-                } \
-                else { \
-                  Data = Thread->CTX->MemoryMapper.GetPointer<y*>(*GetSrc<uint64_t*>(Op->Header.Args[0])); \
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0])); \
-                } \
-                memcpy(Data, GetSrc<y*>(Op->Header.Args[1]), sizeof(y)); \
-                break; \
-              }
-
-            auto Op = IROp->C<IR::IROp_StoreMem>();
-
-            switch (Op->Size) {
-              STORE_DATA(1, uint8_t)
-              STORE_DATA(2, uint16_t)
-              STORE_DATA(4, uint32_t)
-              STORE_DATA(8, uint64_t)
-              case 16: {
-                void *Data{};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<void**>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<void*>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-
-                void *Src = GetSrc<void*>(Op->Header.Args[1]);
-                memcpy(Data, Src, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unhandled StoreMem size"); break;
-            }
-            #undef STORE_DATA
-            break;
-          }
-          #define DO_OP(size, type, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(GDP);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            *Dst_d = func(*Src1_d, *Src2_d);          \
-            break;                                            \
-            }
-
-          case IR::OP_ADD: {
-            auto Op = IROp->C<IR::IROp_Add>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            auto Func = [](auto a, auto b) { return a + b; };
-
-            switch (OpSize) {
-              DO_OP(1, uint8_t,  Func)
-              DO_OP(2, uint16_t, Func)
-              DO_OP(4, uint32_t, Func)
-              DO_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_SUB: {
-            auto Op = IROp->C<IR::IROp_Sub>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            auto Func = [](auto a, auto b) { return a - b; };
-
-            switch (OpSize) {
-              DO_OP(1, uint8_t,  Func)
-              DO_OP(2, uint16_t, Func)
-              DO_OP(4, uint32_t, Func)
-              DO_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_NEG: {
-            auto Op = IROp->C<IR::IROp_Neg>();
-            uint64_t Src = *GetSrc<int64_t*>(Op->Header.Args[0]);
-            switch (OpSize) {
-              case 1:
-                GD = -static_cast<int8_t>(Src);
-                break;
-              case 2:
-                GD = -static_cast<int16_t>(Src);
-                break;
-              case 4:
-                GD = -static_cast<int32_t>(Src);
-                break;
-              case 8:
-                GD = -static_cast<int64_t>(Src);
-                break;
-              default: LogMan::Msg::A("Unknown NEG Size: %d\n", OpSize); break;
-            };
-            break;
-          }
-          case IR::OP_OR: {
-            auto Op = IROp->C<IR::IROp_Or>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            auto Func = [](auto a, auto b) { return a | b; };
-
-            switch (OpSize) {
-              DO_OP(1, uint8_t,  Func)
-              DO_OP(2, uint16_t, Func)
-              DO_OP(4, uint32_t, Func)
-              DO_OP(8, uint64_t, Func)
-              DO_OP(16, __uint128_t, Func)
-              default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_AND: {
-            auto Op = IROp->C<IR::IROp_And>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            auto Func = [](auto a, auto b) { return a & b; };
-
-            switch (OpSize) {
-              DO_OP(1, uint8_t,  Func)
-              DO_OP(2, uint16_t, Func)
-              DO_OP(4, uint32_t, Func)
-              DO_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_XOR: {
-            auto Op = IROp->C<IR::IROp_Xor>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            auto Func = [](auto a, auto b) { return a ^ b; };
-
-            switch (OpSize) {
-              DO_OP(1, uint8_t,  Func)
-              DO_OP(2, uint16_t, Func)
-              DO_OP(4, uint32_t, Func)
-              DO_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_LSHL: {
-            auto Op = IROp->C<IR::IROp_Lshl>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-            uint8_t Mask = OpSize * 8 - 1;
-            GD = Src1 << (Src2 & Mask);
-            break;
-          }
-          case IR::OP_LSHR: {
-            auto Op = IROp->C<IR::IROp_Lshr>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-            uint8_t Mask = OpSize * 8 - 1;
-            GD = Src1 >> (Src2 & Mask);
-            break;
-          }
-          case IR::OP_ASHR: {
-            auto Op = IROp->C<IR::IROp_Ashr>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-            uint8_t Mask = OpSize * 8 - 1;
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<int8_t>(Src1) >> (Src2 & Mask);
-                break;
-              case 2:
-                GD = static_cast<int16_t>(Src1) >> (Src2 & Mask);
-                break;
-              case 4:
-                GD = static_cast<int32_t>(Src1) >> (Src2 & Mask);
-                break;
-              case 8:
-                GD = static_cast<int64_t>(Src1) >> (Src2 & Mask);
-                break;
-              default: LogMan::Msg::A("Unknown ASHR Size: %d\n", OpSize); break;
-            };
-            break;
-          }
-          case IR::OP_ROR: {
-            auto Op = IROp->C<IR::IROp_Ror>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-            auto Ror = [] (auto In, auto R) {
-            auto RotateMask = sizeof(In) * 8 - 1;
-              R &= RotateMask;
-              return (In >> R) | (In << (sizeof(In) * 8 - R));
-            };
-
-            switch (OpSize) {
-              case 1:
-                GD = Ror(static_cast<uint8_t>(Src1), static_cast<uint8_t>(Src2));
-                break;
-              case 2:
-                GD = Ror(static_cast<uint16_t>(Src1), static_cast<uint16_t>(Src2));
-                break;
-              case 4:
-                GD = Ror(static_cast<uint32_t>(Src1), static_cast<uint32_t>(Src2));
-                break;
-              case 8: {
-                GD = Ror(static_cast<uint64_t>(Src1), static_cast<uint64_t>(Src2));
-                break;
-              }
-              default: LogMan::Msg::A("Unknown ROR Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_ROL: {
-            auto Op = IROp->C<IR::IROp_Rol>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-            auto Rol = [] (auto In, auto R) {
-            auto RotateMask = sizeof(In) * 8 - 1;
-              R &= RotateMask;
-              return (In << R) | (In >> (sizeof(In) * 8 - R));
-            };
-
-            switch (OpSize) {
-            case 1:
-              GD = Rol(static_cast<uint8_t>(Src1), static_cast<uint8_t>(Src2));
-              break;
-            case 2:
-              GD = Rol(static_cast<uint16_t>(Src1), static_cast<uint16_t>(Src2));
-              break;
-            case 4:
-              GD = Rol(static_cast<uint32_t>(Src1), static_cast<uint32_t>(Src2));
-              break;
-            case 8: {
-              GD = Rol(static_cast<uint64_t>(Src1), static_cast<uint64_t>(Src2));
-              break;
-            }
-            default: LogMan::Msg::A("Unknown ROL Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_NOT: {
-            auto Op = IROp->C<IR::IROp_Not>();
-            uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint8_t Mask = OpSize * 8 - 1;
-            GD = (~Src) & Mask;
-            break;
-          }
-          case IR::OP_ZEXT: {
-            auto Op = IROp->C<IR::IROp_Zext>();
-            LogMan::Throw::A(Op->SrcSize <= 64, "Can't support Zext of size: %ld", Op->SrcSize);
-            uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            if (Op->SrcSize == 64) {
-              // Zext 64bit to 128bit
-              __uint128_t SrcLarge = Src;
-              memcpy(GDP, &SrcLarge, 16);
-            }
-            else {
-              GD = Src & ((1ULL << Op->SrcSize) - 1);
-            }
-            break;
-          }
-          case IR::OP_SEXT: {
-            auto Op = IROp->C<IR::IROp_Sext>();
-            LogMan::Throw::A(Op->SrcSize <= 64, "Can't support Zext of size: %ld", Op->SrcSize);
-            switch (Op->SrcSize / 8) {
-              case 1:
-                GD = *GetSrc<int8_t*>(Op->Header.Args[0]);
-                break;
-              case 2:
-                GD = *GetSrc<int16_t*>(Op->Header.Args[0]);
-                break;
-              case 4:
-                GD = *GetSrc<int32_t*>(Op->Header.Args[0]);
-                break;
-              case 8:
-                GD = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-                break;
-              default: LogMan::Msg::A("Unknown Sext size: %d", Op->SrcSize / 8);
-            }
-            break;
-          }
-          case IR::OP_MUL: {
-            auto Op = IROp->C<IR::IROp_Mul>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<int64_t>(static_cast<int8_t>(Src1)) * static_cast<int64_t>(static_cast<int8_t>(Src2));
-                break;
-              case 2:
-                GD = static_cast<int64_t>(static_cast<int16_t>(Src1)) * static_cast<int64_t>(static_cast<int16_t>(Src2));
-                break;
-              case 4:
-                GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) * static_cast<int64_t>(static_cast<int32_t>(Src2));
-                break;
-              case 8:
-                GD = static_cast<int64_t>(Src1) * static_cast<int64_t>(Src2);
-                break;
-              case 16: {
-                __int128_t Tmp = static_cast<__int128_t>(static_cast<int64_t>(Src1)) * static_cast<__int128_t>(static_cast<int64_t>(Src2));
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_MULH: {
-            auto Op = IROp->C<IR::IROp_MulH>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1: {
-                int64_t Tmp = static_cast<int64_t>(static_cast<int8_t>(Src1)) * static_cast<int64_t>(static_cast<int8_t>(Src2));
-                GD = Tmp >> 8;
-                break;
-              }
-              case 2: {
-                int64_t Tmp = static_cast<int64_t>(static_cast<int16_t>(Src1)) * static_cast<int64_t>(static_cast<int16_t>(Src2));
-                GD = Tmp >> 16;
-                break;
-              }
-              case 4: {
-                int64_t Tmp = static_cast<int64_t>(static_cast<int32_t>(Src1)) * static_cast<int64_t>(static_cast<int32_t>(Src2));
-                GD = Tmp >> 32;
-                break;
-              }
-              case 8: {
-                __int128_t Tmp = static_cast<__int128_t>(static_cast<int64_t>(Src1)) * static_cast<__int128_t>(static_cast<int64_t>(Src2));
-                GD = Tmp >> 64;
-              }
-              break;
-              default: LogMan::Msg::A("Unknown MulH Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_UMUL: {
-            auto Op = IROp->C<IR::IROp_UMul>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<uint8_t>(Src1) * static_cast<uint8_t>(Src2);
-                break;
-              case 2:
-                GD = static_cast<uint16_t>(Src1) * static_cast<uint16_t>(Src2);
-                break;
-              case 4:
-                GD = static_cast<uint32_t>(Src1) * static_cast<uint32_t>(Src2);
-                break;
-              case 8:
-                GD = static_cast<uint64_t>(Src1) * static_cast<uint64_t>(Src2);
-                break;
-              case 16: {
-                __uint128_t Tmp = static_cast<__uint128_t>(static_cast<uint64_t>(Src1)) * static_cast<__uint128_t>(static_cast<uint64_t>(Src2));
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown UMul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_UMULH: {
-            auto Op = IROp->C<IR::IROp_UMulH>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<uint16_t>(Src1) * static_cast<uint16_t>(Src2);
-                GD >>= 8;
-                break;
-              case 2:
-                GD = static_cast<uint32_t>(Src1) * static_cast<uint32_t>(Src2);
-                GD >>= 16;
-                break;
-              case 4:
-                GD = static_cast<uint64_t>(Src1) * static_cast<uint64_t>(Src2);
-                GD >>= 32;
-                break;
-              case 8: {
-                __uint128_t Tmp = static_cast<__uint128_t>(Src1) * static_cast<__uint128_t>(Src2);
-                GD = Tmp >> 64;
-                break;
-              }
-              case 16: {
-                // XXX: This is incorrect
-                __uint128_t Tmp = static_cast<__uint128_t>(Src1) * static_cast<__uint128_t>(Src2);
-                GD = Tmp >> 64;
-                break;
-              }
-              default: LogMan::Msg::A("Unknown UMulH Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_DIV: {
-            auto Op = IROp->C<IR::IROp_Div>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<int64_t>(static_cast<int8_t>(Src1)) / static_cast<int64_t>(static_cast<int8_t>(Src2));
-                break;
-              case 2:
-                GD = static_cast<int64_t>(static_cast<int16_t>(Src1)) / static_cast<int64_t>(static_cast<int16_t>(Src2));
-                break;
-              case 4:
-                GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) / static_cast<int64_t>(static_cast<int32_t>(Src2));
-                break;
-              case 8:
-                GD = static_cast<int64_t>(Src1) / static_cast<int64_t>(Src2);
-                break;
-              case 16: {
-                __int128_t Tmp = *GetSrc<__int128_t*>(Op->Header.Args[0]) / *GetSrc<__int128_t*>(Op->Header.Args[1]);
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_UDIV: {
-            auto Op = IROp->C<IR::IROp_UDiv>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<uint64_t>(static_cast<uint8_t>(Src1)) / static_cast<uint64_t>(static_cast<uint8_t>(Src2));
-                break;
-              case 2:
-                GD = static_cast<uint64_t>(static_cast<uint16_t>(Src1)) / static_cast<uint64_t>(static_cast<uint16_t>(Src2));
-                break;
-              case 4:
-                GD = static_cast<uint64_t>(static_cast<uint32_t>(Src1)) / static_cast<uint64_t>(static_cast<uint32_t>(Src2));
-                break;
-              case 8:
-                GD = static_cast<uint64_t>(Src1) / static_cast<uint64_t>(Src2);
-                break;
-              case 16: {
-                __uint128_t Tmp = *GetSrc<__uint128_t*>(Op->Header.Args[0]) / *GetSrc<__uint128_t*>(Op->Header.Args[1]);
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_REM: {
-            auto Op = IROp->C<IR::IROp_Rem>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<int64_t>(static_cast<int8_t>(Src1)) % static_cast<int64_t>(static_cast<int8_t>(Src2));
-                break;
-              case 2:
-                GD = static_cast<int64_t>(static_cast<int16_t>(Src1)) % static_cast<int64_t>(static_cast<int16_t>(Src2));
-                break;
-              case 4:
-                GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) % static_cast<int64_t>(static_cast<int32_t>(Src2));
-                break;
-              case 8:
-                GD = static_cast<int64_t>(Src1) % static_cast<int64_t>(Src2);
-                break;
-              case 16: {
-                __int128_t Tmp = *GetSrc<__int128_t*>(Op->Header.Args[0]) % *GetSrc<__int128_t*>(Op->Header.Args[1]);
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_UREM: {
-            auto Op = IROp->C<IR::IROp_URem>();
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            switch (OpSize) {
-              case 1:
-                GD = static_cast<uint64_t>(static_cast<uint8_t>(Src1)) % static_cast<uint64_t>(static_cast<uint8_t>(Src2));
-                break;
-              case 2:
-                GD = static_cast<uint64_t>(static_cast<uint16_t>(Src1)) % static_cast<uint64_t>(static_cast<uint16_t>(Src2));
-                break;
-              case 4:
-                GD = static_cast<uint64_t>(static_cast<uint32_t>(Src1)) % static_cast<uint64_t>(static_cast<uint32_t>(Src2));
-                break;
-              case 8:
-                GD = static_cast<uint64_t>(Src1) % static_cast<uint64_t>(Src2);
-                break;
-              case 16: {
-                __uint128_t Tmp = *GetSrc<__uint128_t*>(Op->Header.Args[0]) % *GetSrc<__uint128_t*>(Op->Header.Args[1]);
-                memcpy(GDP, &Tmp, 16);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_POPCOUNT: {
-            auto Op = IROp->C<IR::IROp_Popcount>();
-            uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            GD = __builtin_popcountl(Src);
-            break;
-          }
-          case IR::OP_FINDLSB: {
-            auto Op = IROp->C<IR::IROp_FindLSB>();
-            uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Result = __builtin_ffsll(Src);
-            GD = Result - 1;
-            break;
-          }
-          case IR::OP_FINDMSB: {
-            auto Op = IROp->C<IR::IROp_FindMSB>();
-            switch (OpSize) {
-              case 1: GD = ((24 + OpSize * 8) - __builtin_clz(*GetSrc<uint8_t*>(Op->Header.Args[0]))) - 1; break;
-              case 2: GD = ((16 + OpSize * 8) - __builtin_clz(*GetSrc<uint16_t*>(Op->Header.Args[0]))) - 1; break;
-              case 4: GD = (OpSize * 8 - __builtin_clz(*GetSrc<uint32_t*>(Op->Header.Args[0]))) - 1; break;
-              case 8: GD = (OpSize * 8 - __builtin_clzll(*GetSrc<uint64_t*>(Op->Header.Args[0]))) - 1; break;
-              default: LogMan::Msg::A("Unknown REV size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_REV: {
-            auto Op = IROp->C<IR::IROp_Rev>();
-            switch (OpSize) {
-              case 2: GD = __builtin_bswap16(*GetSrc<uint16_t*>(Op->Header.Args[0])); break;
-              case 4: GD = __builtin_bswap32(*GetSrc<uint32_t*>(Op->Header.Args[0])); break;
-              case 8: GD = __builtin_bswap64(*GetSrc<uint64_t*>(Op->Header.Args[0])); break;
-              default: LogMan::Msg::A("Unknown REV size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_FINDTRAILINGZEROS: {
-            auto Op = IROp->C<IR::IROp_FindTrailingZeros>();
-            switch (OpSize) {
-              case 1: {
-                auto Src = *GetSrc<uint8_t*>(Op->Header.Args[0]);
-                if (Src)
-                  GD = __builtin_ctz(Src);
-                else
-                  GD = sizeof(Src) * 8;
-                break;
-              }
-              case 2: {
-                auto Src = *GetSrc<uint16_t*>(Op->Header.Args[0]);
-                if (Src)
-                  GD = __builtin_ctz(Src);
-                else
-                  GD = sizeof(Src) * 8;
-                break;
-              }
-              case 4: {
-                auto Src = *GetSrc<uint32_t*>(Op->Header.Args[0]);
-                if (Src)
-                  GD = __builtin_ctz(Src);
-                else
-                  GD = sizeof(Src) * 8;
-                break;
-              }
-              case 8: {
-                auto Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-                if (Src)
-                  GD = __builtin_ctzll(Src);
-                else
-                  GD = sizeof(Src) * 8;
-                break;
-              }
-              default: LogMan::Msg::A("Unknown size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_BFI: {
-            auto Op = IROp->C<IR::IROp_Bfi>();
-            uint64_t SourceMask = (1ULL << Op->Width) - 1;
-            if (Op->Width == 64)
-              SourceMask = ~0ULL;
-            uint64_t DestMask = ~(SourceMask << Op->lsb);
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-            uint64_t Res = (Src1 & DestMask) | ((Src2 & SourceMask) << Op->lsb);
-            GD = Res;
-            break;
-          }
-          case IR::OP_BFE: {
-            auto Op = IROp->C<IR::IROp_Bfe>();
-            LogMan::Throw::A(OpSize <= 16, "OpSize is too large for BFE: %d", OpSize);
-            if (OpSize == 16) {
-              LogMan::Throw::A(Op->Width <= 64, "Can't extract width of %d", Op->Width);
-              __uint128_t SourceMask = (1ULL << Op->Width) - 1;
-              if (Op->Width == 64)
-                SourceMask = ~0ULL;
-              SourceMask <<= Op->lsb;
-              __uint128_t Src = (*GetSrc<__uint128_t*>(Op->Header.Args[0]) & SourceMask) >> Op->lsb;
-              memcpy(GDP, &Src, OpSize);
-            }
-            else {
-              uint64_t SourceMask = (1ULL << Op->Width) - 1;
-              if (Op->Width == 64)
-                SourceMask = ~0ULL;
-              SourceMask <<= Op->lsb;
-              uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-              GD = (Src & SourceMask) >> Op->lsb;
-            }
-            break;
-          }
-          case IR::OP_SELECT: {
-            auto Op = IROp->C<IR::IROp_Select>();
-            bool CompResult = false;
-            uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-            uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-            uint64_t ArgTrue = *GetSrc<uint64_t*>(Op->Header.Args[2]);
-            uint64_t ArgFalse = *GetSrc<uint64_t*>(Op->Header.Args[3]);
-
-            switch (Op->Cond.Val) {
-              case FEXCore::IR::COND_EQ:
-                CompResult = Src1 == Src2;
-                break;
-              case FEXCore::IR::COND_NEQ:
-                CompResult = Src1 != Src2;
-                break;
-              case FEXCore::IR::COND_SGE:
-                CompResult = static_cast<int64_t>(Src1) >= static_cast<int64_t>(Src2);
-                break;
-              case FEXCore::IR::COND_SLT:
-                CompResult = static_cast<int64_t>(Src1) < static_cast<int64_t>(Src2);
-                break;
-              case FEXCore::IR::COND_SGT:
-                CompResult = static_cast<int64_t>(Src1) > static_cast<int64_t>(Src2);
-                break;
-              case FEXCore::IR::COND_SLE:
-                CompResult = static_cast<int64_t>(Src1) <= static_cast<int64_t>(Src2);
-                break;
-              case FEXCore::IR::COND_UGE:
-                CompResult = Src1 >= Src2;
-                break;
-              case FEXCore::IR::COND_ULT:
-                CompResult = Src1 < Src2;
-                break;
-              case FEXCore::IR::COND_UGT:
-                CompResult = Src1 > Src2;
-                break;
-              case FEXCore::IR::COND_ULE:
-                CompResult = Src1 <= Src2;
-                break;
-              case FEXCore::IR::COND_MI:
-              case FEXCore::IR::COND_PL:
-              case FEXCore::IR::COND_VS:
-              case FEXCore::IR::COND_VC:
-              default:
-                LogMan::Msg::A("Unsupported compare type");
-                break;
-            }
-            GD = CompResult ? ArgTrue : ArgFalse;
-            break;
-          }
-          case IR::OP_CAS: {
-            auto Op = IROp->C<IR::IROp_CAS>();
-            auto Size = OpSize;
-            switch (Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[2]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[2]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[2]));
-                }
-
-                uint8_t Src1 = *GetSrc<uint8_t*>(Op->Header.Args[0]);
-                uint8_t Src2 = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-
-                uint8_t Expected = Src1;
-                bool Result = Data->compare_exchange_strong(Expected, Src2);
-                GD = Result ? Src1 : Expected;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[2]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[2]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[2]));
-                }
-
-                uint16_t Src1 = *GetSrc<uint16_t*>(Op->Header.Args[0]);
-                uint16_t Src2 = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-
-                uint16_t Expected = Src1;
-                bool Result = Data->compare_exchange_strong(Expected, Src2);
-                GD = Result ? Src1 : Expected;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[2]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[2]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[2]));
-                }
-
-                uint32_t Src1 = *GetSrc<uint32_t*>(Op->Header.Args[0]);
-                uint32_t Src2 = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-
-                uint32_t Expected = Src1;
-                bool Result = Data->compare_exchange_strong(Expected, Src2);
-                GD = Result ? Src1 : Expected;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[2]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[2]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[2]));
-                }
-
-                uint64_t Src1 = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-                uint64_t Src2 = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-
-                uint64_t Expected = Src1;
-                bool Result = Data->compare_exchange_strong(Expected, Src2);
-                GD = Result ? Src1 : Expected;
-                break;
-              }
-              default: LogMan::Msg::A("Unknown CAS size: %d", Size); break;
-            }
-            break;
-          }
-          case IR::OP_ATOMICADD: {
-            auto Op = IROp->C<IR::IROp_AtomicAdd>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                *Data += Src;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint16_t*>(Op->Header.Args[0]));
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                *Data += Src;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                *Data += Src;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                *Data += Src;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICSUB: {
-            auto Op = IROp->C<IR::IROp_AtomicSub>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                *Data -= Src;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                *Data -= Src;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                *Data -= Src;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                *Data -= Src;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICAND: {
-            auto Op = IROp->C<IR::IROp_AtomicAnd>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                *Data &= Src;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                *Data &= Src;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                *Data &= Src;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                *Data &= Src;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICOR: {
-            auto Op = IROp->C<IR::IROp_AtomicOr>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint8_t*>(Op->Header.Args[0]));
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                *Data |= Src;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint16_t*>(Op->Header.Args[0]));
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                *Data |= Src;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                *Data |= Src;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                *Data |= Src;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICXOR: {
-            auto Op = IROp->C<IR::IROp_AtomicXor>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                *Data ^= Src;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint16_t*>(Op->Header.Args[0]));
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                *Data ^= Src;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                *Data ^= Src;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                *Data ^= Src;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICSWAP: {
-            auto Op = IROp->C<IR::IROp_AtomicSwap>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                uint8_t Previous = Data->exchange(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                uint16_t Previous = Data->exchange(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                uint32_t Previous = Data->exchange(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                uint64_t Previous = Data->exchange(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICFETCHADD: {
-            auto Op = IROp->C<IR::IROp_AtomicFetchAdd>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                uint8_t Previous = Data->fetch_add(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                uint16_t Previous = Data->fetch_add(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                uint32_t Previous = Data->fetch_add(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                uint64_t Previous = Data->fetch_add(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICFETCHSUB: {
-            auto Op = IROp->C<IR::IROp_AtomicFetchSub>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                uint8_t Previous = Data->fetch_sub(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                uint16_t Previous = Data->fetch_sub(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                uint32_t Previous = Data->fetch_sub(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                uint64_t Previous = Data->fetch_sub(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICFETCHAND: {
-            auto Op = IROp->C<IR::IROp_AtomicFetchAnd>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                uint8_t Previous = Data->fetch_and(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                uint16_t Previous = Data->fetch_and(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                uint32_t Previous = Data->fetch_and(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                uint64_t Previous = Data->fetch_and(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICFETCHOR: {
-            auto Op = IROp->C<IR::IROp_AtomicFetchOr>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                uint8_t Previous = Data->fetch_or(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                uint16_t Previous = Data->fetch_or(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                uint32_t Previous = Data->fetch_or(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                uint64_t Previous = Data->fetch_or(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          case IR::OP_ATOMICFETCHXOR: {
-            auto Op = IROp->C<IR::IROp_AtomicFetchXor>();
-            switch (Op->Size) {
-              case 1: {
-                std::atomic<uint8_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint8_t Src = *GetSrc<uint8_t*>(Op->Header.Args[1]);
-                uint8_t Previous = Data->fetch_xor(Src);
-                GD = Previous;
-                break;
-              }
-              case 2: {
-                std::atomic<uint16_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint16_t Src = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                uint16_t Previous = Data->fetch_xor(Src);
-                GD = Previous;
-                break;
-              }
-              case 4: {
-                std::atomic<uint32_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint32_t Src = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                uint32_t Previous = Data->fetch_xor(Src);
-                GD = Previous;
-                break;
-              }
-              case 8: {
-                std::atomic<uint64_t> *Data = {};
-                if (Thread->CTX->Config.UnifiedMemory) {
-                  Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
-                }
-                else {
-                  Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Op->Header.Args[0]));
-                  LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Op->Header.Args[0]));
-                }
-                uint64_t Src = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                uint64_t Previous = Data->fetch_xor(Src);
-                GD = Previous;
-                break;
-              }
-              default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
-            }
-            break;
-          }
-          // Vector ops
-          case IR::OP_CREATEVECTOR2: {
-            auto Op = IROp->C<IR::IROp_CreateVector2>();
-            LogMan::Throw::A(OpSize <= 16, "Can't handle a vector of size: %d", OpSize);
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-            uint8_t ElementSize = OpSize / 2;
-            #define CREATE_VECTOR(elementsize, type) \
-              case elementsize: { \
-                auto *Dst_d = reinterpret_cast<type*>(Tmp); \
-                auto *Src1_d = reinterpret_cast<type*>(Src1); \
-                auto *Src2_d = reinterpret_cast<type*>(Src2); \
-                Dst_d[0] = *Src1_d; \
-                Dst_d[1] = *Src2_d; \
-                break; \
-              }
-            switch (ElementSize) {
-              CREATE_VECTOR(1, uint8_t)
-              CREATE_VECTOR(2, uint16_t)
-              CREATE_VECTOR(4, uint32_t)
-              CREATE_VECTOR(8, uint64_t)
-              default: LogMan::Msg::A("Unknown Element Size: %d", ElementSize); break;
-            }
-            #undef CREATE_VECTOR
-            memcpy(GDP, Tmp, OpSize);
-
-            break;
-          }
-          case IR::OP_SPLATVECTOR4:
-          case IR::OP_SPLATVECTOR3:
-          case IR::OP_SPLATVECTOR2: {
-            auto Op = IROp->C<IR::IROp_SplatVector2>();
-            LogMan::Throw::A(OpSize <= 16, "Can't handle a vector of size: %d", OpSize);
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-            uint8_t Elements = 0;
-
-            switch (Op->Header.Op) {
-              case IR::OP_SPLATVECTOR4: Elements = 4; break;
-              case IR::OP_SPLATVECTOR3: Elements = 3; break;
-              case IR::OP_SPLATVECTOR2: Elements = 2; break;
-              default: LogMan::Msg::A("Uknown Splat size"); break;
-            }
-
-            #define CREATE_VECTOR(elementsize, type) \
-              case elementsize: { \
-                auto *Dst_d = reinterpret_cast<type*>(Tmp); \
-                auto *Src_d = reinterpret_cast<type*>(Src); \
-                for (uint8_t i = 0; i < Elements; ++i) \
-                  Dst_d[i] = *Src_d;\
-                break; \
-              }
-            uint8_t ElementSize = OpSize / Elements;
-            switch (ElementSize) {
-              CREATE_VECTOR(1, uint8_t)
-              CREATE_VECTOR(2, uint16_t)
-              CREATE_VECTOR(4, uint32_t)
-              CREATE_VECTOR(8, uint64_t)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.Size); break;
-            }
-            #undef CREATE_VECTOR
-            memcpy(GDP, Tmp, OpSize);
-
-            break;
-          }
-          case IR::OP_VMOV: {
-            auto Op = IROp->C<IR::IROp_VMov>();
-            __uint128_t Src = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-
-            memcpy(GDP, &Src, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VOR: {
-            auto Op = IROp->C<IR::IROp_VOr>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(Op->Header.Args[1]);
-
-            __uint128_t Dst = Src1 | Src2;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          case IR::OP_VAND: {
-            auto Op = IROp->C<IR::IROp_VAnd>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(Op->Header.Args[1]);
-
-            __uint128_t Dst = Src1 & Src2;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          case IR::OP_VXOR: {
-            auto Op = IROp->C<IR::IROp_VXor>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(Op->Header.Args[1]);
-
-            __uint128_t Dst = Src1 ^ Src2;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          case IR::OP_VSLI: {
-            auto Op = IROp->C<IR::IROp_VSLI>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-            __uint128_t Src2 = Op->ByteShift * 8;
-
-            __uint128_t Dst = Op->ByteShift >= sizeof(__uint128_t) ? 0 : Src1 << Src2;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          case IR::OP_VSRI: {
-            auto Op = IROp->C<IR::IROp_VSRI>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-            __uint128_t Src2 = Op->ByteShift * 8;
-
-            __uint128_t Dst = Op->ByteShift >= sizeof(__uint128_t) ? 0 : Src1 >> Src2;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          case IR::OP_VNOT: {
-            auto Op = IROp->C<IR::IROp_VNot>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-
-            __uint128_t Dst = ~Src1;
-            memcpy(GDP, &Dst, 16);
-            break;
-          }
-          #define DO_VECTOR_OP(size, type, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src1_d[i], Src2_d[i]);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_PAIR_OP(size, type, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src1_d[i*2], Src1_d[i*2 + 1]);          \
-              Dst_d[i+Elements] = func(Src2_d[i*2], Src2_d[i*2 + 1]);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_SCALAR_OP(size, type, func)\
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src1_d[i], *Src2_d);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_1SRC_OP(size, type, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src_d = reinterpret_cast<type*>(Src); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src_d[i]);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_SAT_OP(size, type, func, min, max)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src1_d[i], Src2_d[i], min, max);          \
-            }                                                 \
-            break;                                            \
-            }
-
-          case IR::OP_VUSHRI: {
-            auto Op = IROp->C<IR::IROp_VUShrI>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t BitShift = Op->BitShift;
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? 0 : a >> BitShift; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_OP(1, uint8_t, Func)
-              DO_VECTOR_1SRC_OP(2, uint16_t, Func)
-              DO_VECTOR_1SRC_OP(4, uint32_t, Func)
-              DO_VECTOR_1SRC_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSSHRI: {
-            auto Op = IROp->C<IR::IROp_VSShrI>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t BitShift = Op->BitShift;
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> BitShift; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_OP(1, int8_t, Func)
-              DO_VECTOR_1SRC_OP(2, int16_t, Func)
-              DO_VECTOR_1SRC_OP(4, int32_t, Func)
-              DO_VECTOR_1SRC_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSHLI: {
-            auto Op = IROp->C<IR::IROp_VShlI>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t BitShift = Op->BitShift;
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? 0 : (a << BitShift); };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_OP(1, uint8_t, Func)
-              DO_VECTOR_1SRC_OP(2, uint16_t, Func)
-              DO_VECTOR_1SRC_OP(4, uint32_t, Func)
-              DO_VECTOR_1SRC_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-
-          case IR::OP_VADD: {
-            auto Op = IROp->C<IR::IROp_VAdd>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return a + b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSUB: {
-            auto Op = IROp->C<IR::IROp_VSub>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return a - b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUQADD: {
-            auto Op = IROp->C<IR::IROp_VUQAdd>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) {
-              decltype(a) res = a + b;
-              return res < a ? ~0U : res;
-            };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUQSUB: {
-            auto Op = IROp->C<IR::IROp_VUQSub>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) {
-              decltype(a) res = a - b;
-              return res > a ? 0U : res;
-            };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSQADD: {
-            auto Op = IROp->C<IR::IROp_VSQAdd>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) {
-              decltype(a) res = a + b;
-
-              if (a > 0) {
-                if (b > (std::numeric_limits<decltype(a)>::max() - a)) {
-                  return std::numeric_limits<decltype(a)>::max();
-                }
-              }
-              else if (b < (std::numeric_limits<decltype(a)>::min() - a)) {
-                return std::numeric_limits<decltype(a)>::min();
-              }
-
-              return res;
-            };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, int8_t,  Func)
-              DO_VECTOR_OP(2, int16_t, Func)
-              DO_VECTOR_OP(4, int32_t, Func)
-              DO_VECTOR_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSQSUB: {
-            auto Op = IROp->C<IR::IROp_VSQSub>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) {
-              __int128_t res = a - b;
-              if (res < std::numeric_limits<decltype(a)>::min())
-                return std::numeric_limits<decltype(a)>::min();
-
-              if (res > std::numeric_limits<decltype(a)>::max())
-                return std::numeric_limits<decltype(a)>::max();
-              return (decltype(a))res;
-            };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, int8_t,  Func)
-              DO_VECTOR_OP(2, int16_t, Func)
-              DO_VECTOR_OP(4, int32_t, Func)
-              DO_VECTOR_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-
-          case IR::OP_VFADD: {
-            auto Op = IROp->C<IR::IROp_VFAdd>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return a + b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFSUB: {
-            auto Op = IROp->C<IR::IROp_VFSub>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return a - b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VADDP: {
-            auto Op = IROp->C<IR::IROp_VAddP>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return a + b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_PAIR_OP(1, uint8_t,  Func)
-              DO_VECTOR_PAIR_OP(2, uint16_t, Func)
-              DO_VECTOR_PAIR_OP(4, uint32_t, Func)
-              DO_VECTOR_PAIR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFMUL: {
-            auto Op = IROp->C<IR::IROp_VFMul>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFDIV: {
-            auto Op = IROp->C<IR::IROp_VFDiv>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return a / b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFMIN: {
-            auto Op = IROp->C<IR::IROp_VFMin>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return std::min(a, b); };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFMAX: {
-            auto Op = IROp->C<IR::IROp_VFMax>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return std::max(a, b); };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(4, float, Func)
-              DO_VECTOR_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFRECP: {
-            auto Op = IROp->C<IR::IROp_VFRecp>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a) { return 1.0 / a; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_OP(4, float, Func)
-              DO_VECTOR_1SRC_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFSQRT: {
-            auto Op = IROp->C<IR::IROp_VFSqrt>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a) { return std::sqrt(a); };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_OP(4, float, Func)
-              DO_VECTOR_1SRC_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFRSQRT: {
-            auto Op = IROp->C<IR::IROp_VFRSqrt>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a) { return 1.0 / std::sqrt(a); };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_OP(4, float, Func)
-              DO_VECTOR_1SRC_OP(8, double, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          #define DO_VECTOR_1SRC_2TYPE_OP(size, type, type2, func, min, max)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src_d = reinterpret_cast<type2*>(Src); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = (type)func(Src_d[i], min, max);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_1SRC_2TYPE_OP_TOP(size, type, type2, func, min, max)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src_d = reinterpret_cast<type2*>(Src2); \
-            memcpy(Dst_d, Src1, Elements * sizeof(type2));\
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i+Elements] = (type)func(Src_d[i], min, max);          \
-            }                                                 \
-            break;                                            \
-            }
-
-          #define DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(size, type, type2, func, min, max)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src_d = reinterpret_cast<type2*>(Src); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = (type)func(Src_d[i+Elements], min, max);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_2SRC_2TYPE_OP(size, type, type2, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type2*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type2*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = (type)func((type)Src1_d[i], (type)Src2_d[i]);          \
-            }                                                 \
-            break;                                            \
-            }
-          #define DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(size, type, type2, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type2*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type2*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = (type)func((type)Src1_d[i+Elements], (type)Src2_d[i+Elements]);          \
-            }                                                 \
-            break;                                            \
-            }
-
-          case IR::OP_VUSHRNI: {
-            auto Op = IROp->C<IR::IROp_VUShrNI>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t BitShift = Op->BitShift;
-            uint8_t Tmp[16]{};
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [BitShift](auto a, auto min, auto max) { return BitShift >= (sizeof(a) * 8) ? 0 : a >> BitShift; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(2, uint8_t, uint16_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(4, uint16_t, uint32_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(8, uint32_t, uint64_t, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUSHRNI2: {
-            auto Op = IROp->C<IR::IROp_VUShrNI2>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t BitShift = Op->BitShift;
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [BitShift](auto a, auto min, auto max) { return BitShift >= (sizeof(a) * 8) ? 0 : a >> BitShift; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP_TOP(2, uint8_t, uint16_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP_TOP(4, uint16_t, uint32_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP_TOP(8, uint32_t, uint64_t, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSQXTN: {
-            auto Op = IROp->C<IR::IROp_VSQXTN>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16]{};
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))min); };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(2, int8_t, int16_t, Func, std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max())
-              DO_VECTOR_1SRC_2TYPE_OP(4, int16_t, int32_t, Func, std::numeric_limits<int16_t>::min(), std::numeric_limits<int16_t>::max())
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSQXTN2: {
-            auto Op = IROp->C<IR::IROp_VSQXTN2>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16]{};
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))min); };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP_TOP(2, int8_t, int16_t, Func, std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max())
-              DO_VECTOR_1SRC_2TYPE_OP_TOP(4, int16_t, int32_t, Func, std::numeric_limits<int16_t>::min(), std::numeric_limits<int16_t>::max())
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSQXTUN: {
-            auto Op = IROp->C<IR::IROp_VSQXTUN>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16]{};
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))min); };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(2, uint8_t, int16_t, Func, 0, (1 << 8) - 1)
-              DO_VECTOR_1SRC_2TYPE_OP(4, uint16_t, int32_t, Func, 0, (1 << 16) - 1)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSQXTUN2: {
-            auto Op = IROp->C<IR::IROp_VSQXTUN2>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16]{};
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))min); };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP_TOP(2, uint8_t, int16_t, Func, 0, (1 << 8) - 1)
-              DO_VECTOR_1SRC_2TYPE_OP_TOP(4, uint16_t, int32_t, Func, 0, (1 << 16) - 1)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VECTOR_UTOF: {
-            auto Op = IROp->C<IR::IROp_Vector_UToF>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(4, float, uint32_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(8, double, uint64_t, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VECTOR_STOF: {
-            auto Op = IROp->C<IR::IROp_Vector_SToF>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(4, float, int32_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(8, double, int64_t, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VECTOR_FTOZU: {
-            auto Op = IROp->C<IR::IROp_Vector_FToZU>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(4, uint32_t, float, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(8, uint64_t, double, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VECTOR_FTOZS: {
-            auto Op = IROp->C<IR::IROp_Vector_FToZS>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(4, int32_t, float, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(8, int64_t, double, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUMUL: {
-            auto Op = IROp->C<IR::IROp_VUMul>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSMUL: {
-            auto Op = IROp->C<IR::IROp_VSMul>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, int8_t,  Func)
-              DO_VECTOR_OP(2, int16_t, Func)
-              DO_VECTOR_OP(4, int32_t, Func)
-              DO_VECTOR_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUMULL: {
-            auto Op = IROp->C<IR::IROp_VUMull>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / (Op->ElementSize << 1);
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_2SRC_2TYPE_OP(1, uint16_t, uint8_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP(2, uint32_t, uint16_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP(4, uint64_t, uint32_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSMULL: {
-            auto Op = IROp->C<IR::IROp_VSMull>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / (Op->ElementSize << 1);
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_2SRC_2TYPE_OP(1, int16_t, int8_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP(2, int32_t, int16_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP(4, int64_t, int32_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUMULL2: {
-            auto Op = IROp->C<IR::IROp_VUMull2>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / (Op->ElementSize << 1);
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(1, uint16_t, uint8_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(2, uint32_t, uint16_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(4, uint64_t, uint32_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSMULL2: {
-            auto Op = IROp->C<IR::IROp_VSMull2>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / (Op->ElementSize << 1);
-
-            auto Func = [](auto a, auto b) { return a * b; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(1, int16_t, int8_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(2, int32_t, int16_t, Func)
-              DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(4, int64_t, int32_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSXTL: {
-            auto Op = IROp->C<IR::IROp_VSXTL>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16]{};
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(1, int16_t, int8_t, Func,  0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(2, int32_t, int16_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(4, int64_t, int32_t, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSXTL2: {
-            auto Op = IROp->C<IR::IROp_VSXTL2>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / (Op->ElementSize << 1);
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(1, int16_t, int8_t, Func,  0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(2, int32_t, int16_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(4, int64_t, int32_t, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUXTL: {
-            auto Op = IROp->C<IR::IROp_VUXTL>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16]{};
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP(1, uint16_t, uint8_t, Func,  0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(2, uint32_t, uint16_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP(4, uint64_t, uint32_t, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUXTL2: {
-            auto Op = IROp->C<IR::IROp_VUXTL2>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / (Op->ElementSize << 1);
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Op->ElementSize) {
-              DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(1, uint16_t, uint8_t, Func,  0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(2, uint32_t, uint16_t, Func, 0, 0)
-              DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(4, uint64_t, uint32_t, Func, 0, 0)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUMIN: {
-            auto Op = IROp->C<IR::IROp_VUMin>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return std::min(a, b); };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSMIN: {
-            auto Op = IROp->C<IR::IROp_VSMin>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return std::min(a, b); };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, int8_t,  Func)
-              DO_VECTOR_OP(2, int16_t, Func)
-              DO_VECTOR_OP(4, int32_t, Func)
-              DO_VECTOR_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUMAX: {
-            auto Op = IROp->C<IR::IROp_VUMax>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return std::max(a, b); };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSMAX: {
-            auto Op = IROp->C<IR::IROp_VSMax>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return std::max(a, b); };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, int8_t,  Func)
-              DO_VECTOR_OP(2, int16_t, Func)
-              DO_VECTOR_OP(4, int32_t, Func)
-              DO_VECTOR_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUSHL: {
-            auto Op = IROp->C<IR::IROp_VUShl>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a << b; };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSSHR: {
-            auto Op = IROp->C<IR::IROp_VSShr>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> b; };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, int8_t,  Func)
-              DO_VECTOR_OP(2, int16_t, Func)
-              DO_VECTOR_OP(4, int32_t, Func)
-              DO_VECTOR_OP(8, int64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-
-          case IR::OP_VUSHLS: {
-            auto Op = IROp->C<IR::IROp_VUShlS>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a << b; };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_SCALAR_OP(1, uint8_t, Func)
-              DO_VECTOR_SCALAR_OP(2, uint16_t, Func)
-              DO_VECTOR_SCALAR_OP(4, uint32_t, Func)
-              DO_VECTOR_SCALAR_OP(8, uint64_t, Func)
-              DO_VECTOR_SCALAR_OP(16, __uint128_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUSHRS: {
-            auto Op = IROp->C<IR::IROp_VUShrS>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a >> b; };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_SCALAR_OP(1, uint8_t, Func)
-              DO_VECTOR_SCALAR_OP(2, uint16_t, Func)
-              DO_VECTOR_SCALAR_OP(4, uint32_t, Func)
-              DO_VECTOR_SCALAR_OP(8, uint64_t, Func)
-              DO_VECTOR_SCALAR_OP(16, __uint128_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VSSHRS: {
-            auto Op = IROp->C<IR::IROp_VSShrS>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> b; };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_SCALAR_OP(1, int8_t, Func)
-              DO_VECTOR_SCALAR_OP(2, int16_t, Func)
-              DO_VECTOR_SCALAR_OP(4, int32_t, Func)
-              DO_VECTOR_SCALAR_OP(8, int64_t, Func)
-              DO_VECTOR_SCALAR_OP(16, __int128_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VUSHR: {
-            auto Op = IROp->C<IR::IROp_VUShr>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a >> b; };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,  Func)
-              DO_VECTOR_OP(2, uint16_t, Func)
-              DO_VECTOR_OP(4, uint32_t, Func)
-              DO_VECTOR_OP(8, uint64_t, Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VZIP2:
-          case IR::OP_VZIP: {
-            auto Op = IROp->C<IR::IROp_VZip>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            uint8_t BaseOffset = IROp->Op == IR::OP_VZIP2 ? (Elements / 2) : 0;
-            Elements >>= 1;
-
-            switch (Op->ElementSize) {
-              case 1: {
-                auto *Dst_d  = reinterpret_cast<uint8_t*>(Tmp);
-                auto *Src1_d = reinterpret_cast<uint8_t*>(Src1);
-                auto *Src2_d = reinterpret_cast<uint8_t*>(Src2);
-                for (unsigned i = 0; i < Elements; ++i) {
-                  Dst_d[i*2] = Src1_d[BaseOffset + i];
-                  Dst_d[i*2+1] = Src2_d[BaseOffset + i];
-                }
-                break;
-              }
-              case 2: {
-                auto *Dst_d  = reinterpret_cast<uint16_t*>(Tmp);
-                auto *Src1_d = reinterpret_cast<uint16_t*>(Src1);
-                auto *Src2_d = reinterpret_cast<uint16_t*>(Src2);
-                for (unsigned i = 0; i < Elements; ++i) {
-                  Dst_d[i*2] = Src1_d[BaseOffset + i];
-                  Dst_d[i*2+1] = Src2_d[BaseOffset + i];
-                }
-                break;
-              }
-              case 4: {
-                auto *Dst_d  = reinterpret_cast<uint32_t*>(Tmp);
-                auto *Src1_d = reinterpret_cast<uint32_t*>(Src1);
-                auto *Src2_d = reinterpret_cast<uint32_t*>(Src2);
-                for (unsigned i = 0; i < Elements; ++i) {
-                  Dst_d[i*2] = Src1_d[BaseOffset + i];
-                  Dst_d[i*2+1] = Src2_d[BaseOffset + i];
-                }
-                break;
-              }
-              case 8: {
-                auto *Dst_d  = reinterpret_cast<uint64_t*>(Tmp);
-                auto *Src1_d = reinterpret_cast<uint64_t*>(Src1);
-                auto *Src2_d = reinterpret_cast<uint64_t*>(Src2);
-                for (unsigned i = 0; i < Elements; ++i) {
-                  Dst_d[i*2] = Src1_d[BaseOffset + i];
-                  Dst_d[i*2+1] = Src2_d[BaseOffset + i];
-                }
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VINSELEMENT: {
-            auto Op = IROp->C<IR::IROp_VInsElement>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            // Copy src1 in to dest
-            memcpy(Tmp, Src1, Op->RegisterSize);
-            switch (Op->ElementSize) {
-              case 1: {
-                auto *Dst_d  = reinterpret_cast<uint8_t*>(Tmp);
-                auto *Src2_d = reinterpret_cast<uint8_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
-                break;
-              }
-              case 2: {
-                auto *Dst_d  = reinterpret_cast<uint16_t*>(Tmp);
-                auto *Src2_d = reinterpret_cast<uint16_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
-                break;
-              }
-              case 4: {
-                auto *Dst_d  = reinterpret_cast<uint32_t*>(Tmp);
-                auto *Src2_d = reinterpret_cast<uint32_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
-                break;
-              }
-              case 8: {
-                auto *Dst_d  = reinterpret_cast<uint64_t*>(Tmp);
-                auto *Src2_d = reinterpret_cast<uint64_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            };
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VINSSCALARELEMENT: {
-            auto Op = IROp->C<IR::IROp_VInsScalarElement>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            // Copy src1 in to dest
-            memcpy(Tmp, Src1, Op->RegisterSize);
-            switch (Op->ElementSize) {
-              case 1: {
-                auto *Dst_d  = reinterpret_cast<uint8_t*>(Tmp);
-                auto Src2_d = *reinterpret_cast<uint8_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d;
-                break;
-              }
-              case 2: {
-                auto *Dst_d  = reinterpret_cast<uint16_t*>(Tmp);
-                auto Src2_d = *reinterpret_cast<uint16_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d;
-                break;
-              }
-              case 4: {
-                auto *Dst_d  = reinterpret_cast<uint32_t*>(Tmp);
-                auto Src2_d = *reinterpret_cast<uint32_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d;
-                break;
-              }
-              case 8: {
-                auto *Dst_d  = reinterpret_cast<uint64_t*>(Tmp);
-                auto Src2_d = *reinterpret_cast<uint64_t*>(Src2);
-                Dst_d[Op->DestIdx] = Src2_d;
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            };
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VCMPEQ: {
-            auto Op = IROp->C<IR::IROp_VCMPEQ>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return a == b ? ~0ULL : 0; };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, uint8_t,   Func)
-              DO_VECTOR_OP(2, uint16_t,  Func)
-              DO_VECTOR_OP(4, uint32_t,  Func)
-              DO_VECTOR_OP(8, uint64_t,  Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VCMPGT: {
-            auto Op = IROp->C<IR::IROp_VCMPGT>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-            uint8_t Tmp[16];
-
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-            auto Func = [](auto a, auto b) { return a > b ? ~0ULL : 0; };
-
-            switch (Op->ElementSize) {
-              DO_VECTOR_OP(1, int8_t,   Func)
-              DO_VECTOR_OP(2, int16_t,  Func)
-              DO_VECTOR_OP(4, int32_t,  Func)
-              DO_VECTOR_OP(8, int64_t,  Func)
-              default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
-            }
-
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_LUDIV: {
-            auto Op = IROp->C<IR::IROp_LUDiv>();
-            // Each source is OpSize in size
-            // So you can have up to a 128bit divide from x86-64
-            switch (OpSize) {
-              case 2: {
-                uint16_t SrcLow = *GetSrc<uint16_t*>(Op->Header.Args[0]);
-                uint16_t SrcHigh = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                uint16_t Divisor = *GetSrc<uint16_t*>(Op->Header.Args[2]);
-                uint32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
-                uint32_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<uint16_t>(Res);
-                break;
-              }
-              case 4: {
-                uint32_t SrcLow = *GetSrc<uint32_t*>(Op->Header.Args[0]);
-                uint32_t SrcHigh = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                uint32_t Divisor = *GetSrc<uint32_t*>(Op->Header.Args[2]);
-                uint64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
-                uint64_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<uint32_t>(Res);
-                break;
-              }
-              case 8: {
-                uint64_t SrcLow = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-                uint64_t SrcHigh = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                uint64_t Divisor = *GetSrc<uint64_t*>(Op->Header.Args[2]);
-                __uint128_t Source = (static_cast<__uint128_t>(SrcHigh) << 64) | SrcLow;
-                __uint128_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                memcpy(GDP, &Res, OpSize);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown LUDIV Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_LDIV: {
-            auto Op = IROp->C<IR::IROp_LDiv>();
-            // Each source is OpSize in size
-            // So you can have up to a 128bit divide from x86-64
-            switch (OpSize) {
-              case 2: {
-                uint16_t SrcLow = *GetSrc<uint16_t*>(Op->Header.Args[0]);
-                uint16_t SrcHigh = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                int16_t Divisor = *GetSrc<uint16_t*>(Op->Header.Args[2]);
-                int32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
-                int32_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<int16_t>(Res);
-                break;
-              }
-              case 4: {
-                uint32_t SrcLow = *GetSrc<uint32_t*>(Op->Header.Args[0]);
-                uint32_t SrcHigh = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                int32_t Divisor = *GetSrc<uint32_t*>(Op->Header.Args[2]);
-                int64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
-                int64_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<int32_t>(Res);
-                break;
-              }
-              case 8: {
-                uint64_t SrcLow = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-                uint64_t SrcHigh = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                int64_t Divisor = *GetSrc<int64_t*>(Op->Header.Args[2]);
-                __int128_t Source = (static_cast<__int128_t>(SrcHigh) << 64) | SrcLow;
-                __int128_t Res = Source / Divisor;
-
-                // We only store the lower bits of the result
-                memcpy(GDP, &Res, OpSize);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown LDIV Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_LUREM: {
-            auto Op = IROp->C<IR::IROp_LURem>();
-            // Each source is OpSize in size
-            // So you can have up to a 128bit Remainder from x86-64
-            switch (OpSize) {
-              case 2: {
-                uint16_t SrcLow = *GetSrc<uint16_t*>(Op->Header.Args[0]);
-                uint16_t SrcHigh = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                uint16_t Divisor = *GetSrc<uint16_t*>(Op->Header.Args[2]);
-                uint32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
-                uint32_t Res = Source % Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<uint16_t>(Res);
-                break;
-              }
-
-              case 4: {
-                uint32_t SrcLow = *GetSrc<uint32_t*>(Op->Header.Args[0]);
-                uint32_t SrcHigh = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                uint32_t Divisor = *GetSrc<uint32_t*>(Op->Header.Args[2]);
-                uint64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
-                uint64_t Res = Source % Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<uint32_t>(Res);
-                break;
-              }
-              case 8: {
-                uint64_t SrcLow = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-                uint64_t SrcHigh = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                uint64_t Divisor = *GetSrc<uint64_t*>(Op->Header.Args[2]);
-                __uint128_t Source = (static_cast<__uint128_t>(SrcHigh) << 64) | SrcLow;
-                __uint128_t Res = Source % Divisor;
-                // We only store the lower bits of the result
-                memcpy(GDP, &Res, OpSize);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown LUREM Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_LREM: {
-            auto Op = IROp->C<IR::IROp_LRem>();
-            // Each source is OpSize in size
-            // So you can have up to a 128bit Remainder from x86-64
-            switch (OpSize) {
-              case 2: {
-                uint16_t SrcLow = *GetSrc<uint16_t*>(Op->Header.Args[0]);
-                uint16_t SrcHigh = *GetSrc<uint16_t*>(Op->Header.Args[1]);
-                int16_t Divisor = *GetSrc<uint16_t*>(Op->Header.Args[2]);
-                int32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
-                int32_t Res = Source % Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<int16_t>(Res);
-                break;
-              }
-              case 4: {
-                uint32_t SrcLow = *GetSrc<uint32_t*>(Op->Header.Args[0]);
-                uint32_t SrcHigh = *GetSrc<uint32_t*>(Op->Header.Args[1]);
-                int32_t Divisor = *GetSrc<uint32_t*>(Op->Header.Args[2]);
-                int64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
-                int64_t Res = Source % Divisor;
-
-                // We only store the lower bits of the result
-                GD = static_cast<int32_t>(Res);
-                break;
-              }
-              case 8: {
-                uint64_t SrcLow = *GetSrc<uint64_t*>(Op->Header.Args[0]);
-                uint64_t SrcHigh = *GetSrc<uint64_t*>(Op->Header.Args[1]);
-                int64_t Divisor = *GetSrc<int64_t*>(Op->Header.Args[2]);
-                __int128_t Source = (static_cast<__int128_t>(SrcHigh) << 64) | SrcLow;
-                __int128_t Res = Source % Divisor;
-                // We only store the lower bits of the result
-                memcpy(GDP, &Res, OpSize);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown LREM Size: %d", OpSize); break;
-            }
-            break;
-          }
-          case IR::OP_VEXTR: {
-            auto Op = IROp->C<IR::IROp_VExtr>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(Op->Header.Args[1]);
-
-            uint64_t Offset = Op->Index * Op->ElementSize * 8;
-            __uint128_t Dst = (Src1 << (sizeof(__uint128_t) * 8 - Offset)) | (Src2 >> Offset);
-
-            memcpy(GDP, &Dst, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VINSGPR: {
-            auto Op = IROp->C<IR::IROp_VInsGPR>();
-            __uint128_t Src1 = *GetSrc<__uint128_t*>(Op->Header.Args[0]);
-            __uint128_t Src2 = *GetSrc<__uint128_t*>(Op->Header.Args[1]);
-
-            uint64_t Offset = Op->Index * Op->ElementSize * 8;
-            __uint128_t Mask = (1ULL << (Op->ElementSize * 8)) - 1;
-            Mask <<= Offset;
-            Mask = ~Mask;
-            __uint128_t Dst = Src1 & Mask;
-            Dst |= Src2 << Offset;
-
-            memcpy(GDP, &Dst, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_FLOAT_FROMGPR_S: {
-            auto Op = IROp->C<IR::IROp_Float_FromGPR_S>();
-            if (Op->ElementSize == 8) {
-              double Dst = (double)*GetSrc<int64_t*>(Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->ElementSize);
-            }
-            else {
-              float Dst = (float)*GetSrc<int32_t*>(Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->ElementSize);
-            }
-            break;
-          }
-          case IR::OP_FLOAT_FROMGPR_U: {
-            auto Op = IROp->C<IR::IROp_Float_FromGPR_U>();
-            if (Op->ElementSize == 8) {
-              double Dst = (double)*GetSrc<uint64_t*>(Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->ElementSize);
-            }
-            else {
-              float Dst = (float)*GetSrc<uint32_t*>(Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->ElementSize);
-            }
-            break;
-          }
-          case IR::OP_FLOAT_TOGPR_ZS: {
-            auto Op = IROp->C<IR::IROp_Float_ToGPR_ZS>();
-            if (Op->ElementSize == 8) {
-              int64_t Dst = (int64_t)*GetSrc<double*>(Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->ElementSize);
-            }
-            else {
-              int32_t Dst = (int32_t)*GetSrc<float*>(Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->ElementSize);
-            }
-            break;
-          }
-          case IR::OP_FLOAT_TOGPR_ZU: {
-            auto Op = IROp->C<IR::IROp_Float_ToGPR_ZU>();
-            if (Op->ElementSize == 8) {
-              uint64_t Dst = (uint64_t)*GetSrc<double*>(Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->ElementSize);
-            }
-            else {
-              uint32_t Dst = (uint32_t)*GetSrc<float*>(Op->Header.Args[0]);
-              memcpy(GDP, &Dst, Op->ElementSize);
-            }
-            break;
-          }
-          case IR::OP_FLOAT_FTOF: {
-            auto Op = IROp->C<IR::IROp_Float_FToF>();
-            uint16_t Conv = (Op->DstElementSize << 8) | Op->SrcElementSize;
-            switch (Conv) {
-              case 0x0804: { // Double <- Float
-                double Dst = (double)*GetSrc<float*>(Op->Header.Args[0]);
-                memcpy(GDP, &Dst, 8);
-                break;
-              }
-              case 0x0408: { // Float <- Double
-                float Dst = (float)*GetSrc<double*>(Op->Header.Args[0]);
-                memcpy(GDP, &Dst, 4);
-                break;
-              }
-              default: LogMan::Msg::A("Unknown FCVT sizes: 0x%x", Conv);
-            }
-            break;
-          }
-          case IR::OP_VECTOR_FTOF: {
-            auto Op = IROp->C<IR::IROp_Vector_FToF>();
-            void *Src = GetSrc<void*>(Op->Header.Args[0]);
-            uint8_t Tmp[16]{};
-
-            uint16_t Conv = (Op->DstElementSize << 8) | Op->SrcElementSize;
-
-            auto Func = [](auto a, auto min, auto max) { return a; };
-            switch (Conv) {
-              case 0x0804: { // Double <- float
-                uint8_t Elements = Op->RegisterSize / Op->SrcElementSize;
-                switch (Op->SrcElementSize) {
-                DO_VECTOR_1SRC_2TYPE_OP(4, double, float, Func, 0, 0)
-                }
-                break;
-              }
-              case 0x0408: { // Float <- Double
-                uint8_t Elements = Op->RegisterSize / Op->SrcElementSize;
-                switch (Op->SrcElementSize) {
-                DO_VECTOR_1SRC_2TYPE_OP(8, float, double, Func, 0, 0)
-                }
-                break;
-
-                break;
-              }
-              default: LogMan::Msg::A("Unknown Conversion Type : 0%04x", Conv); break;
-            }
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_FCMP: {
-            auto Op = IROp->C<IR::IROp_FCmp>();
-            uint32_t ResultFlags{};
-            if (Op->ElementSize == 4) {
-              float Src1 = *GetSrc<float*>(Op->Header.Args[0]);
-              float Src2 = *GetSrc<float*>(Op->Header.Args[1]);
-              if (Op->Flags & (1 << FCMP_FLAG_LT)) {
-                if (Src1 < Src2) {
-                  ResultFlags |= (1 << FCMP_FLAG_LT);
-                }
-              }
-              if (Op->Flags & (1 << FCMP_FLAG_UNORDERED)) {
-                if (std::isnan(Src1) || std::isnan(Src2)) {
-                  ResultFlags |= (1 << FCMP_FLAG_UNORDERED);
-                }
-              }
-              if (Op->Flags & (1 << FCMP_FLAG_EQ)) {
-                if (Src1 == Src2) {
-                  ResultFlags |= (1 << FCMP_FLAG_EQ);
-                }
-              }
-            }
-            else {
-              double Src1 = *GetSrc<double*>(Op->Header.Args[0]);
-              double Src2 = *GetSrc<double*>(Op->Header.Args[1]);
-              if (Op->Flags & (1 << FCMP_FLAG_LT)) {
-                if (Src1 < Src2) {
-                  ResultFlags |= (1 << FCMP_FLAG_LT);
-                }
-              }
-              if (Op->Flags & (1 << FCMP_FLAG_UNORDERED)) {
-                if (std::isnan(Src1) || std::isnan(Src2)) {
-                  ResultFlags |= (1 << FCMP_FLAG_UNORDERED);
-                }
-              }
-              if (Op->Flags & (1 << FCMP_FLAG_EQ)) {
-                if (Src1 == Src2) {
-                  ResultFlags |= (1 << FCMP_FLAG_EQ);
-                }
-              }
-            }
-
-            GD = ResultFlags;
-            break;
-          }
-          case IR::OP_GETHOSTFLAG: {
-            auto Op = IROp->C<IR::IROp_GetHostFlag>();
-            GD = (*GetSrc<uint64_t*>(Op->Header.Args[0]) >> Op->Flag) & 1;
-            break;
-          }
-          #define DO_SCALAR_COMPARE_OP(size, type, type2, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type2*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            Dst_d[0] = func(Src1_d[0], Src2_d[0]);          \
-            break;                                            \
-            }
-
-          #define DO_VECTOR_COMPARE_OP(size, type, type2, func)              \
-            case size: {                                      \
-            auto *Dst_d  = reinterpret_cast<type2*>(Tmp);  \
-            auto *Src1_d = reinterpret_cast<type*>(Src1); \
-            auto *Src2_d = reinterpret_cast<type*>(Src2); \
-            for (uint8_t i = 0; i < Elements; ++i) {          \
-              Dst_d[i] = func(Src1_d[i], Src2_d[i]);          \
-            }                                                 \
-            break;                                            \
-            }
-
-          case IR::OP_VFCMPEQ: {
-            auto Op = IROp->C<IR::IROp_VFCMPEQ>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-
-            auto Func = [](auto a, auto b) { return a == b ? ~0ULL : 0; };
-
-            uint8_t Tmp[16];
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            if (Op->ElementSize == Op->RegisterSize) {
-              switch (Op->ElementSize) {
-              DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-            else {
-              switch (Op->ElementSize) {
-              DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFCMPNEQ: {
-            auto Op = IROp->C<IR::IROp_VFCMPNEQ>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-
-            auto Func = [](auto a, auto b) { return a != b ? ~0ULL : 0; };
-
-            uint8_t Tmp[16];
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            if (Op->ElementSize == Op->RegisterSize) {
-              switch (Op->ElementSize) {
-              DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-            else {
-              switch (Op->ElementSize) {
-              DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFCMPLT: {
-            auto Op = IROp->C<IR::IROp_VFCMPLT>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-
-            auto Func = [](auto a, auto b) { return a < b ? ~0ULL : 0; };
-
-            uint8_t Tmp[16];
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            if (Op->ElementSize == Op->RegisterSize) {
-              switch (Op->ElementSize) {
-              DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-            else {
-              switch (Op->ElementSize) {
-              DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFCMPLE: {
-            auto Op = IROp->C<IR::IROp_VFCMPLE>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-
-            auto Func = [](auto a, auto b) { return a <= b ? ~0ULL : 0; };
-
-            uint8_t Tmp[16];
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            if (Op->ElementSize == Op->RegisterSize) {
-              switch (Op->ElementSize) {
-              DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-            else {
-              switch (Op->ElementSize) {
-              DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFCMPUNO: {
-            auto Op = IROp->C<IR::IROp_VFCMPUNO>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-
-            auto Func = [](auto a, auto b) { return (std::isnan(a) || std::isnan(b)) ? ~0ULL : 0; };
-
-            uint8_t Tmp[16];
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            if (Op->ElementSize == Op->RegisterSize) {
-              switch (Op->ElementSize) {
-              DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-            else {
-              switch (Op->ElementSize) {
-              DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          case IR::OP_VFCMPORD: {
-            auto Op = IROp->C<IR::IROp_VFCMPORD>();
-            void *Src1 = GetSrc<void*>(Op->Header.Args[0]);
-            void *Src2 = GetSrc<void*>(Op->Header.Args[1]);
-
-            auto Func = [](auto a, auto b) { return (!std::isnan(a) && !std::isnan(b)) ? ~0ULL : 0; };
-
-            uint8_t Tmp[16];
-            uint8_t Elements = Op->RegisterSize / Op->ElementSize;
-
-            if (Op->ElementSize == Op->RegisterSize) {
-              switch (Op->ElementSize) {
-              DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-            else {
-              switch (Op->ElementSize) {
-              DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
-              DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
-              default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
-              }
-            }
-
-            memcpy(GDP, Tmp, Op->RegisterSize);
-            break;
-          }
-          default:
-            LogMan::Msg::A("Unknown IR Op: %d(%s)", IROp->Op, FEXCore::IR::GetName(IROp->Op).data());
-            break;
-        }
-
-        // CodeLast is inclusive. So we still need to dump the CodeLast op as well
-        if (CodeBegin == CodeLast) {
-          break;
-        }
-        ++CodeBegin;
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += Op->Offset;
+
+    void *Data = reinterpret_cast<void*>(ContextPtr);
+    memcpy(GDP, Data, Op->Size * 2);
+    NEXT_OP();
+  }
+  Op_STORECONTEXTPAIR: {
+    auto Op = IROp->C<IR::IROp_StoreContextPair>();
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += Op->Offset;
+
+    void *Data = reinterpret_cast<void*>(ContextPtr);
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    memcpy(Data, Src, Op->Size * 2);
+    NEXT_OP();
+  }
+  Op_CREATEELEMENTPAIR: {
+    auto Op = IROp->C<IR::IROp_CreateElementPair>();
+    void *Src_Lower = GetSrc<void*>(Current->Args[0]);
+    void *Src_Upper = GetSrc<void*>(Current->Args[1]);
+
+    memcpy(GDP, Src_Lower, Op->Header.Size);
+    memcpy(reinterpret_cast<void*>(reinterpret_cast<uint64_t>(GDP) + Op->Header.Size),
+      Src_Upper, Op->Header.Size);
+    NEXT_OP();
+  }
+  Op_EXTRACTELEMENTPAIR: {
+    auto Op = IROp->C<IR::IROp_ExtractElementPair>();
+    uintptr_t Src = GetSrc<uintptr_t>(Current->Args[0]);
+    memcpy(GDP,
+      reinterpret_cast<void*>(Src + Op->Header.Size * Op->Element), Op->Header.Size);
+    NEXT_OP();
+  }
+  Op_CASPAIR: {
+    auto Op = IROp->C<IR::IROp_CASPair>();
+    auto Size = OpSize;
+    // Size is the size of each pair element
+    switch (Size) {
+      case 4: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = GetSrc<std::atomic<uint64_t> *>(Op->Header.Args[2]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Current->Args[2]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[2]));
+        }
+
+        uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+        uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+
+        uint64_t Expected = Src1;
+        bool Result = Data->compare_exchange_strong(Expected, Src2);
+        GD = Result ? Src1 : Expected;
+        break;
       }
-    };
+      case 8: {
+        std::atomic<__uint128_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = GetSrc<std::atomic<__uint128_t> *>(Op->Header.Args[2]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<__uint128_t> *>(*GetSrc<uint64_t*>(Current->Args[2]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[2]));
+        }
 
-    HandleBlock();
+        __uint128_t Src1 = *GetSrc<__uint128_t*>(Current->Args[0]);
+        __uint128_t Src2 = *GetSrc<__uint128_t*>(Current->Args[1]);
 
-    if (BlockResults.Redo) {
-      continue;
+        __uint128_t Expected = Src1;
+        bool Result = Data->compare_exchange_strong(Expected, Src2);
+        memcpy(GDP, Result ? &Src1 : &Expected, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown CAS size: %d", Size); break;
+    }
+    NEXT_OP();
+  }
+  Op_TRUNCELEMENTPAIR: {
+    auto Op = IROp->C<IR::IROp_TruncElementPair>();
+
+    switch (Op->Size) {
+      case 4: {
+        uint64_t *Src = GetSrc<uint64_t*>(Current->Args[0]);
+        uint64_t Result{};
+        Result = Src[0] & ~0U;
+        Result |= Src[1] << 32;
+        GD = Result;
+        break;
+      }
+      default: LogMan::Msg::A("Unhandled Truncation size: %d", Op->Size); break;
+    }
+    NEXT_OP();
+  }
+  Op_LOADFLAG: {
+    auto Op = IROp->C<IR::IROp_LoadFlag>();
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += offsetof(FEXCore::Core::CPUState, flags[0]);
+    ContextPtr += Op->Flag;
+    uint8_t const *Data = reinterpret_cast<uint8_t const*>(ContextPtr);
+    GD = *Data;
+    NEXT_OP();
+  }
+  Op_STOREFLAG: {
+    auto Op = IROp->C<IR::IROp_StoreFlag>();
+    uint8_t Arg = *GetSrc<uint8_t*>(Current->Args[0]) & 1;
+
+    uintptr_t ContextPtr = reinterpret_cast<uintptr_t>(&Thread->State.State);
+    ContextPtr += offsetof(FEXCore::Core::CPUState, flags[0]);
+    ContextPtr += Op->Flag;
+    uint8_t *Data = reinterpret_cast<uint8_t*>(ContextPtr);
+    *Data = Arg;
+    NEXT_OP();
+  }
+  Op_LOADMEM: {
+    void const *Data{};
+    if (Thread->CTX->Config.UnifiedMemory) {
+      Data = *GetSrc<void const**>(Current->Args[0]);
+    }
+    else {
+      Data = Thread->CTX->MemoryMapper.GetPointer<void const*>(*GetSrc<uint64_t*>(Current->Args[0]));
+      LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+    }
+    memcpy(GDP, Data, OpSize);
+    NEXT_OP();
+  }
+  Op_STOREMEM: {
+    #define STORE_DATA(x, y) \
+      case x: { \
+        y *Data{}; \
+        if (Thread->CTX->Config.UnifiedMemory) { \
+          Data = *GetSrc<y**>(Current->Args[0]); \
+        } \
+        else { \
+          Data = Thread->CTX->MemoryMapper.GetPointer<y*>(*GetSrc<uint64_t*>(Current->Args[0])); \
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0])); \
+        } \
+        memcpy(Data, GetSrc<y*>(Current->Args[1]), sizeof(y)); \
+        break; \
+      }
+
+    auto Op = IROp->C<IR::IROp_StoreMem>();
+
+    switch (Op->Size) {
+      STORE_DATA(1, uint8_t)
+      STORE_DATA(2, uint16_t)
+      STORE_DATA(4, uint32_t)
+      STORE_DATA(8, uint64_t)
+      case 16: {
+        void *Data{};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<void**>(Current->Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<void*>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+
+        void *Src = GetSrc<void*>(Current->Args[1]);
+        memcpy(Data, Src, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unhandled StoreMem size"); break;
+    }
+    #undef STORE_DATA
+    NEXT_OP();
+  }
+  Op_MEMCPY: {
+    auto Op = IROp->C<IR::IROp_MemCpy>();
+    uint64_t Dest = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Src = *GetSrc<uint64_t*>(Current->Args[1]);
+    uint64_t Counter = *GetSrc<uint64_t*>(Current->Args[2]);
+    int64_t Dir = *GetSrc<int64_t*>(Current->Args[3]);
+
+    if (!Thread->CTX->Config.UnifiedMemory) {
+      Dest += Thread->CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
+      Src += Thread->CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
+    }
+
+    // One element at a time, overlapping copies need to see the elements that were already stored
+    for (uint64_t i = 0; i < Counter; ++i) {
+      memcpy(reinterpret_cast<void*>(Dest), reinterpret_cast<void*>(Src), Op->Size);
+      Dest += Dir;
+      Src += Dir;
+    }
+    NEXT_OP();
+  }
+
+  Op_MEMSET: {
+    auto Op = IROp->C<IR::IROp_MemSet>();
+    uint64_t Dest = *GetSrc<uint64_t*>(Current->Args[0]);
+    void *Value = GetSrc<void*>(Current->Args[1]);
+    uint64_t Counter = *GetSrc<uint64_t*>(Current->Args[2]);
+    int64_t Dir = *GetSrc<int64_t*>(Current->Args[3]);
+
+    if (!Thread->CTX->Config.UnifiedMemory) {
+      Dest += Thread->CTX->MemoryMapper.GetBaseOffset<uint64_t>(0);
+    }
+
+    for (uint64_t i = 0; i < Counter; ++i) {
+      memcpy(reinterpret_cast<void*>(Dest), Value, Op->Size);
+      Dest += Dir;
+    }
+    NEXT_OP();
+  }
+  #define DO_OP(size, type, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(GDP);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    *Dst_d = func(*Src1_d, *Src2_d);          \
+    break;                                            \
+    }
+
+  Op_ADD: {
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    auto Func = [](auto a, auto b) { return a + b; };
+
+    switch (OpSize) {
+      DO_OP(1, uint8_t,  Func)
+      DO_OP(2, uint16_t, Func)
+      DO_OP(4, uint32_t, Func)
+      DO_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_SUB: {
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    auto Func = [](auto a, auto b) { return a - b; };
+
+    switch (OpSize) {
+      DO_OP(1, uint8_t,  Func)
+      DO_OP(2, uint16_t, Func)
+      DO_OP(4, uint32_t, Func)
+      DO_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_NEG: {
+    uint64_t Src = *GetSrc<int64_t*>(Current->Args[0]);
+    switch (OpSize) {
+      case 1:
+        GD = -static_cast<int8_t>(Src);
+        break;
+      case 2:
+        GD = -static_cast<int16_t>(Src);
+        break;
+      case 4:
+        GD = -static_cast<int32_t>(Src);
+        break;
+      case 8:
+        GD = -static_cast<int64_t>(Src);
+        break;
+      default: LogMan::Msg::A("Unknown NEG Size: %d\n", OpSize); break;
+    };
+    NEXT_OP();
+  }
+  Op_OR: {
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    auto Func = [](auto a, auto b) { return a | b; };
+
+    switch (OpSize) {
+      DO_OP(1, uint8_t,  Func)
+      DO_OP(2, uint16_t, Func)
+      DO_OP(4, uint32_t, Func)
+      DO_OP(8, uint64_t, Func)
+      DO_OP(16, __uint128_t, Func)
+      default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_AND: {
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    auto Func = [](auto a, auto b) { return a & b; };
+
+    switch (OpSize) {
+      DO_OP(1, uint8_t,  Func)
+      DO_OP(2, uint16_t, Func)
+      DO_OP(4, uint32_t, Func)
+      DO_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_XOR: {
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    auto Func = [](auto a, auto b) { return a ^ b; };
+
+    switch (OpSize) {
+      DO_OP(1, uint8_t,  Func)
+      DO_OP(2, uint16_t, Func)
+      DO_OP(4, uint32_t, Func)
+      DO_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_LSHL: {
+    uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+    uint8_t Mask = OpSize * 8 - 1;
+    GD = Src1 << (Src2 & Mask);
+    NEXT_OP();
+  }
+  Op_LSHR: {
+    uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+    uint8_t Mask = OpSize * 8 - 1;
+    GD = Src1 >> (Src2 & Mask);
+    NEXT_OP();
+  }
+  Op_ASHR: {
+    uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+    uint8_t Mask = OpSize * 8 - 1;
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<int8_t>(Src1) >> (Src2 & Mask);
+        break;
+      case 2:
+        GD = static_cast<int16_t>(Src1) >> (Src2 & Mask);
+        break;
+      case 4:
+        GD = static_cast<int32_t>(Src1) >> (Src2 & Mask);
+        break;
+      case 8:
+        GD = static_cast<int64_t>(Src1) >> (Src2 & Mask);
+        break;
+      default: LogMan::Msg::A("Unknown ASHR Size: %d\n", OpSize); break;
+    };
+    NEXT_OP();
+  }
+  Op_ROR: {
+    uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+    auto Ror = [] (auto In, auto R) {
+    auto RotateMask = sizeof(In) * 8 - 1;
+      R &= RotateMask;
+      return (In >> R) | (In << (sizeof(In) * 8 - R));
+    };
+
+    switch (OpSize) {
+      case 1:
+        GD = Ror(static_cast<uint8_t>(Src1), static_cast<uint8_t>(Src2));
+        break;
+      case 2:
+        GD = Ror(static_cast<uint16_t>(Src1), static_cast<uint16_t>(Src2));
+        break;
+      case 4:
+        GD = Ror(static_cast<uint32_t>(Src1), static_cast<uint32_t>(Src2));
+        break;
+      case 8: {
+        GD = Ror(static_cast<uint64_t>(Src1), static_cast<uint64_t>(Src2));
+        break;
+      }
+      default: LogMan::Msg::A("Unknown ROR Size: %d\n", OpSize); break;
     }
+    NEXT_OP();
+  }
+  Op_ROL: {
+    uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+    auto Rol = [] (auto In, auto R) {
+    auto RotateMask = sizeof(In) * 8 - 1;
+      R &= RotateMask;
+      return (In << R) | (In >> (sizeof(In) * 8 - R));
+    };
 
-    if (BlockIROp->Next.ID() == 0 || BlockResults.Quit) {
+    switch (OpSize) {
+    case 1:
+      GD = Rol(static_cast<uint8_t>(Src1), static_cast<uint8_t>(Src2));
+      break;
+    case 2:
+      GD = Rol(static_cast<uint16_t>(Src1), static_cast<uint16_t>(Src2));
+      break;
+    case 4:
+      GD = Rol(static_cast<uint32_t>(Src1), static_cast<uint32_t>(Src2));
+      break;
+    case 8: {
+      GD = Rol(static_cast<uint64_t>(Src1), static_cast<uint64_t>(Src2));
+      break;
+    }
+    default: LogMan::Msg::A("Unknown ROL Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_NOT: {
+    uint64_t Src = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint8_t Mask = OpSize * 8 - 1;
+    GD = (~Src) & Mask;
+    NEXT_OP();
+  }
+  Op_ZEXT: {
+    auto Op = IROp->C<IR::IROp_Zext>();
+    LogMan::Throw::A(Op->SrcSize <= 64, "Can't support Zext of size: %ld", Op->SrcSize);
+    uint64_t Src = *GetSrc<uint64_t*>(Current->Args[0]);
+    if (Op->SrcSize == 64) {
+      // Zext 64bit to 128bit
+      __uint128_t SrcLarge = Src;
+      memcpy(GDP, &SrcLarge, 16);
+    }
+    else {
+      GD = Src & ((1ULL << Op->SrcSize) - 1);
+    }
+    NEXT_OP();
+  }
+  Op_SEXT: {
+    auto Op = IROp->C<IR::IROp_Sext>();
+    LogMan::Throw::A(Op->SrcSize <= 64, "Can't support Zext of size: %ld", Op->SrcSize);
+    switch (Op->SrcSize / 8) {
+      case 1:
+        GD = *GetSrc<int8_t*>(Current->Args[0]);
+        break;
+      case 2:
+        GD = *GetSrc<int16_t*>(Current->Args[0]);
+        break;
+      case 4:
+        GD = *GetSrc<int32_t*>(Current->Args[0]);
+        break;
+      case 8:
+        GD = *GetSrc<uint64_t*>(Current->Args[0]);
+        break;
+      default: LogMan::Msg::A("Unknown Sext size: %d", Op->SrcSize / 8);
+    }
+    NEXT_OP();
+  }
+  Op_MUL: {
+    uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<int64_t>(static_cast<int8_t>(Src1)) * static_cast<int64_t>(static_cast<int8_t>(Src2));
+        break;
+      case 2:
+        GD = static_cast<int64_t>(static_cast<int16_t>(Src1)) * static_cast<int64_t>(static_cast<int16_t>(Src2));
+        break;
+      case 4:
+        GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) * static_cast<int64_t>(static_cast<int32_t>(Src2));
+        break;
+      case 8:
+        GD = static_cast<int64_t>(Src1) * static_cast<int64_t>(Src2);
+        break;
+      case 16: {
+        __int128_t Tmp = static_cast<__int128_t>(static_cast<int64_t>(Src1)) * static_cast<__int128_t>(static_cast<int64_t>(Src2));
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_MULH: {
+    uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+
+    switch (OpSize) {
+      case 1: {
+        int64_t Tmp = static_cast<int64_t>(static_cast<int8_t>(Src1)) * static_cast<int64_t>(static_cast<int8_t>(Src2));
+        GD = Tmp >> 8;
+        break;
+      }
+      case 2: {
+        int64_t Tmp = static_cast<int64_t>(static_cast<int16_t>(Src1)) * static_cast<int64_t>(static_cast<int16_t>(Src2));
+        GD = Tmp >> 16;
+        break;
+      }
+      case 4: {
+        int64_t Tmp = static_cast<int64_t>(static_cast<int32_t>(Src1)) * static_cast<int64_t>(static_cast<int32_t>(Src2));
+        GD = Tmp >> 32;
+        break;
+      }
+      case 8: {
+        __int128_t Tmp = static_cast<__int128_t>(static_cast<int64_t>(Src1)) * static_cast<__int128_t>(static_cast<int64_t>(Src2));
+        GD = Tmp >> 64;
+      }
       break;
-    } else {
-      BlockNode = BlockIROp->Next.GetNode(ListBegin);
+      default: LogMan::Msg::A("Unknown MulH Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_UMUL: {
+    uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<uint8_t>(Src1) * static_cast<uint8_t>(Src2);
+        break;
+      case 2:
+        GD = static_cast<uint16_t>(Src1) * static_cast<uint16_t>(Src2);
+        break;
+      case 4:
+        GD = static_cast<uint32_t>(Src1) * static_cast<uint32_t>(Src2);
+        break;
+      case 8:
+        GD = static_cast<uint64_t>(Src1) * static_cast<uint64_t>(Src2);
+        break;
+      case 16: {
+        __uint128_t Tmp = static_cast<__uint128_t>(static_cast<uint64_t>(Src1)) * static_cast<__uint128_t>(static_cast<uint64_t>(Src2));
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown UMul Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_UMULH: {
+    uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<uint16_t>(Src1) * static_cast<uint16_t>(Src2);
+        GD >>= 8;
+        break;
+      case 2:
+        GD = static_cast<uint32_t>(Src1) * static_cast<uint32_t>(Src2);
+        GD >>= 16;
+        break;
+      case 4:
+        GD = static_cast<uint64_t>(Src1) * static_cast<uint64_t>(Src2);
+        GD >>= 32;
+        break;
+      case 8: {
+        __uint128_t Tmp = static_cast<__uint128_t>(Src1) * static_cast<__uint128_t>(Src2);
+        GD = Tmp >> 64;
+        break;
+      }
+      case 16: {
+        // XXX: This is incorrect
+        __uint128_t Tmp = static_cast<__uint128_t>(Src1) * static_cast<__uint128_t>(Src2);
+        GD = Tmp >> 64;
+        break;
+      }
+      default: LogMan::Msg::A("Unknown UMulH Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_DIV: {
+    uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<int64_t>(static_cast<int8_t>(Src1)) / static_cast<int64_t>(static_cast<int8_t>(Src2));
+        break;
+      case 2:
+        GD = static_cast<int64_t>(static_cast<int16_t>(Src1)) / static_cast<int64_t>(static_cast<int16_t>(Src2));
+        break;
+      case 4:
+        GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) / static_cast<int64_t>(static_cast<int32_t>(Src2));
+        break;
+      case 8:
+        GD = static_cast<int64_t>(Src1) / static_cast<int64_t>(Src2);
+        break;
+      case 16: {
+        __int128_t Tmp = *GetSrc<__int128_t*>(Current->Args[0]) / *GetSrc<__int128_t*>(Current->Args[1]);
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_UDIV: {
+    uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<uint64_t>(static_cast<uint8_t>(Src1)) / static_cast<uint64_t>(static_cast<uint8_t>(Src2));
+        break;
+      case 2:
+        GD = static_cast<uint64_t>(static_cast<uint16_t>(Src1)) / static_cast<uint64_t>(static_cast<uint16_t>(Src2));
+        break;
+      case 4:
+        GD = static_cast<uint64_t>(static_cast<uint32_t>(Src1)) / static_cast<uint64_t>(static_cast<uint32_t>(Src2));
+        break;
+      case 8:
+        GD = static_cast<uint64_t>(Src1) / static_cast<uint64_t>(Src2);
+        break;
+      case 16: {
+        __uint128_t Tmp = *GetSrc<__uint128_t*>(Current->Args[0]) / *GetSrc<__uint128_t*>(Current->Args[1]);
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_REM: {
+    uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<int64_t>(static_cast<int8_t>(Src1)) % static_cast<int64_t>(static_cast<int8_t>(Src2));
+        break;
+      case 2:
+        GD = static_cast<int64_t>(static_cast<int16_t>(Src1)) % static_cast<int64_t>(static_cast<int16_t>(Src2));
+        break;
+      case 4:
+        GD = static_cast<int64_t>(static_cast<int32_t>(Src1)) % static_cast<int64_t>(static_cast<int32_t>(Src2));
+        break;
+      case 8:
+        GD = static_cast<int64_t>(Src1) % static_cast<int64_t>(Src2);
+        break;
+      case 16: {
+        __int128_t Tmp = *GetSrc<__int128_t*>(Current->Args[0]) % *GetSrc<__int128_t*>(Current->Args[1]);
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_UREM: {
+    uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+
+    switch (OpSize) {
+      case 1:
+        GD = static_cast<uint64_t>(static_cast<uint8_t>(Src1)) % static_cast<uint64_t>(static_cast<uint8_t>(Src2));
+        break;
+      case 2:
+        GD = static_cast<uint64_t>(static_cast<uint16_t>(Src1)) % static_cast<uint64_t>(static_cast<uint16_t>(Src2));
+        break;
+      case 4:
+        GD = static_cast<uint64_t>(static_cast<uint32_t>(Src1)) % static_cast<uint64_t>(static_cast<uint32_t>(Src2));
+        break;
+      case 8:
+        GD = static_cast<uint64_t>(Src1) % static_cast<uint64_t>(Src2);
+        break;
+      case 16: {
+        __uint128_t Tmp = *GetSrc<__uint128_t*>(Current->Args[0]) % *GetSrc<__uint128_t*>(Current->Args[1]);
+        memcpy(GDP, &Tmp, 16);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Mul Size: %d\n", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_POPCOUNT: {
+    uint64_t Src = *GetSrc<uint64_t*>(Current->Args[0]);
+    GD = __builtin_popcountl(Src);
+    NEXT_OP();
+  }
+  Op_FINDLSB: {
+    uint64_t Src = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Result = __builtin_ffsll(Src);
+    GD = Result - 1;
+    NEXT_OP();
+  }
+  Op_FINDMSB: {
+    switch (OpSize) {
+      case 1: GD = ((24 + OpSize * 8) - __builtin_clz(*GetSrc<uint8_t*>(Current->Args[0]))) - 1; break;
+      case 2: GD = ((16 + OpSize * 8) - __builtin_clz(*GetSrc<uint16_t*>(Current->Args[0]))) - 1; break;
+      case 4: GD = (OpSize * 8 - __builtin_clz(*GetSrc<uint32_t*>(Current->Args[0]))) - 1; break;
+      case 8: GD = (OpSize * 8 - __builtin_clzll(*GetSrc<uint64_t*>(Current->Args[0]))) - 1; break;
+      default: LogMan::Msg::A("Unknown REV size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_REV: {
+    switch (OpSize) {
+      case 2: GD = __builtin_bswap16(*GetSrc<uint16_t*>(Current->Args[0])); break;
+      case 4: GD = __builtin_bswap32(*GetSrc<uint32_t*>(Current->Args[0])); break;
+      case 8: GD = __builtin_bswap64(*GetSrc<uint64_t*>(Current->Args[0])); break;
+      default: LogMan::Msg::A("Unknown REV size: %d", OpSize); break;
     }
+    NEXT_OP();
   }
+  Op_FINDTRAILINGZEROS: {
+    switch (OpSize) {
+      case 1: {
+        auto Src = *GetSrc<uint8_t*>(Current->Args[0]);
+        if (Src)
+          GD = __builtin_ctz(Src);
+        else
+          GD = sizeof(Src) * 8;
+        break;
+      }
+      case 2: {
+        auto Src = *GetSrc<uint16_t*>(Current->Args[0]);
+        if (Src)
+          GD = __builtin_ctz(Src);
+        else
+          GD = sizeof(Src) * 8;
+        break;
+      }
+      case 4: {
+        auto Src = *GetSrc<uint32_t*>(Current->Args[0]);
+        if (Src)
+          GD = __builtin_ctz(Src);
+        else
+          GD = sizeof(Src) * 8;
+        break;
+      }
+      case 8: {
+        auto Src = *GetSrc<uint64_t*>(Current->Args[0]);
+        if (Src)
+          GD = __builtin_ctzll(Src);
+        else
+          GD = sizeof(Src) * 8;
+        break;
+      }
+      default: LogMan::Msg::A("Unknown size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_BFI: {
+    auto Op = IROp->C<IR::IROp_Bfi>();
+    uint64_t SourceMask = (1ULL << Op->Width) - 1;
+    if (Op->Width == 64)
+      SourceMask = ~0ULL;
+    uint64_t DestMask = ~(SourceMask << Op->lsb);
+    uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+    uint64_t Res = (Src1 & DestMask) | ((Src2 & SourceMask) << Op->lsb);
+    GD = Res;
+    NEXT_OP();
+  }
+  Op_BFE: {
+    auto Op = IROp->C<IR::IROp_Bfe>();
+    LogMan::Throw::A(OpSize <= 16, "OpSize is too large for BFE: %d", OpSize);
+    if (OpSize == 16) {
+      LogMan::Throw::A(Op->Width <= 64, "Can't extract width of %d", Op->Width);
+      __uint128_t SourceMask = (1ULL << Op->Width) - 1;
+      if (Op->Width == 64)
+        SourceMask = ~0ULL;
+      SourceMask <<= Op->lsb;
+      __uint128_t Src = (*GetSrc<__uint128_t*>(Current->Args[0]) & SourceMask) >> Op->lsb;
+      memcpy(GDP, &Src, OpSize);
+    }
+    else {
+      uint64_t SourceMask = (1ULL << Op->Width) - 1;
+      if (Op->Width == 64)
+        SourceMask = ~0ULL;
+      SourceMask <<= Op->lsb;
+      uint64_t Src = *GetSrc<uint64_t*>(Current->Args[0]);
+      GD = (Src & SourceMask) >> Op->lsb;
+    }
+    NEXT_OP();
+  }
+  Op_SELECT: {
+    auto Op = IROp->C<IR::IROp_Select>();
+    bool CompResult = false;
+    uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+    uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+
+    uint64_t ArgTrue = *GetSrc<uint64_t*>(Current->Args[2]);
+    uint64_t ArgFalse = *GetSrc<uint64_t*>(Current->Args[3]);
+
+    switch (Op->Cond.Val) {
+      case FEXCore::IR::COND_EQ:
+        CompResult = Src1 == Src2;
+        break;
+      case FEXCore::IR::COND_NEQ:
+        CompResult = Src1 != Src2;
+        break;
+      case FEXCore::IR::COND_SGE:
+        CompResult = static_cast<int64_t>(Src1) >= static_cast<int64_t>(Src2);
+        break;
+      case FEXCore::IR::COND_SLT:
+        CompResult = static_cast<int64_t>(Src1) < static_cast<int64_t>(Src2);
+        break;
+      case FEXCore::IR::COND_SGT:
+        CompResult = static_cast<int64_t>(Src1) > static_cast<int64_t>(Src2);
+        break;
+      case FEXCore::IR::COND_SLE:
+        CompResult = static_cast<int64_t>(Src1) <= static_cast<int64_t>(Src2);
+        break;
+      case FEXCore::IR::COND_UGE:
+        CompResult = Src1 >= Src2;
+        break;
+      case FEXCore::IR::COND_ULT:
+        CompResult = Src1 < Src2;
+        break;
+      case FEXCore::IR::COND_UGT:
+        CompResult = Src1 > Src2;
+        break;
+      case FEXCore::IR::COND_ULE:
+        CompResult = Src1 <= Src2;
+        break;
+      case FEXCore::IR::COND_MI:
+      case FEXCore::IR::COND_PL:
+      case FEXCore::IR::COND_VS:
+      case FEXCore::IR::COND_VC:
+      default:
+        LogMan::Msg::A("Unsupported compare type");
+        break;
+    }
+    GD = CompResult ? ArgTrue : ArgFalse;
+    NEXT_OP();
+  }
+  Op_CAS: {
+    auto Op = IROp->C<IR::IROp_CAS>();
+    auto Size = OpSize;
+    switch (Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[2]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Current->Args[2]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[2]));
+        }
+
+        uint8_t Src1 = *GetSrc<uint8_t*>(Current->Args[0]);
+        uint8_t Src2 = *GetSrc<uint8_t*>(Current->Args[1]);
+
+        uint8_t Expected = Src1;
+        bool Result = Data->compare_exchange_strong(Expected, Src2);
+        GD = Result ? Src1 : Expected;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[2]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Current->Args[2]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[2]));
+        }
+
+        uint16_t Src1 = *GetSrc<uint16_t*>(Current->Args[0]);
+        uint16_t Src2 = *GetSrc<uint16_t*>(Current->Args[1]);
+
+        uint16_t Expected = Src1;
+        bool Result = Data->compare_exchange_strong(Expected, Src2);
+        GD = Result ? Src1 : Expected;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[2]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Current->Args[2]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[2]));
+        }
+
+        uint32_t Src1 = *GetSrc<uint32_t*>(Current->Args[0]);
+        uint32_t Src2 = *GetSrc<uint32_t*>(Current->Args[1]);
+
+        uint32_t Expected = Src1;
+        bool Result = Data->compare_exchange_strong(Expected, Src2);
+        GD = Result ? Src1 : Expected;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[2]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Current->Args[2]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[2]));
+        }
+
+        uint64_t Src1 = *GetSrc<uint64_t*>(Current->Args[0]);
+        uint64_t Src2 = *GetSrc<uint64_t*>(Current->Args[1]);
+
+        uint64_t Expected = Src1;
+        bool Result = Data->compare_exchange_strong(Expected, Src2);
+        GD = Result ? Src1 : Expected;
+        break;
+      }
+      default: LogMan::Msg::A("Unknown CAS size: %d", Size); break;
+    }
+    NEXT_OP();
+  }
+  Op_ATOMICADD: {
+    auto Op = IROp->C<IR::IROp_AtomicAdd>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+
+        uint8_t Src = *GetSrc<uint8_t*>(Current->Args[1]);
+        *Data += Src;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint16_t*>(Current->Args[0]));
+        uint16_t Src = *GetSrc<uint16_t*>(Current->Args[1]);
+        *Data += Src;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Current->Args[1]);
+        *Data += Src;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Current->Args[1]);
+        *Data += Src;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  Op_ATOMICSUB: {
+    auto Op = IROp->C<IR::IROp_AtomicSub>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Current->Args[1]);
+        *Data -= Src;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint16_t Src = *GetSrc<uint16_t*>(Current->Args[1]);
+        *Data -= Src;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Current->Args[1]);
+        *Data -= Src;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Current->Args[1]);
+        *Data -= Src;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  Op_ATOMICAND: {
+    auto Op = IROp->C<IR::IROp_AtomicAnd>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Current->Args[1]);
+        *Data &= Src;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint16_t Src = *GetSrc<uint16_t*>(Current->Args[1]);
+        *Data &= Src;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Current->Args[1]);
+        *Data &= Src;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Current->Args[1]);
+        *Data &= Src;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  Op_ATOMICOR: {
+    auto Op = IROp->C<IR::IROp_AtomicOr>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint8_t*>(Current->Args[0]));
+        uint8_t Src = *GetSrc<uint8_t*>(Current->Args[1]);
+        *Data |= Src;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint16_t*>(Current->Args[0]));
+        uint16_t Src = *GetSrc<uint16_t*>(Current->Args[1]);
+        *Data |= Src;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Current->Args[1]);
+        *Data |= Src;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Current->Args[1]);
+        *Data |= Src;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  Op_ATOMICXOR: {
+    auto Op = IROp->C<IR::IROp_AtomicXor>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Current->Args[1]);
+        *Data ^= Src;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint16_t*>(Current->Args[0]));
+        uint16_t Src = *GetSrc<uint16_t*>(Current->Args[1]);
+        *Data ^= Src;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Current->Args[1]);
+        *Data ^= Src;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Current->Args[1]);
+        *Data ^= Src;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  Op_ATOMICSWAP: {
+    auto Op = IROp->C<IR::IROp_AtomicSwap>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Current->Args[1]);
+        uint8_t Previous = Data->exchange(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint16_t Src = *GetSrc<uint16_t*>(Current->Args[1]);
+        uint16_t Previous = Data->exchange(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Current->Args[1]);
+        uint32_t Previous = Data->exchange(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Current->Args[1]);
+        uint64_t Previous = Data->exchange(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  Op_ATOMICFETCHADD: {
+    auto Op = IROp->C<IR::IROp_AtomicFetchAdd>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Current->Args[1]);
+        uint8_t Previous = Data->fetch_add(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint16_t Src = *GetSrc<uint16_t*>(Current->Args[1]);
+        uint16_t Previous = Data->fetch_add(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Current->Args[1]);
+        uint32_t Previous = Data->fetch_add(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Current->Args[1]);
+        uint64_t Previous = Data->fetch_add(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  Op_ATOMICFETCHSUB: {
+    auto Op = IROp->C<IR::IROp_AtomicFetchSub>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Current->Args[1]);
+        uint8_t Previous = Data->fetch_sub(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint16_t Src = *GetSrc<uint16_t*>(Current->Args[1]);
+        uint16_t Previous = Data->fetch_sub(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Current->Args[1]);
+        uint32_t Previous = Data->fetch_sub(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Current->Args[1]);
+        uint64_t Previous = Data->fetch_sub(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  Op_ATOMICFETCHAND: {
+    auto Op = IROp->C<IR::IROp_AtomicFetchAnd>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Current->Args[1]);
+        uint8_t Previous = Data->fetch_and(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint16_t Src = *GetSrc<uint16_t*>(Current->Args[1]);
+        uint16_t Previous = Data->fetch_and(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Current->Args[1]);
+        uint32_t Previous = Data->fetch_and(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Current->Args[1]);
+        uint64_t Previous = Data->fetch_and(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  Op_ATOMICFETCHOR: {
+    auto Op = IROp->C<IR::IROp_AtomicFetchOr>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Current->Args[1]);
+        uint8_t Previous = Data->fetch_or(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint16_t Src = *GetSrc<uint16_t*>(Current->Args[1]);
+        uint16_t Previous = Data->fetch_or(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Current->Args[1]);
+        uint32_t Previous = Data->fetch_or(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Current->Args[1]);
+        uint64_t Previous = Data->fetch_or(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  Op_ATOMICFETCHXOR: {
+    auto Op = IROp->C<IR::IROp_AtomicFetchXor>();
+    switch (Op->Size) {
+      case 1: {
+        std::atomic<uint8_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint8_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint8_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint8_t Src = *GetSrc<uint8_t*>(Current->Args[1]);
+        uint8_t Previous = Data->fetch_xor(Src);
+        GD = Previous;
+        break;
+      }
+      case 2: {
+        std::atomic<uint16_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint16_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint16_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint16_t Src = *GetSrc<uint16_t*>(Current->Args[1]);
+        uint16_t Previous = Data->fetch_xor(Src);
+        GD = Previous;
+        break;
+      }
+      case 4: {
+        std::atomic<uint32_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint32_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint32_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint32_t Src = *GetSrc<uint32_t*>(Current->Args[1]);
+        uint32_t Previous = Data->fetch_xor(Src);
+        GD = Previous;
+        break;
+      }
+      case 8: {
+        std::atomic<uint64_t> *Data = {};
+        if (Thread->CTX->Config.UnifiedMemory) {
+          Data = *GetSrc<std::atomic<uint64_t> **>(Op->Header.Args[0]);
+        }
+        else {
+          Data = Thread->CTX->MemoryMapper.GetPointer<std::atomic<uint64_t> *>(*GetSrc<uint64_t*>(Current->Args[0]));
+          LogMan::Throw::A(Data != nullptr, "Couldn't Map pointer to 0x%lx\n", *GetSrc<uint64_t*>(Current->Args[0]));
+        }
+        uint64_t Src = *GetSrc<uint64_t*>(Current->Args[1]);
+        uint64_t Previous = Data->fetch_xor(Src);
+        GD = Previous;
+        break;
+      }
+      default:  LogMan::Msg::A("Unhandled Atomic size: %d", Op->Size);
+    }
+    NEXT_OP();
+  }
+  // Vector ops
+  Op_CREATEVECTOR2: {
+    LogMan::Throw::A(OpSize <= 16, "Can't handle a vector of size: %d", OpSize);
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+    uint8_t ElementSize = OpSize / 2;
+    #define CREATE_VECTOR(elementsize, type) \
+      case elementsize: { \
+        auto *Dst_d = reinterpret_cast<type*>(Tmp); \
+        auto *Src1_d = reinterpret_cast<type*>(Src1); \
+        auto *Src2_d = reinterpret_cast<type*>(Src2); \
+        Dst_d[0] = *Src1_d; \
+        Dst_d[1] = *Src2_d; \
+        break; \
+      }
+    switch (ElementSize) {
+      CREATE_VECTOR(1, uint8_t)
+      CREATE_VECTOR(2, uint16_t)
+      CREATE_VECTOR(4, uint32_t)
+      CREATE_VECTOR(8, uint64_t)
+      default: LogMan::Msg::A("Unknown Element Size: %d", ElementSize); break;
+    }
+    #undef CREATE_VECTOR
+    memcpy(GDP, Tmp, OpSize);
+
+    NEXT_OP();
+  }
+  Op_SPLATVECTOR4:
+  Op_SPLATVECTOR3:
+  Op_SPLATVECTOR2: {
+    auto Op = IROp->C<IR::IROp_SplatVector2>();
+    LogMan::Throw::A(OpSize <= 16, "Can't handle a vector of size: %d", OpSize);
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t Tmp[16];
+    uint8_t Elements = 0;
+
+    switch (Op->Header.Op) {
+      case IR::OP_SPLATVECTOR4: Elements = 4; break;
+      case IR::OP_SPLATVECTOR3: Elements = 3; break;
+      case IR::OP_SPLATVECTOR2: Elements = 2; break;
+      default: LogMan::Msg::A("Uknown Splat size"); break;
+    }
+
+    #define CREATE_VECTOR(elementsize, type) \
+      case elementsize: { \
+        auto *Dst_d = reinterpret_cast<type*>(Tmp); \
+        auto *Src_d = reinterpret_cast<type*>(Src); \
+        for (uint8_t i = 0; i < Elements; ++i) \
+          Dst_d[i] = *Src_d;\
+        break; \
+      }
+    uint8_t ElementSize = OpSize / Elements;
+    switch (ElementSize) {
+      CREATE_VECTOR(1, uint8_t)
+      CREATE_VECTOR(2, uint16_t)
+      CREATE_VECTOR(4, uint32_t)
+      CREATE_VECTOR(8, uint64_t)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->Header.Size); break;
+    }
+    #undef CREATE_VECTOR
+    memcpy(GDP, Tmp, OpSize);
+
+    NEXT_OP();
+  }
+  Op_VMOV: {
+    auto Op = IROp->C<IR::IROp_VMov>();
+    __uint128_t Src = *GetSrc<__uint128_t*>(Current->Args[0]);
+
+    memcpy(GDP, &Src, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VOR: {
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(Current->Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(Current->Args[1]);
+
+    __uint128_t Dst = Src1 | Src2;
+    memcpy(GDP, &Dst, 16);
+    NEXT_OP();
+  }
+  Op_VAND: {
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(Current->Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(Current->Args[1]);
+
+    __uint128_t Dst = Src1 & Src2;
+    memcpy(GDP, &Dst, 16);
+    NEXT_OP();
+  }
+  Op_VXOR: {
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(Current->Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(Current->Args[1]);
+
+    __uint128_t Dst = Src1 ^ Src2;
+    memcpy(GDP, &Dst, 16);
+    NEXT_OP();
+  }
+  Op_VSLI: {
+    auto Op = IROp->C<IR::IROp_VSLI>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(Current->Args[0]);
+    __uint128_t Src2 = Op->ByteShift * 8;
+
+    __uint128_t Dst = Op->ByteShift >= sizeof(__uint128_t) ? 0 : Src1 << Src2;
+    memcpy(GDP, &Dst, 16);
+    NEXT_OP();
+  }
+  Op_VSRI: {
+    auto Op = IROp->C<IR::IROp_VSRI>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(Current->Args[0]);
+    __uint128_t Src2 = Op->ByteShift * 8;
+
+    __uint128_t Dst = Op->ByteShift >= sizeof(__uint128_t) ? 0 : Src1 >> Src2;
+    memcpy(GDP, &Dst, 16);
+    NEXT_OP();
+  }
+  Op_VNOT: {
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(Current->Args[0]);
+
+    __uint128_t Dst = ~Src1;
+    memcpy(GDP, &Dst, 16);
+    NEXT_OP();
+  }
+  #define DO_VECTOR_OP(size, type, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src1_d[i], Src2_d[i]);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_PAIR_OP(size, type, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src1_d[i*2], Src1_d[i*2 + 1]);          \
+      Dst_d[i+Elements] = func(Src2_d[i*2], Src2_d[i*2 + 1]);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_SCALAR_OP(size, type, func)\
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src1_d[i], *Src2_d);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_1SRC_OP(size, type, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src_d = reinterpret_cast<type*>(Src); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src_d[i]);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_SAT_OP(size, type, func, min, max)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src1_d[i], Src2_d[i], min, max);          \
+    }                                                 \
+    break;                                            \
+    }
+
+  Op_VUSHRI: {
+    auto Op = IROp->C<IR::IROp_VUShrI>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t BitShift = Op->BitShift;
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? 0 : a >> BitShift; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_OP(1, uint8_t, Func)
+      DO_VECTOR_1SRC_OP(2, uint16_t, Func)
+      DO_VECTOR_1SRC_OP(4, uint32_t, Func)
+      DO_VECTOR_1SRC_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSSHRI: {
+    auto Op = IROp->C<IR::IROp_VSShrI>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t BitShift = Op->BitShift;
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> BitShift; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_OP(1, int8_t, Func)
+      DO_VECTOR_1SRC_OP(2, int16_t, Func)
+      DO_VECTOR_1SRC_OP(4, int32_t, Func)
+      DO_VECTOR_1SRC_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSHLI: {
+    auto Op = IROp->C<IR::IROp_VShlI>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t BitShift = Op->BitShift;
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [BitShift](auto a) { return BitShift >= (sizeof(a) * 8) ? 0 : (a << BitShift); };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_OP(1, uint8_t, Func)
+      DO_VECTOR_1SRC_OP(2, uint16_t, Func)
+      DO_VECTOR_1SRC_OP(4, uint32_t, Func)
+      DO_VECTOR_1SRC_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+
+  Op_VADD: {
+    auto Op = IROp->C<IR::IROp_VAdd>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return a + b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSUB: {
+    auto Op = IROp->C<IR::IROp_VSub>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return a - b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VUQADD: {
+    auto Op = IROp->C<IR::IROp_VUQAdd>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) {
+      decltype(a) res = a + b;
+      return res < a ? ~0U : res;
+    };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VUQSUB: {
+    auto Op = IROp->C<IR::IROp_VUQSub>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) {
+      decltype(a) res = a - b;
+      return res > a ? 0U : res;
+    };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSQADD: {
+    auto Op = IROp->C<IR::IROp_VSQAdd>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) {
+      decltype(a) res = a + b;
+
+      if (a > 0) {
+        if (b > (std::numeric_limits<decltype(a)>::max() - a)) {
+          return std::numeric_limits<decltype(a)>::max();
+        }
+      }
+      else if (b < (std::numeric_limits<decltype(a)>::min() - a)) {
+        return std::numeric_limits<decltype(a)>::min();
+      }
+
+      return res;
+    };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, int8_t,  Func)
+      DO_VECTOR_OP(2, int16_t, Func)
+      DO_VECTOR_OP(4, int32_t, Func)
+      DO_VECTOR_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSQSUB: {
+    auto Op = IROp->C<IR::IROp_VSQSub>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) {
+      __int128_t res = a - b;
+      if (res < std::numeric_limits<decltype(a)>::min())
+        return std::numeric_limits<decltype(a)>::min();
+
+      if (res > std::numeric_limits<decltype(a)>::max())
+        return std::numeric_limits<decltype(a)>::max();
+      return (decltype(a))res;
+    };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, int8_t,  Func)
+      DO_VECTOR_OP(2, int16_t, Func)
+      DO_VECTOR_OP(4, int32_t, Func)
+      DO_VECTOR_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+
+  Op_VFADD: {
+    auto Op = IROp->C<IR::IROp_VFAdd>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return a + b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VFSUB: {
+    auto Op = IROp->C<IR::IROp_VFSub>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return a - b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VADDP: {
+    auto Op = IROp->C<IR::IROp_VAddP>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return a + b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_PAIR_OP(1, uint8_t,  Func)
+      DO_VECTOR_PAIR_OP(2, uint16_t, Func)
+      DO_VECTOR_PAIR_OP(4, uint32_t, Func)
+      DO_VECTOR_PAIR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VFMUL: {
+    auto Op = IROp->C<IR::IROp_VFMul>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VFDIV: {
+    auto Op = IROp->C<IR::IROp_VFDiv>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return a / b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VFMIN: {
+    auto Op = IROp->C<IR::IROp_VFMin>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return std::min(a, b); };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VFMAX: {
+    auto Op = IROp->C<IR::IROp_VFMax>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return std::max(a, b); };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(4, float, Func)
+      DO_VECTOR_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VFRECP: {
+    auto Op = IROp->C<IR::IROp_VFRecp>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a) { return 1.0 / a; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_OP(4, float, Func)
+      DO_VECTOR_1SRC_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VFSQRT: {
+    auto Op = IROp->C<IR::IROp_VFSqrt>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a) { return std::sqrt(a); };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_OP(4, float, Func)
+      DO_VECTOR_1SRC_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VFRSQRT: {
+    auto Op = IROp->C<IR::IROp_VFRSqrt>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a) { return 1.0 / std::sqrt(a); };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_OP(4, float, Func)
+      DO_VECTOR_1SRC_OP(8, double, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  #define DO_VECTOR_1SRC_2TYPE_OP(size, type, type2, func, min, max)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src_d = reinterpret_cast<type2*>(Src); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = (type)func(Src_d[i], min, max);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_1SRC_2TYPE_OP_TOP(size, type, type2, func, min, max)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src_d = reinterpret_cast<type2*>(Src2); \
+    memcpy(Dst_d, Src1, Elements * sizeof(type2));\
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i+Elements] = (type)func(Src_d[i], min, max);          \
+    }                                                 \
+    break;                                            \
+    }
+
+  #define DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(size, type, type2, func, min, max)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src_d = reinterpret_cast<type2*>(Src); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = (type)func(Src_d[i+Elements], min, max);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_2SRC_2TYPE_OP(size, type, type2, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type2*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type2*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = (type)func((type)Src1_d[i], (type)Src2_d[i]);          \
+    }                                                 \
+    break;                                            \
+    }
+  #define DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(size, type, type2, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type2*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type2*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = (type)func((type)Src1_d[i+Elements], (type)Src2_d[i+Elements]);          \
+    }                                                 \
+    break;                                            \
+    }
+
+  Op_VUSHRNI: {
+    auto Op = IROp->C<IR::IROp_VUShrNI>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t BitShift = Op->BitShift;
+    uint8_t Tmp[16]{};
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [BitShift](auto a, auto min, auto max) { return BitShift >= (sizeof(a) * 8) ? 0 : a >> BitShift; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(2, uint8_t, uint16_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(4, uint16_t, uint32_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(8, uint32_t, uint64_t, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VUSHRNI2: {
+    auto Op = IROp->C<IR::IROp_VUShrNI2>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t BitShift = Op->BitShift;
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [BitShift](auto a, auto min, auto max) { return BitShift >= (sizeof(a) * 8) ? 0 : a >> BitShift; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP_TOP(2, uint8_t, uint16_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP_TOP(4, uint16_t, uint32_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP_TOP(8, uint32_t, uint64_t, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSQXTN: {
+    auto Op = IROp->C<IR::IROp_VSQXTN>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t Tmp[16]{};
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))min); };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(2, int8_t, int16_t, Func, std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max())
+      DO_VECTOR_1SRC_2TYPE_OP(4, int16_t, int32_t, Func, std::numeric_limits<int16_t>::min(), std::numeric_limits<int16_t>::max())
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSQXTN2: {
+    auto Op = IROp->C<IR::IROp_VSQXTN2>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16]{};
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))min); };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP_TOP(2, int8_t, int16_t, Func, std::numeric_limits<int8_t>::min(), std::numeric_limits<int8_t>::max())
+      DO_VECTOR_1SRC_2TYPE_OP_TOP(4, int16_t, int32_t, Func, std::numeric_limits<int16_t>::min(), std::numeric_limits<int16_t>::max())
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSQXTUN: {
+    auto Op = IROp->C<IR::IROp_VSQXTUN>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t Tmp[16]{};
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))min); };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(2, uint8_t, int16_t, Func, 0, (1 << 8) - 1)
+      DO_VECTOR_1SRC_2TYPE_OP(4, uint16_t, int32_t, Func, 0, (1 << 16) - 1)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSQXTUN2: {
+    auto Op = IROp->C<IR::IROp_VSQXTUN2>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16]{};
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return std::max(std::min(a, (decltype(a))max), (decltype(a))min); };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP_TOP(2, uint8_t, int16_t, Func, 0, (1 << 8) - 1)
+      DO_VECTOR_1SRC_2TYPE_OP_TOP(4, uint16_t, int32_t, Func, 0, (1 << 16) - 1)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VECTOR_UTOF: {
+    auto Op = IROp->C<IR::IROp_Vector_UToF>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(4, float, uint32_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(8, double, uint64_t, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VECTOR_STOF: {
+    auto Op = IROp->C<IR::IROp_Vector_SToF>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(4, float, int32_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(8, double, int64_t, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VECTOR_FTOZU: {
+    auto Op = IROp->C<IR::IROp_Vector_FToZU>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(4, uint32_t, float, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(8, uint64_t, double, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VECTOR_FTOZS: {
+    auto Op = IROp->C<IR::IROp_Vector_FToZS>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(4, int32_t, float, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(8, int64_t, double, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VUMUL: {
+    auto Op = IROp->C<IR::IROp_VUMul>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSMUL: {
+    auto Op = IROp->C<IR::IROp_VSMul>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, int8_t,  Func)
+      DO_VECTOR_OP(2, int16_t, Func)
+      DO_VECTOR_OP(4, int32_t, Func)
+      DO_VECTOR_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VUMULL: {
+    auto Op = IROp->C<IR::IROp_VUMull>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / (Op->ElementSize << 1);
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_2SRC_2TYPE_OP(1, uint16_t, uint8_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP(2, uint32_t, uint16_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP(4, uint64_t, uint32_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSMULL: {
+    auto Op = IROp->C<IR::IROp_VSMull>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / (Op->ElementSize << 1);
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_2SRC_2TYPE_OP(1, int16_t, int8_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP(2, int32_t, int16_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP(4, int64_t, int32_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VUMULL2: {
+    auto Op = IROp->C<IR::IROp_VUMull2>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / (Op->ElementSize << 1);
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(1, uint16_t, uint8_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(2, uint32_t, uint16_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(4, uint64_t, uint32_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSMULL2: {
+    auto Op = IROp->C<IR::IROp_VSMull2>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / (Op->ElementSize << 1);
+
+    auto Func = [](auto a, auto b) { return a * b; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(1, int16_t, int8_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(2, int32_t, int16_t, Func)
+      DO_VECTOR_2SRC_2TYPE_OP_TOP_SRC(4, int64_t, int32_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSXTL: {
+    auto Op = IROp->C<IR::IROp_VSXTL>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t Tmp[16]{};
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(1, int16_t, int8_t, Func,  0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(2, int32_t, int16_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(4, int64_t, int32_t, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSXTL2: {
+    auto Op = IROp->C<IR::IROp_VSXTL2>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / (Op->ElementSize << 1);
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(1, int16_t, int8_t, Func,  0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(2, int32_t, int16_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(4, int64_t, int32_t, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VUXTL: {
+    auto Op = IROp->C<IR::IROp_VUXTL>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t Tmp[16]{};
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP(1, uint16_t, uint8_t, Func,  0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(2, uint32_t, uint16_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP(4, uint64_t, uint32_t, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VUXTL2: {
+    auto Op = IROp->C<IR::IROp_VUXTL2>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / (Op->ElementSize << 1);
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Op->ElementSize) {
+      DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(1, uint16_t, uint8_t, Func,  0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(2, uint32_t, uint16_t, Func, 0, 0)
+      DO_VECTOR_1SRC_2TYPE_OP_TOP_SRC(4, uint64_t, uint32_t, Func, 0, 0)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VUMIN: {
+    auto Op = IROp->C<IR::IROp_VUMin>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return std::min(a, b); };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSMIN: {
+    auto Op = IROp->C<IR::IROp_VSMin>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return std::min(a, b); };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, int8_t,  Func)
+      DO_VECTOR_OP(2, int16_t, Func)
+      DO_VECTOR_OP(4, int32_t, Func)
+      DO_VECTOR_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VUMAX: {
+    auto Op = IROp->C<IR::IROp_VUMax>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return std::max(a, b); };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSMAX: {
+    auto Op = IROp->C<IR::IROp_VSMax>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return std::max(a, b); };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, int8_t,  Func)
+      DO_VECTOR_OP(2, int16_t, Func)
+      DO_VECTOR_OP(4, int32_t, Func)
+      DO_VECTOR_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VUSHL: {
+    auto Op = IROp->C<IR::IROp_VUShl>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a << b; };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSSHR: {
+    auto Op = IROp->C<IR::IROp_VSShr>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> b; };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, int8_t,  Func)
+      DO_VECTOR_OP(2, int16_t, Func)
+      DO_VECTOR_OP(4, int32_t, Func)
+      DO_VECTOR_OP(8, int64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+
+  Op_VUSHLS: {
+    auto Op = IROp->C<IR::IROp_VUShlS>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a << b; };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_SCALAR_OP(1, uint8_t, Func)
+      DO_VECTOR_SCALAR_OP(2, uint16_t, Func)
+      DO_VECTOR_SCALAR_OP(4, uint32_t, Func)
+      DO_VECTOR_SCALAR_OP(8, uint64_t, Func)
+      DO_VECTOR_SCALAR_OP(16, __uint128_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VUSHRS: {
+    auto Op = IROp->C<IR::IROp_VUShrS>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a >> b; };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_SCALAR_OP(1, uint8_t, Func)
+      DO_VECTOR_SCALAR_OP(2, uint16_t, Func)
+      DO_VECTOR_SCALAR_OP(4, uint32_t, Func)
+      DO_VECTOR_SCALAR_OP(8, uint64_t, Func)
+      DO_VECTOR_SCALAR_OP(16, __uint128_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VSSHRS: {
+    auto Op = IROp->C<IR::IROp_VSShrS>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? (a >> (sizeof(a) * 8 - 1)) : a >> b; };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_SCALAR_OP(1, int8_t, Func)
+      DO_VECTOR_SCALAR_OP(2, int16_t, Func)
+      DO_VECTOR_SCALAR_OP(4, int32_t, Func)
+      DO_VECTOR_SCALAR_OP(8, int64_t, Func)
+      DO_VECTOR_SCALAR_OP(16, __int128_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VUSHR: {
+    auto Op = IROp->C<IR::IROp_VUShr>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return b >= (sizeof(a) * 8) ? 0 : a >> b; };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,  Func)
+      DO_VECTOR_OP(2, uint16_t, Func)
+      DO_VECTOR_OP(4, uint32_t, Func)
+      DO_VECTOR_OP(8, uint64_t, Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VZIP2:
+  Op_VZIP: {
+    auto Op = IROp->C<IR::IROp_VZip>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    uint8_t BaseOffset = IROp->Op == IR::OP_VZIP2 ? (Elements / 2) : 0;
+    Elements >>= 1;
+
+    switch (Op->ElementSize) {
+      case 1: {
+        auto *Dst_d  = reinterpret_cast<uint8_t*>(Tmp);
+        auto *Src1_d = reinterpret_cast<uint8_t*>(Src1);
+        auto *Src2_d = reinterpret_cast<uint8_t*>(Src2);
+        for (unsigned i = 0; i < Elements; ++i) {
+          Dst_d[i*2] = Src1_d[BaseOffset + i];
+          Dst_d[i*2+1] = Src2_d[BaseOffset + i];
+        }
+        break;
+      }
+      case 2: {
+        auto *Dst_d  = reinterpret_cast<uint16_t*>(Tmp);
+        auto *Src1_d = reinterpret_cast<uint16_t*>(Src1);
+        auto *Src2_d = reinterpret_cast<uint16_t*>(Src2);
+        for (unsigned i = 0; i < Elements; ++i) {
+          Dst_d[i*2] = Src1_d[BaseOffset + i];
+          Dst_d[i*2+1] = Src2_d[BaseOffset + i];
+        }
+        break;
+      }
+      case 4: {
+        auto *Dst_d  = reinterpret_cast<uint32_t*>(Tmp);
+        auto *Src1_d = reinterpret_cast<uint32_t*>(Src1);
+        auto *Src2_d = reinterpret_cast<uint32_t*>(Src2);
+        for (unsigned i = 0; i < Elements; ++i) {
+          Dst_d[i*2] = Src1_d[BaseOffset + i];
+          Dst_d[i*2+1] = Src2_d[BaseOffset + i];
+        }
+        break;
+      }
+      case 8: {
+        auto *Dst_d  = reinterpret_cast<uint64_t*>(Tmp);
+        auto *Src1_d = reinterpret_cast<uint64_t*>(Src1);
+        auto *Src2_d = reinterpret_cast<uint64_t*>(Src2);
+        for (unsigned i = 0; i < Elements; ++i) {
+          Dst_d[i*2] = Src1_d[BaseOffset + i];
+          Dst_d[i*2+1] = Src2_d[BaseOffset + i];
+        }
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VINSELEMENT: {
+    auto Op = IROp->C<IR::IROp_VInsElement>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    // Copy src1 in to dest
+    memcpy(Tmp, Src1, Op->RegisterSize);
+    switch (Op->ElementSize) {
+      case 1: {
+        auto *Dst_d  = reinterpret_cast<uint8_t*>(Tmp);
+        auto *Src2_d = reinterpret_cast<uint8_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
+        break;
+      }
+      case 2: {
+        auto *Dst_d  = reinterpret_cast<uint16_t*>(Tmp);
+        auto *Src2_d = reinterpret_cast<uint16_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
+        break;
+      }
+      case 4: {
+        auto *Dst_d  = reinterpret_cast<uint32_t*>(Tmp);
+        auto *Src2_d = reinterpret_cast<uint32_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
+        break;
+      }
+      case 8: {
+        auto *Dst_d  = reinterpret_cast<uint64_t*>(Tmp);
+        auto *Src2_d = reinterpret_cast<uint64_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    };
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VINSSCALARELEMENT: {
+    auto Op = IROp->C<IR::IROp_VInsScalarElement>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    // Copy src1 in to dest
+    memcpy(Tmp, Src1, Op->RegisterSize);
+    switch (Op->ElementSize) {
+      case 1: {
+        auto *Dst_d  = reinterpret_cast<uint8_t*>(Tmp);
+        auto Src2_d = *reinterpret_cast<uint8_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d;
+        break;
+      }
+      case 2: {
+        auto *Dst_d  = reinterpret_cast<uint16_t*>(Tmp);
+        auto Src2_d = *reinterpret_cast<uint16_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d;
+        break;
+      }
+      case 4: {
+        auto *Dst_d  = reinterpret_cast<uint32_t*>(Tmp);
+        auto Src2_d = *reinterpret_cast<uint32_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d;
+        break;
+      }
+      case 8: {
+        auto *Dst_d  = reinterpret_cast<uint64_t*>(Tmp);
+        auto Src2_d = *reinterpret_cast<uint64_t*>(Src2);
+        Dst_d[Op->DestIdx] = Src2_d;
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    };
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VCMPEQ: {
+    auto Op = IROp->C<IR::IROp_VCMPEQ>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return a == b ? ~0ULL : 0; };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, uint8_t,   Func)
+      DO_VECTOR_OP(2, uint16_t,  Func)
+      DO_VECTOR_OP(4, uint32_t,  Func)
+      DO_VECTOR_OP(8, uint64_t,  Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VCMPGT: {
+    auto Op = IROp->C<IR::IROp_VCMPGT>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+    uint8_t Tmp[16];
+
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+    auto Func = [](auto a, auto b) { return a > b ? ~0ULL : 0; };
+
+    switch (Op->ElementSize) {
+      DO_VECTOR_OP(1, int8_t,   Func)
+      DO_VECTOR_OP(2, int16_t,  Func)
+      DO_VECTOR_OP(4, int32_t,  Func)
+      DO_VECTOR_OP(8, int64_t,  Func)
+      default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+    }
+
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_LUDIV: {
+    // Each source is OpSize in size
+    // So you can have up to a 128bit divide from x86-64
+    switch (OpSize) {
+      case 2: {
+        uint16_t SrcLow = *GetSrc<uint16_t*>(Current->Args[0]);
+        uint16_t SrcHigh = *GetSrc<uint16_t*>(Current->Args[1]);
+        uint16_t Divisor = *GetSrc<uint16_t*>(Current->Args[2]);
+        uint32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
+        uint32_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<uint16_t>(Res);
+        break;
+      }
+      case 4: {
+        uint32_t SrcLow = *GetSrc<uint32_t*>(Current->Args[0]);
+        uint32_t SrcHigh = *GetSrc<uint32_t*>(Current->Args[1]);
+        uint32_t Divisor = *GetSrc<uint32_t*>(Current->Args[2]);
+        uint64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
+        uint64_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<uint32_t>(Res);
+        break;
+      }
+      case 8: {
+        uint64_t SrcLow = *GetSrc<uint64_t*>(Current->Args[0]);
+        uint64_t SrcHigh = *GetSrc<uint64_t*>(Current->Args[1]);
+        uint64_t Divisor = *GetSrc<uint64_t*>(Current->Args[2]);
+        __uint128_t Source = (static_cast<__uint128_t>(SrcHigh) << 64) | SrcLow;
+        __uint128_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        memcpy(GDP, &Res, OpSize);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown LUDIV Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_LDIV: {
+    // Each source is OpSize in size
+    // So you can have up to a 128bit divide from x86-64
+    switch (OpSize) {
+      case 2: {
+        uint16_t SrcLow = *GetSrc<uint16_t*>(Current->Args[0]);
+        uint16_t SrcHigh = *GetSrc<uint16_t*>(Current->Args[1]);
+        int16_t Divisor = *GetSrc<uint16_t*>(Current->Args[2]);
+        int32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
+        int32_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<int16_t>(Res);
+        break;
+      }
+      case 4: {
+        uint32_t SrcLow = *GetSrc<uint32_t*>(Current->Args[0]);
+        uint32_t SrcHigh = *GetSrc<uint32_t*>(Current->Args[1]);
+        int32_t Divisor = *GetSrc<uint32_t*>(Current->Args[2]);
+        int64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
+        int64_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<int32_t>(Res);
+        break;
+      }
+      case 8: {
+        uint64_t SrcLow = *GetSrc<uint64_t*>(Current->Args[0]);
+        uint64_t SrcHigh = *GetSrc<uint64_t*>(Current->Args[1]);
+        int64_t Divisor = *GetSrc<int64_t*>(Current->Args[2]);
+        __int128_t Source = (static_cast<__int128_t>(SrcHigh) << 64) | SrcLow;
+        __int128_t Res = Source / Divisor;
+
+        // We only store the lower bits of the result
+        memcpy(GDP, &Res, OpSize);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown LDIV Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_LUREM: {
+    // Each source is OpSize in size
+    // So you can have up to a 128bit Remainder from x86-64
+    switch (OpSize) {
+      case 2: {
+        uint16_t SrcLow = *GetSrc<uint16_t*>(Current->Args[0]);
+        uint16_t SrcHigh = *GetSrc<uint16_t*>(Current->Args[1]);
+        uint16_t Divisor = *GetSrc<uint16_t*>(Current->Args[2]);
+        uint32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
+        uint32_t Res = Source % Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<uint16_t>(Res);
+        break;
+      }
+
+      case 4: {
+        uint32_t SrcLow = *GetSrc<uint32_t*>(Current->Args[0]);
+        uint32_t SrcHigh = *GetSrc<uint32_t*>(Current->Args[1]);
+        uint32_t Divisor = *GetSrc<uint32_t*>(Current->Args[2]);
+        uint64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
+        uint64_t Res = Source % Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<uint32_t>(Res);
+        break;
+      }
+      case 8: {
+        uint64_t SrcLow = *GetSrc<uint64_t*>(Current->Args[0]);
+        uint64_t SrcHigh = *GetSrc<uint64_t*>(Current->Args[1]);
+        uint64_t Divisor = *GetSrc<uint64_t*>(Current->Args[2]);
+        __uint128_t Source = (static_cast<__uint128_t>(SrcHigh) << 64) | SrcLow;
+        __uint128_t Res = Source % Divisor;
+        // We only store the lower bits of the result
+        memcpy(GDP, &Res, OpSize);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown LUREM Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_LREM: {
+    // Each source is OpSize in size
+    // So you can have up to a 128bit Remainder from x86-64
+    switch (OpSize) {
+      case 2: {
+        uint16_t SrcLow = *GetSrc<uint16_t*>(Current->Args[0]);
+        uint16_t SrcHigh = *GetSrc<uint16_t*>(Current->Args[1]);
+        int16_t Divisor = *GetSrc<uint16_t*>(Current->Args[2]);
+        int32_t Source = (static_cast<uint32_t>(SrcHigh) << 16) | SrcLow;
+        int32_t Res = Source % Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<int16_t>(Res);
+        break;
+      }
+      case 4: {
+        uint32_t SrcLow = *GetSrc<uint32_t*>(Current->Args[0]);
+        uint32_t SrcHigh = *GetSrc<uint32_t*>(Current->Args[1]);
+        int32_t Divisor = *GetSrc<uint32_t*>(Current->Args[2]);
+        int64_t Source = (static_cast<uint64_t>(SrcHigh) << 32) | SrcLow;
+        int64_t Res = Source % Divisor;
+
+        // We only store the lower bits of the result
+        GD = static_cast<int32_t>(Res);
+        break;
+      }
+      case 8: {
+        uint64_t SrcLow = *GetSrc<uint64_t*>(Current->Args[0]);
+        uint64_t SrcHigh = *GetSrc<uint64_t*>(Current->Args[1]);
+        int64_t Divisor = *GetSrc<int64_t*>(Current->Args[2]);
+        __int128_t Source = (static_cast<__int128_t>(SrcHigh) << 64) | SrcLow;
+        __int128_t Res = Source % Divisor;
+        // We only store the lower bits of the result
+        memcpy(GDP, &Res, OpSize);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown LREM Size: %d", OpSize); break;
+    }
+    NEXT_OP();
+  }
+  Op_VEXTR: {
+    auto Op = IROp->C<IR::IROp_VExtr>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(Current->Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(Current->Args[1]);
+
+    uint64_t Offset = Op->Index * Op->ElementSize * 8;
+    __uint128_t Dst = (Src1 << (sizeof(__uint128_t) * 8 - Offset)) | (Src2 >> Offset);
+
+    memcpy(GDP, &Dst, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VINSGPR: {
+    auto Op = IROp->C<IR::IROp_VInsGPR>();
+    __uint128_t Src1 = *GetSrc<__uint128_t*>(Current->Args[0]);
+    __uint128_t Src2 = *GetSrc<__uint128_t*>(Current->Args[1]);
+
+    uint64_t Offset = Op->Index * Op->ElementSize * 8;
+    __uint128_t Mask = (1ULL << (Op->ElementSize * 8)) - 1;
+    Mask <<= Offset;
+    Mask = ~Mask;
+    __uint128_t Dst = Src1 & Mask;
+    Dst |= Src2 << Offset;
+
+    memcpy(GDP, &Dst, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_FLOAT_FROMGPR_S: {
+    auto Op = IROp->C<IR::IROp_Float_FromGPR_S>();
+    if (Op->ElementSize == 8) {
+      double Dst = (double)*GetSrc<int64_t*>(Current->Args[0]);
+      memcpy(GDP, &Dst, Op->ElementSize);
+    }
+    else {
+      float Dst = (float)*GetSrc<int32_t*>(Current->Args[0]);
+      memcpy(GDP, &Dst, Op->ElementSize);
+    }
+    NEXT_OP();
+  }
+  Op_FLOAT_FROMGPR_U: {
+    auto Op = IROp->C<IR::IROp_Float_FromGPR_U>();
+    if (Op->ElementSize == 8) {
+      double Dst = (double)*GetSrc<uint64_t*>(Current->Args[0]);
+      memcpy(GDP, &Dst, Op->ElementSize);
+    }
+    else {
+      float Dst = (float)*GetSrc<uint32_t*>(Current->Args[0]);
+      memcpy(GDP, &Dst, Op->ElementSize);
+    }
+    NEXT_OP();
+  }
+  Op_FLOAT_TOGPR_ZS: {
+    auto Op = IROp->C<IR::IROp_Float_ToGPR_ZS>();
+    if (Op->ElementSize == 8) {
+      int64_t Dst = (int64_t)*GetSrc<double*>(Current->Args[0]);
+      memcpy(GDP, &Dst, Op->ElementSize);
+    }
+    else {
+      int32_t Dst = (int32_t)*GetSrc<float*>(Current->Args[0]);
+      memcpy(GDP, &Dst, Op->ElementSize);
+    }
+    NEXT_OP();
+  }
+  Op_FLOAT_TOGPR_ZU: {
+    auto Op = IROp->C<IR::IROp_Float_ToGPR_ZU>();
+    if (Op->ElementSize == 8) {
+      uint64_t Dst = (uint64_t)*GetSrc<double*>(Current->Args[0]);
+      memcpy(GDP, &Dst, Op->ElementSize);
+    }
+    else {
+      uint32_t Dst = (uint32_t)*GetSrc<float*>(Current->Args[0]);
+      memcpy(GDP, &Dst, Op->ElementSize);
+    }
+    NEXT_OP();
+  }
+  Op_FLOAT_FTOF: {
+    auto Op = IROp->C<IR::IROp_Float_FToF>();
+    uint16_t Conv = (Op->DstElementSize << 8) | Op->SrcElementSize;
+    switch (Conv) {
+      case 0x0804: { // Double <- Float
+        double Dst = (double)*GetSrc<float*>(Current->Args[0]);
+        memcpy(GDP, &Dst, 8);
+        break;
+      }
+      case 0x0408: { // Float <- Double
+        float Dst = (float)*GetSrc<double*>(Current->Args[0]);
+        memcpy(GDP, &Dst, 4);
+        break;
+      }
+      default: LogMan::Msg::A("Unknown FCVT sizes: 0x%x", Conv);
+    }
+    NEXT_OP();
+  }
+  Op_VECTOR_FTOF: {
+    auto Op = IROp->C<IR::IROp_Vector_FToF>();
+    void *Src = GetSrc<void*>(Current->Args[0]);
+    uint8_t Tmp[16]{};
+
+    uint16_t Conv = (Op->DstElementSize << 8) | Op->SrcElementSize;
+
+    auto Func = [](auto a, auto min, auto max) { return a; };
+    switch (Conv) {
+      case 0x0804: { // Double <- float
+        uint8_t Elements = Op->RegisterSize / Op->SrcElementSize;
+        switch (Op->SrcElementSize) {
+        DO_VECTOR_1SRC_2TYPE_OP(4, double, float, Func, 0, 0)
+        }
+        break;
+      }
+      case 0x0408: { // Float <- Double
+        uint8_t Elements = Op->RegisterSize / Op->SrcElementSize;
+        switch (Op->SrcElementSize) {
+        DO_VECTOR_1SRC_2TYPE_OP(8, float, double, Func, 0, 0)
+        }
+        break;
+
+        break;
+      }
+      default: LogMan::Msg::A("Unknown Conversion Type : 0%04x", Conv); break;
+    }
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_FCMP: {
+    auto Op = IROp->C<IR::IROp_FCmp>();
+    uint32_t ResultFlags{};
+    if (Op->ElementSize == 4) {
+      float Src1 = *GetSrc<float*>(Current->Args[0]);
+      float Src2 = *GetSrc<float*>(Current->Args[1]);
+      if (Op->Flags & (1 << FCMP_FLAG_LT)) {
+        if (Src1 < Src2) {
+          ResultFlags |= (1 << FCMP_FLAG_LT);
+        }
+      }
+      if (Op->Flags & (1 << FCMP_FLAG_UNORDERED)) {
+        if (std::isnan(Src1) || std::isnan(Src2)) {
+          ResultFlags |= (1 << FCMP_FLAG_UNORDERED);
+        }
+      }
+      if (Op->Flags & (1 << FCMP_FLAG_EQ)) {
+        if (Src1 == Src2) {
+          ResultFlags |= (1 << FCMP_FLAG_EQ);
+        }
+      }
+    }
+    else {
+      double Src1 = *GetSrc<double*>(Current->Args[0]);
+      double Src2 = *GetSrc<double*>(Current->Args[1]);
+      if (Op->Flags & (1 << FCMP_FLAG_LT)) {
+        if (Src1 < Src2) {
+          ResultFlags |= (1 << FCMP_FLAG_LT);
+        }
+      }
+      if (Op->Flags & (1 << FCMP_FLAG_UNORDERED)) {
+        if (std::isnan(Src1) || std::isnan(Src2)) {
+          ResultFlags |= (1 << FCMP_FLAG_UNORDERED);
+        }
+      }
+      if (Op->Flags & (1 << FCMP_FLAG_EQ)) {
+        if (Src1 == Src2) {
+          ResultFlags |= (1 << FCMP_FLAG_EQ);
+        }
+      }
+    }
+
+    GD = ResultFlags;
+    NEXT_OP();
+  }
+  Op_GETHOSTFLAG: {
+    auto Op = IROp->C<IR::IROp_GetHostFlag>();
+    GD = (*GetSrc<uint64_t*>(Current->Args[0]) >> Op->Flag) & 1;
+    NEXT_OP();
+  }
+  #define DO_SCALAR_COMPARE_OP(size, type, type2, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type2*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    Dst_d[0] = func(Src1_d[0], Src2_d[0]);          \
+    break;                                            \
+    }
+
+  #define DO_VECTOR_COMPARE_OP(size, type, type2, func)              \
+    case size: {                                      \
+    auto *Dst_d  = reinterpret_cast<type2*>(Tmp);  \
+    auto *Src1_d = reinterpret_cast<type*>(Src1); \
+    auto *Src2_d = reinterpret_cast<type*>(Src2); \
+    for (uint8_t i = 0; i < Elements; ++i) {          \
+      Dst_d[i] = func(Src1_d[i], Src2_d[i]);          \
+    }                                                 \
+    break;                                            \
+    }
+
+  Op_VFCMPEQ: {
+    auto Op = IROp->C<IR::IROp_VFCMPEQ>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+
+    auto Func = [](auto a, auto b) { return a == b ? ~0ULL : 0; };
+
+    uint8_t Tmp[16];
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    if (Op->ElementSize == Op->RegisterSize) {
+      switch (Op->ElementSize) {
+      DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+    else {
+      switch (Op->ElementSize) {
+      DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VFCMPNEQ: {
+    auto Op = IROp->C<IR::IROp_VFCMPNEQ>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+
+    auto Func = [](auto a, auto b) { return a != b ? ~0ULL : 0; };
+
+    uint8_t Tmp[16];
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    if (Op->ElementSize == Op->RegisterSize) {
+      switch (Op->ElementSize) {
+      DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+    else {
+      switch (Op->ElementSize) {
+      DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VFCMPLT: {
+    auto Op = IROp->C<IR::IROp_VFCMPLT>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+
+    auto Func = [](auto a, auto b) { return a < b ? ~0ULL : 0; };
+
+    uint8_t Tmp[16];
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    if (Op->ElementSize == Op->RegisterSize) {
+      switch (Op->ElementSize) {
+      DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+    else {
+      switch (Op->ElementSize) {
+      DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VFCMPLE: {
+    auto Op = IROp->C<IR::IROp_VFCMPLE>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+
+    auto Func = [](auto a, auto b) { return a <= b ? ~0ULL : 0; };
+
+    uint8_t Tmp[16];
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    if (Op->ElementSize == Op->RegisterSize) {
+      switch (Op->ElementSize) {
+      DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+    else {
+      switch (Op->ElementSize) {
+      DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VFCMPUNO: {
+    auto Op = IROp->C<IR::IROp_VFCMPUNO>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+
+    auto Func = [](auto a, auto b) { return (std::isnan(a) || std::isnan(b)) ? ~0ULL : 0; };
+
+    uint8_t Tmp[16];
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    if (Op->ElementSize == Op->RegisterSize) {
+      switch (Op->ElementSize) {
+      DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+    else {
+      switch (Op->ElementSize) {
+      DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_VFCMPORD: {
+    auto Op = IROp->C<IR::IROp_VFCMPORD>();
+    void *Src1 = GetSrc<void*>(Current->Args[0]);
+    void *Src2 = GetSrc<void*>(Current->Args[1]);
+
+    auto Func = [](auto a, auto b) { return (!std::isnan(a) && !std::isnan(b)) ? ~0ULL : 0; };
+
+    uint8_t Tmp[16];
+    uint8_t Elements = Op->RegisterSize / Op->ElementSize;
+
+    if (Op->ElementSize == Op->RegisterSize) {
+      switch (Op->ElementSize) {
+      DO_SCALAR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_SCALAR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+    else {
+      switch (Op->ElementSize) {
+      DO_VECTOR_COMPARE_OP(4, float, uint32_t, Func);
+      DO_VECTOR_COMPARE_OP(8, double, uint64_t, Func);
+      default: LogMan::Msg::A("Unsupported elementSize: %d", Op->ElementSize);
+      }
+    }
+
+    memcpy(GDP, Tmp, Op->RegisterSize);
+    NEXT_OP();
+  }
+  Op_Unhandled:
+    LogMan::Msg::A("Unknown IR Op: %d(%s)", IROp->Op, FEXCore::IR::GetName(IROp->Op).data());
+    NEXT_OP();
+
+Exit:
+#undef NEXT_OP
+#undef DISPATCH
+#undef GDP
+#undef GD
 
-  Thread->Stats.InstructionsExecuted.fetch_add(DebugData->second.GuestInstructionCount);
+  Thread->Stats.InstructionsExecuted.fetch_add(DebugData->GuestInstructionCount);
 }
 
-FEXCore::CPU::CPUBackend *CreateInterpreterCore(FEXCore::Context::Context *ctx) {
-  return new InterpreterCore(ctx);
+FEXCore::CPU::CPUBackend *CreateInterpreterCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread) {
+  return new InterpreterCore(ctx, Thread);
 }
 
 }
@@ -4,9 +4,13 @@ namespace FEXCore::Context {
 struct Context;
 }
 
+namespace FEXCore::Core {
+struct InternalThreadState;
+}
+
 namespace FEXCore::CPU {
 class CPUBackend;
 
-FEXCore::CPU::CPUBackend *CreateInterpreterCore(FEXCore::Context::Context *ctx);
+FEXCore::CPU::CPUBackend *CreateInterpreterCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread);
 
 }
@@ -2,6 +2,7 @@
 
 #include "Interface/Core/BlockCache.h"
 #include "Interface/Core/InternalThreadState.h"
+#include "Interface/Core/JIT/BlockLayout.h"
 
 #include "Interface/HLE/Syscalls.h"
 
@@ -20,6 +21,7 @@
 #include <FEXCore/IR/IR.h>
 #include <FEXCore/IR/IntrusiveIRList.h>
 
+#include <map>
 #include <sys/mman.h>
 
 namespace FEXCore::CPU {
@@ -131,6 +133,7 @@ private:
   FEXCore::IR::IRListView<true> const *CurrentIR;
 
   std::map<IR::OrderedNodeWrapper::NodeOffsetType, aarch64::Label> JumpTargets;
+  std::vector<IR::OrderedNode const*> BlockLayout; ///< Emission order of the code blocks, cold blocks last
 
   /**
    * @name Register Allocation
@@ -374,6 +377,7 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
 
   auto Buffer = GetBuffer();
   auto Entry = Buffer->GetOffsetAddress<uint64_t>(GetCursorOffset());
+  DebugData->GuestOpcodes.clear();
 
   if (!CustomDispatchGenerated) {
     void *Memory = CTX->MemoryMapper.GetMemoryBase();
@@ -390,7 +394,7 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
   auto HeaderOp = HeaderNode->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
   LogMan::Throw::A(HeaderOp->Header.Op == IR::OP_IRHEADER, "First op wasn't IRHeader");
 
-  IR::OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+  CalculateBlockLayout(CurrentIR, &BlockLayout);
 
   auto GetArgSize = [&](FEXCore::IR::OrderedNodeWrapper ArgWrapper) {
     FEXCore::IR::OrderedNode *Arg = ArgWrapper.GetNode(ListBegin);
@@ -398,15 +402,23 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
     return IROp->Size * std::max((uint8_t)1, IROp->Elements);
   };
 
-  while (1) {
+  for (size_t BlockIndex = 0; BlockIndex < BlockLayout.size(); ++BlockIndex) {
     using namespace FEXCore::IR;
-    auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+    IR::OrderedNode const *BlockNode = BlockLayout[BlockIndex];
+    auto BlockIROp = BlockNode->Op(DataBegin)->C<FEXCore::IR::IROp_CodeBlock>();
     LogMan::Throw::A(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
 
     // We grab these nodes this way so we can iterate easily
     auto CodeBegin = CurrentIR->at(BlockIROp->Begin);
     auto CodeLast = CurrentIR->at(BlockIROp->Last);
 
+    // A branch to the block emitted right after this one can fall through
+    // Only if the EndBlock behind the branch has nothing to do, it is never reached otherwise
+    uint32_t FallthroughBlock = 0;
+    if (BlockIndex + 1 < BlockLayout.size() && CodeLast()->GetNode(ListBegin)->Op(DataBegin)->C<IR::IROp_EndBlock>()->RIPIncrement == 0) {
+      FallthroughBlock = BlockLayout[BlockIndex + 1]->Wrapped(ListBegin).ID();
+    }
+
     {
       uint32_t Node = BlockNode->Wrapped(ListBegin).ID();
       auto IsTarget = JumpTargets.find(Node);
@@ -617,6 +629,9 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
       }
       case IR::OP_JUMP: {
         auto Op = IROp->C<IR::IROp_Jump>();
+        if (Op->Header.Args[0].ID() == FallthroughBlock) {
+          break;
+        }
 
         Label *TargetLabel;
         auto IsTarget = JumpTargets.find(Op->Header.Args[0].ID());
@@ -653,8 +668,16 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           FalseTargetLabel = &FalseIter->second;
         }
 
-        cbnz(GetSrc<RA_64>(Op->Header.Args[0].ID()), TrueTargetLabel);
-        b(FalseTargetLabel);
+        if (Op->Header.Args[2].ID() == FallthroughBlock) {
+          cbnz(GetSrc<RA_64>(Op->Header.Args[0].ID()), TrueTargetLabel);
+        }
+        else if (Op->Header.Args[1].ID() == FallthroughBlock) {
+          cbz(GetSrc<RA_64>(Op->Header.Args[0].ID()), FalseTargetLabel);
+        }
+        else {
+          cbnz(GetSrc<RA_64>(Op->Header.Args[0].ID()), TrueTargetLabel);
+          b(FalseTargetLabel);
+        }
         break;
       }
       case IR::OP_LOADCONTEXT: {
@@ -1919,6 +1942,125 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         break;
       }
+      case IR::OP_MEMCPY: {
+        auto Op = IROp->C<IR::IROp_MemCpy>();
+        auto Dir = GetSrc<RA_64>(Op->Header.Args[3].ID());
+
+        mov(TMP1, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+        mov(TMP2, GetSrc<RA_64>(Op->Header.Args[1].ID()));
+        mov(TMP3, GetSrc<RA_64>(Op->Header.Args[2].ID()));
+
+        if (!CTX->Config.UnifiedMemory) {
+          LoadConstant(TMP4, (uint64_t)CTX->MemoryMapper.GetMemoryBase());
+          add(TMP1, TMP1, TMP4);
+          add(TMP2, TMP2, TMP4);
+        }
+
+        aarch64::Label VectorLoop;
+        aarch64::Label ElementLoop;
+        aarch64::Label Done;
+
+        // Copying 32 bytes at a time only matches the element by element result if the destination
+        // doesn't sit within 32 bytes ahead of the source. Backwards copies always go element by element
+        tbnz(Dir, 63, &ElementLoop);
+        sub(TMP4, TMP1, TMP2);
+        cmp(TMP4, 32);
+        b(&ElementLoop, lo);
+
+        bind(&VectorLoop);
+        cmp(TMP3, 32 / Op->Size);
+        b(&ElementLoop, lo);
+        ldp(VTMP1.Q(), VTMP2.Q(), MemOperand(TMP2, 32, PostIndex));
+        stp(VTMP1.Q(), VTMP2.Q(), MemOperand(TMP1, 32, PostIndex));
+        sub(TMP3, TMP3, 32 / Op->Size);
+        b(&VectorLoop);
+
+        // Whatever is left over
+        bind(&ElementLoop);
+        cbz(TMP3, &Done);
+        switch (Op->Size) {
+          case 1:
+            ldrb(TMP4.W(), MemOperand(TMP2));
+            strb(TMP4.W(), MemOperand(TMP1));
+          break;
+          case 2:
+            ldrh(TMP4.W(), MemOperand(TMP2));
+            strh(TMP4.W(), MemOperand(TMP1));
+          break;
+          case 4:
+            ldr(TMP4.W(), MemOperand(TMP2));
+            str(TMP4.W(), MemOperand(TMP1));
+          break;
+          case 8:
+            ldr(TMP4, MemOperand(TMP2));
+            str(TMP4, MemOperand(TMP1));
+          break;
+          default:  LogMan::Msg::A("Unhandled MemCpy size: %d", Op->Size);
+        }
+        add(TMP1, TMP1, Dir);
+        add(TMP2, TMP2, Dir);
+        sub(TMP3, TMP3, 1);
+        b(&ElementLoop);
+
+        bind(&Done);
+        break;
+      }
+      case IR::OP_MEMSET: {
+        auto Op = IROp->C<IR::IROp_MemSet>();
+        auto Dir = GetSrc<RA_64>(Op->Header.Args[3].ID());
+
+        mov(TMP1, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+        mov(TMP2, GetSrc<RA_64>(Op->Header.Args[1].ID()));
+        mov(TMP3, GetSrc<RA_64>(Op->Header.Args[2].ID()));
+
+        if (!CTX->Config.UnifiedMemory) {
+          LoadConstant(TMP4, (uint64_t)CTX->MemoryMapper.GetMemoryBase());
+          add(TMP1, TMP1, TMP4);
+        }
+
+        aarch64::Label Forward;
+        aarch64::Label VectorLoop;
+        aarch64::Label ElementLoop;
+        aarch64::Label Done;
+
+        // Nothing is read back so the order of the stores doesn't matter
+        // A backwards fill is the same as a forwards one from the lowest element
+        tbz(Dir, 63, &Forward);
+        mul(TMP4, TMP3, Dir);
+        add(TMP1, TMP1, TMP4);
+        add(TMP1, TMP1, Op->Size);
+        bind(&Forward);
+
+        switch (Op->Size) {
+          case 1: dup(VTMP1.V16B(), TMP2.W()); break;
+          case 2: dup(VTMP1.V8H(), TMP2.W()); break;
+          case 4: dup(VTMP1.V4S(), TMP2.W()); break;
+          case 8: dup(VTMP1.V2D(), TMP2); break;
+          default:  LogMan::Msg::A("Unhandled MemSet size: %d", Op->Size);
+        }
+
+        bind(&VectorLoop);
+        cmp(TMP3, 32 / Op->Size);
+        b(&ElementLoop, lo);
+        stp(VTMP1.Q(), VTMP1.Q(), MemOperand(TMP1, 32, PostIndex));
+        sub(TMP3, TMP3, 32 / Op->Size);
+        b(&VectorLoop);
+
+        bind(&ElementLoop);
+        cbz(TMP3, &Done);
+        switch (Op->Size) {
+          case 1: strb(TMP2.W(), MemOperand(TMP1, 1, PostIndex)); break;
+          case 2: strh(TMP2.W(), MemOperand(TMP1, 2, PostIndex)); break;
+          case 4: str(TMP2.W(), MemOperand(TMP1, 4, PostIndex)); break;
+          case 8: str(TMP2, MemOperand(TMP1, 8, PostIndex)); break;
+          default:  LogMan::Msg::A("Unhandled MemSet size: %d", Op->Size);
+        }
+        sub(TMP3, TMP3, 1);
+        b(&ElementLoop);
+
+        bind(&Done);
+        break;
+      }
       case IR::OP_MULH: {
         auto Op = IROp->C<IR::IROp_MulH>();
         switch (OpSize) {
@@ -4129,8 +4271,25 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
 #endif
         break;
       }
+      case IR::OP_GUESTOPCODE: {
+        auto Op = IROp->C<IR::IROp_GuestOpcode>();
+        uint32_t HostOffset = Buffer->GetOffsetAddress<uint64_t>(GetCursorOffset()) - Entry;
+        auto &GuestOpcodes = DebugData->GuestOpcodes;
+        // A marker without any code in front of the next one covers nothing
+        if (!GuestOpcodes.empty() && GuestOpcodes.back().HostEntryOffset == HostOffset) {
+          GuestOpcodes.back().GuestRIP = Op->GuestRIP;
+        }
+        else {
+          GuestOpcodes.push_back({HostOffset, Op->GuestRIP});
+        }
+        break;
+      }
       case IR::OP_DUMMY:
         break;
+      case IR::OP_PHIVALUE:
+      case IR::OP_PHI:
+        // Nothing to do, the RA allocated every value of the Phi to the same register
+        break;
       default:
         LogMan::Msg::A("Unknown IR Op: %d(%s)", IROp->Op, FEXCore::IR::GetName(IROp->Op).data());
         break;
@@ -4142,12 +4301,6 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
       }
       ++CodeBegin;
     }
-
-    if (BlockIROp->Next.ID() == 0) {
-      break;
-    } else {
-      BlockNode = BlockIROp->Next.GetNode(ListBegin);
-    }
   }
 
   FinalizeCode();
@@ -4162,6 +4315,7 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
   }
 #endif
 
+  DebugData->HostCodeSize = CodeEnd - Entry;
   LogMan::Msg::D("RIP: %p disas %p,%p", HeaderOp->Entry, Entry, CodeEnd);
   return reinterpret_cast<void*>(Entry);
 }
@@ -0,0 +1,119 @@
+#include "LogManager.h"
+#include "Interface/Core/JIT/BlockLayout.h"
+
+#include <FEXCore/IR/IR.h>
+#include <FEXCore/IR/IntrusiveIRList.h>
+
+#include <unordered_map>
+
+namespace {
+  struct BlockInfo {
+    FEXCore::IR::OrderedNode const *Node;
+    uint32_t Successors[2];
+    uint8_t NumSuccessors;
+    bool Cold;
+  };
+}
+
+namespace FEXCore::CPU {
+void CalculateBlockLayout(FEXCore::IR::IRListView<true> const *IR, std::vector<FEXCore::IR::OrderedNode const*> *Layout) {
+  using namespace FEXCore::IR;
+  uintptr_t ListBegin = IR->GetListData();
+  uintptr_t DataBegin = IR->GetData();
+
+  auto HeaderOp = IR->begin()()->GetNode(ListBegin)->Op(DataBegin)->C<IROp_IRHeader>();
+  LogMan::Throw::A(HeaderOp->Header.Op == OP_IRHEADER, "First op wasn't IRHeader");
+
+  Layout->clear();
+
+  std::vector<BlockInfo> Blocks;
+  std::unordered_map<uint32_t, size_t> BlockIndex;
+
+  OrderedNode const *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+  while (1) {
+    auto BlockIROp = BlockNode->Op(DataBegin)->C<IROp_CodeBlock>();
+
+    // The op before the EndBlock is the one that leaves the block
+    auto ExitIter = IR->at(BlockIROp->Last);
+    --ExitIter;
+    auto ExitOp = ExitIter()->GetNode(ListBegin)->Op(DataBegin);
+
+    BlockInfo Info{BlockNode, {}, 0, false};
+    switch (ExitOp->Op) {
+      case OP_BREAK:
+        Info.Cold = true;
+        break;
+      case OP_JUMP:
+        Info.Successors[0] = ExitOp->Args[0].ID();
+        Info.NumSuccessors = 1;
+        break;
+      case OP_CONDJUMP:
+        Info.Successors[0] = ExitOp->Args[1].ID();
+        Info.Successors[1] = ExitOp->Args[2].ID();
+        Info.NumSuccessors = 2;
+        break;
+      default: break;
+    }
+
+    BlockIndex[BlockNode->Wrapped(ListBegin).ID()] = Blocks.size();
+    Blocks.emplace_back(Info);
+
+    if (BlockIROp->Next.ID() == 0) {
+      break;
+    } else {
+      BlockNode = BlockIROp->Next.GetNode(ListBegin);
+    }
+  }
+
+  // A loop branch that doesn't go back to the header leaves the IR, that exit runs once per trip through the loop
+  for (size_t i = 0; i < Blocks.size(); ++i) {
+    if (Blocks[i].NumSuccessors != 2) {
+      continue;
+    }
+
+    for (size_t Succ = 0; Succ < 2; ++Succ) {
+      size_t Back = BlockIndex[Blocks[i].Successors[Succ]];
+      size_t Other = BlockIndex[Blocks[i].Successors[Succ ^ 1]];
+      if (Back <= i && Other > i && Blocks[Other].NumSuccessors == 0) {
+        Blocks[Other].Cold = true;
+      }
+    }
+  }
+
+  // Blocks that can only end up in cold blocks are just as cold
+  bool Changed = true;
+  while (Changed) {
+    Changed = false;
+    for (auto &Block : Blocks) {
+      if (Block.Cold || Block.NumSuccessors == 0) {
+        continue;
+      }
+
+      bool AllCold = true;
+      for (size_t Succ = 0; Succ < Block.NumSuccessors; ++Succ) {
+        AllCold &= Blocks[BlockIndex[Block.Successors[Succ]]].Cold;
+      }
+
+      if (AllCold) {
+        Block.Cold = true;
+        Changed = true;
+      }
+    }
+  }
+
+  // The entry point is emitted first no matter what
+  Blocks[0].Cold = false;
+
+  for (auto &Block : Blocks) {
+    if (!Block.Cold) {
+      Layout->emplace_back(Block.Node);
+    }
+  }
+
+  for (auto &Block : Blocks) {
+    if (Block.Cold) {
+      Layout->emplace_back(Block.Node);
+    }
+  }
+}
+}
@@ -0,0 +1,21 @@
+#pragma once
+#include <vector>
+
+namespace FEXCore::IR {
+class OrderedNode;
+template<bool>
+class IRListView;
+}
+
+namespace FEXCore::CPU {
+/**
+ * @brief Calculates the order the JITs emit the code blocks of the IR in
+ *
+ * Cold blocks get moved behind every hot block, both keep their relative order.
+ * A block is cold if it breaks out of the guest, leaves a loop straight to an exit, or only leads to other cold blocks.
+ * The first block is the entry point and is always emitted first.
+ *
+ * @param Layout Every code block of the IR in emission order
+ */
+void CalculateBlockLayout(FEXCore::IR::IRListView<true> const *IR, std::vector<FEXCore::IR::OrderedNode const*> *Layout);
+}
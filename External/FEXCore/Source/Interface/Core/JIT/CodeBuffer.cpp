@@ -0,0 +1,156 @@
+#include "LogManager.h"
+#include "Common/MathUtils.h"
+#include "Interface/Core/JIT/CodeBuffer.h"
+
+#include <algorithm>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace FEXCore::CPU {
+// The page size encoding is shared between mmap and memfd_create
+constexpr static int HUGE_PAGE_2MB_FLAG = 21 << MAP_HUGE_SHIFT;
+
+CodeBuffer::CodeBuffer(size_t ChunkSize, bool WXorX)
+  : ChunkSize {ChunkSize}
+  , WXorX {WXorX} {
+}
+
+CodeBuffer::~CodeBuffer() {
+  for (auto List : {&Chunks, &FreeChunks}) {
+    for (auto &Chunk : *List) {
+      if (Chunk.Executable != Chunk.Writable) {
+        munmap(Chunk.Executable, Chunk.Size);
+      }
+      munmap(Chunk.Writable, Chunk.Size);
+    }
+  }
+}
+
+bool CodeBuffer::MapChunk(Chunk *NewChunk, bool HugePages) {
+  constexpr int Prot = PROT_READ | PROT_WRITE | PROT_EXEC;
+
+  if (HugePages) {
+    void *Ptr = mmap(nullptr, NewChunk->Size, Prot, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB | HUGE_PAGE_2MB_FLAG, -1, 0);
+    if (Ptr == MAP_FAILED) {
+      return false;
+    }
+
+    NewChunk->Writable = NewChunk->Executable = reinterpret_cast<uint8_t*>(Ptr);
+    NewChunk->HugePages = true;
+    return true;
+  }
+
+  // Transparent huge pages only back 2MB aligned ranges, so over allocate and trim
+  size_t MapSize = NewChunk->Size + HUGE_PAGE_SIZE;
+  void *Ptr = mmap(nullptr, MapSize, Prot, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (Ptr == MAP_FAILED) {
+    return false;
+  }
+
+  uintptr_t Begin = reinterpret_cast<uintptr_t>(Ptr);
+  uintptr_t Aligned = AlignUp(Begin, HUGE_PAGE_SIZE);
+  if (Aligned != Begin) {
+    munmap(Ptr, Aligned - Begin);
+  }
+  munmap(reinterpret_cast<void*>(Aligned + NewChunk->Size), Begin + MapSize - (Aligned + NewChunk->Size));
+
+  madvise(reinterpret_cast<void*>(Aligned), NewChunk->Size, MADV_HUGEPAGE);
+
+  NewChunk->Writable = NewChunk->Executable = reinterpret_cast<uint8_t*>(Aligned);
+  NewChunk->HugePages = false;
+  return true;
+}
+
+bool CodeBuffer::MapDualChunk(Chunk *NewChunk, bool HugePages) {
+  int fd = memfd_create("FEXCode", MFD_CLOEXEC | (HugePages ? MFD_HUGETLB | HUGE_PAGE_2MB_FLAG : 0));
+  if (fd == -1) {
+    return false;
+  }
+
+  if (ftruncate(fd, NewChunk->Size) == -1) {
+    close(fd);
+    return false;
+  }
+
+  // hugetlbfs only fails at map time if there aren't enough free huge pages
+  void *RW = mmap(nullptr, NewChunk->Size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  void *RX = mmap(nullptr, NewChunk->Size, PROT_READ | PROT_EXEC, MAP_SHARED, fd, 0);
+
+  // The mappings keep the memfd alive
+  close(fd);
+
+  if (RW == MAP_FAILED || RX == MAP_FAILED) {
+    if (RW != MAP_FAILED) {
+      munmap(RW, NewChunk->Size);
+    }
+    if (RX != MAP_FAILED) {
+      munmap(RX, NewChunk->Size);
+    }
+    return false;
+  }
+
+  if (!HugePages) {
+    madvise(RX, NewChunk->Size, MADV_HUGEPAGE);
+  }
+
+  NewChunk->Writable = reinterpret_cast<uint8_t*>(RW);
+  NewChunk->Executable = reinterpret_cast<uint8_t*>(RX);
+  NewChunk->HugePages = HugePages;
+  return true;
+}
+
+CodeBuffer::Chunk const *CodeBuffer::AllocateChunk(size_t MinSize) {
+  auto Free = std::find_if(FreeChunks.begin(), FreeChunks.end(), [MinSize](Chunk const &Candidate) {
+    return Candidate.Size >= MinSize;
+  });
+
+  if (Free != FreeChunks.end()) {
+    Chunks.emplace_back(*Free);
+    Chunks.back().Used = 0;
+    FreeChunks.erase(Free);
+    return &Chunks.back();
+  }
+
+  Chunk NewChunk{};
+  NewChunk.Size = AlignUp(std::max(ChunkSize, MinSize), HUGE_PAGE_SIZE);
+
+  bool Mapped = false;
+  if (TryHugePages) {
+    Mapped = WXorX ? MapDualChunk(&NewChunk, true) : MapChunk(&NewChunk, true);
+    TryHugePages = Mapped;
+  }
+
+  if (!Mapped) {
+    Mapped = WXorX ? MapDualChunk(&NewChunk, false) : MapChunk(&NewChunk, false);
+  }
+
+  LogMan::Throw::A(Mapped, "Failed to allocate %ld bytes of code memory", NewChunk.Size);
+
+  Chunks.emplace_back(NewChunk);
+  return &Chunks.back();
+}
+
+void CodeBuffer::RecycleChunks() {
+  if (Chunks.size() <= 2) {
+    return;
+  }
+
+  FreeChunks.insert(FreeChunks.end(), Chunks.begin() + 1, Chunks.end() - 1);
+  Chunks.erase(Chunks.begin() + 1, Chunks.end() - 1);
+}
+
+void CodeBuffer::GetStats(Stats *Result) const {
+  *Result = {};
+  for (auto List : {&Chunks, &FreeChunks}) {
+    for (auto &Chunk : *List) {
+      ++Result->Chunks;
+      Result->HugePageChunks += Chunk.HugePages;
+      Result->BytesAllocated += Chunk.Size;
+    }
+  }
+
+  for (auto &Chunk : Chunks) {
+    Result->BytesUsed += Chunk.Used;
+  }
+}
+}
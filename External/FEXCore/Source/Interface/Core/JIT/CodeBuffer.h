@@ -0,0 +1,84 @@
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+namespace FEXCore::CPU {
+/**
+ * @brief Executable memory for a JIT, handed out in chunks
+ *
+ * Code that was already emitted never moves. Chunks only get reused once nothing refers to their code any more.
+ * With W^X every chunk is a memfd that is mapped twice, code is emitted through the RW alias and runs from the RX view.
+ * Chunks are backed by 2MB pages where the host has them, to cut down on iTLB misses once there is a lot of hot code.
+ */
+class CodeBuffer final {
+public:
+  struct Chunk {
+    uint8_t *Writable;   ///< Where the JIT emits code
+    uint8_t *Executable; ///< Where the code runs from, the same as Writable without W^X
+    size_t Size;
+    bool HugePages;      ///< Backed by hugetlbfs pages, transparent huge pages aren't tracked
+    size_t Used;         ///< Bytes filled with code
+  };
+
+  struct Stats {
+    uint64_t Chunks;         ///< Mapped chunks, including the ones waiting to be reused
+    uint64_t HugePageChunks;
+    uint64_t BytesAllocated; ///< Sum of the chunk sizes
+    uint64_t BytesUsed;      ///< Sum of the live code, as reported through SetUsed
+  };
+
+  /**
+   * @param ChunkSize Size of a new chunk unless an allocation asks for more
+   * @param WXorX Never map the code writable and executable at the same time
+   */
+  CodeBuffer(size_t ChunkSize, bool WXorX);
+  ~CodeBuffer();
+
+  CodeBuffer(CodeBuffer const &) = delete;
+  CodeBuffer &operator=(CodeBuffer const &) = delete;
+
+  /**
+   * @brief Makes a chunk of at least MinSize bytes the current one, reusing a recycled chunk if one is large enough
+   */
+  Chunk const *AllocateChunk(size_t MinSize);
+
+  /**
+   * @brief Puts every chunk but the first and the current one up for reuse
+   *
+   * The first chunk holds code that lives as long as the buffer, the current one is still being emitted in to.
+   * Both W^X views of a recycled chunk stay mapped, so reusing it doesn't need a new memfd.
+   */
+  void RecycleChunks();
+  Chunk const *GetCurrentChunk() const { return Chunks.empty() ? nullptr : &Chunks.back(); }
+
+  /**
+   * @brief Converts a pointer in to the RW alias of the current chunk to where the code runs from
+   */
+  void *ToExecutable(void *Writable) const {
+    auto Current = GetCurrentChunk();
+    return Current->Executable + (reinterpret_cast<uint8_t*>(Writable) - Current->Writable);
+  }
+
+  /**
+   * @brief Bytes of the current chunk that are filled with code
+   */
+  void SetUsed(size_t Used) { Chunks.back().Used = Used; }
+
+  void GetStats(Stats *Result) const;
+
+  constexpr static size_t HUGE_PAGE_SIZE = 2 * 1024 * 1024;
+
+private:
+  bool MapChunk(Chunk *NewChunk, bool HugePages);
+  bool MapDualChunk(Chunk *NewChunk, bool HugePages);
+
+  size_t ChunkSize;
+  bool WXorX;
+  // Once the host refuses hugetlbfs pages there is no point in asking again for every chunk
+  bool TryHugePages {true};
+
+  std::vector<Chunk> Chunks;
+  std::vector<Chunk> FreeChunks;
+};
+}
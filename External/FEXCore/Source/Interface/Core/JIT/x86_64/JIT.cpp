@@ -1,11 +1,15 @@
+#include "Common/MathUtils.h"
 #include "Interface/Context/Context.h"
 #include "Interface/Core/BlockCache.h"
 #include "Interface/Core/BlockSamplingData.h"
 #include "Interface/Core/InternalThreadState.h"
+#include "Interface/Core/JIT/BlockLayout.h"
+#include "Interface/Core/JIT/CodeBuffer.h"
 #include "Interface/IR/Passes/RegisterAllocationPass.h"
 
 #include "Interface/Core/JIT/x86_64/JIT.h"
 #include <xbyak/xbyak.h>
+#include <xbyak/xbyak_util.h>
 using namespace Xbyak;
 
 #include <FEXCore/Core/CPUBackend.h>
@@ -37,11 +41,13 @@ static void PrintValue(uint64_t Value) {
 #define TMP5 rbx
 using namespace Xbyak::util;
 const std::array<Xbyak::Reg, 9> RA64 = { rsi, r8, r9, r10, r11, rbp, r12, r13, r15 };
+// RA64 registers that the SysV ABI doesn't preserve across calls: rsi, r8, r9, r10, r11
+constexpr uint32_t RA64CallerSavedMask = 0b1'1111;
 const std::array<Xbyak::Reg, 9> RA32 = { esi, r8d, r9d, r10d, r11d, ebp, r12d, r13d, r15d };
 const std::array<std::pair<Xbyak::Reg, Xbyak::Reg>, 4> RA64Pair = {{ {rsi, r8}, {r9, r10}, {r11, rbp}, {r12, r13} }};
 const std::array<std::pair<Xbyak::Reg, Xbyak::Reg>, 4> RA32Pair = {{ {esi, r8d}, {r9d, r10d}, {r11d, ebp}, {r12d, r13d} }};
-const std::array<Xbyak::Reg, 10> RA16 = { si, r8w, r9w, r10w, r11w, bx, bp, r12w, r13w, r15w };
-const std::array<Xbyak::Reg, 10> RA8 = { sil, r8b, r9b, r10b, r11b, bl, bpl, r12b, r13b, r15b };
+const std::array<Xbyak::Reg, 9> RA16 = { si, r8w, r9w, r10w, r11w, bp, r12w, r13w, r15w };
+const std::array<Xbyak::Reg, 9> RA8 = { sil, r8b, r9b, r10b, r11b, bpl, r12b, r13b, r15b };
 const std::array<Xbyak::Reg, 11> RAXMM = { xmm0, xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10 };
 const std::array<Xbyak::Xmm, 11> RAXMM_x = { xmm0, xmm1, xmm2, xmm3, xmm4, xmm5, xmm6, xmm7, xmm8, xmm9, xmm10 };
 
@@ -56,6 +62,8 @@ public:
 
   bool NeedsOpDispatch() override { return true; }
 
+  void ClearCache() override;
+
   bool HasCustomDispatch() const override { return CustomDispatchGenerated; }
 
   void ExecuteCustomDispatch(FEXCore::Core::ThreadState *Thread) override {
@@ -67,6 +75,7 @@ private:
   FEXCore::Core::InternalThreadState *ThreadState;
   FEXCore::IR::IRListView<true> const *CurrentIR;
   std::unordered_map<IR::OrderedNodeWrapper::NodeOffsetType, Label> JumpTargets;
+  std::vector<IR::OrderedNode const*> BlockLayout; ///< Emission order of the code blocks, cold blocks last
 
   std::vector<uint8_t> Stack;
   bool MemoryDebug = false;
@@ -105,6 +114,73 @@ private:
   Xbyak::Xmm GetSrc(uint32_t Node);
   Xbyak::Xmm GetDst(uint32_t Node);
 
+  /**
+   * @name Calls out to host helpers
+   *
+   * Only the caller saved RA registers that hold a value live across the call get preserved.
+   * Helper arguments go in registers, anything passed by pointer can use the scratch space at rsp.
+   * @{ */
+  struct SavedRegisters {
+    uint32_t GPRMask;   ///< RA64 registers that were saved
+    uint32_t XMMMask;   ///< RAXMM registers that were saved
+    uint32_t XMMOffset; ///< rsp offset of the first saved XMM, right after the scratch space
+    uint32_t GPROffset; ///< rsp offset of the first saved GPR
+    uint32_t StackSize; ///< Scratch space and saved registers, keeps rsp 16 byte aligned
+  };
+  SavedRegisters PushLiveCallerSaved(uint32_t Node, uint32_t ScratchSize = 0);
+  void PopLiveCallerSaved(SavedRegisters const &Saved);
+  void CallHelper(uintptr_t Function);
+  /**  @} */
+
+  /**
+   * @name Host features
+   *
+   * Optional instruction set extensions that the lowerings can pick over the baseline sequences.
+   * Everything stays false when the baseline is forced through the config.
+   * @{ */
+  struct {
+    bool BMI1;     ///< andn, bextr, tzcnt
+    bool BMI2;     ///< shlx, shrx, sarx, rorx, pdep, pext
+    bool LZCNT;
+    bool POPCNT;
+    bool AVX;      ///< VEX encoded three operand vector ops
+    bool AVX2;
+    bool AVX512VL; ///< EVEX encoding of the 128bit and 256bit vector ops
+  } HostFeatures{};
+
+  void DetectHostFeatures();
+  /**
+   * @brief Returns true if the argument is an OP_CONSTANT and writes its value
+   */
+  bool IsInlineConstant(IR::OrderedNodeWrapper const &Arg, uint64_t *Value) const;
+  /**
+   * @brief Full register copy for the destructive SSE forms, skipped when the RA already shared the register
+   */
+  void CopyXMM(Xbyak::Xmm const &Dst, Xbyak::Xmm const &Src);
+  /**  @} */
+
+  /**
+   * @name Code memory
+   *
+   * Xbyak emits in to the RW alias of the current CodeBuffer chunk.
+   * Only internal labels and absolute calls through a register are used, so the code doesn't care which view it runs from.
+   * @{ */
+  CodeBuffer CodeMemory;
+  constexpr static size_t CODE_CHUNK_SIZE = 16 * 1024 * 1024;
+  // Worst case host code for a single IR op, helper calls that preserve every caller saved register are the largest
+  constexpr static size_t MAX_CODE_SIZE_PER_OP = 512;
+
+  /**
+   * @brief Points Xbyak at a new chunk, nothing may still refer to labels in the old one
+   */
+  void SetCodeChunk(CodeBuffer::Chunk const *Chunk);
+  /**
+   * @brief Moves to a new chunk if the current one doesn't have Size bytes left
+   */
+  void EnsureCodeSpace(size_t Size);
+  void UpdateCodeStats();
+  /**  @} */
+
   void CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread);
   bool CustomDispatchGenerated {false};
   using CustomDispatch = void(*)(FEXCore::Core::InternalThreadState *Thread);
@@ -116,13 +192,22 @@ private:
 #endif
 };
 
+// Xbyak takes a user buffer without touching it, the real buffer is swapped in once the CodeBuffer exists
+static uint8_t NoCodeBuffer;
+
 JITCore::JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadState *Thread)
-  : CodeGenerator(1024 * 1024 * 32)
+  : CodeGenerator(0, &NoCodeBuffer)
   , CTX {ctx}
-  , ThreadState {Thread} {
+  , ThreadState {Thread}
+  , CodeMemory {CODE_CHUNK_SIZE, ctx->Config.JITWXorX} {
   Stack.resize(9000 * 16 * 64);
+  SetCodeChunk(CodeMemory.AllocateChunk(0));
 
   RAPass = CTX->GetRegisterAllocatorPass();
+  DetectHostFeatures();
+
+  // Without VEX encodings most vector ops copy their first source in to the destination first
+  RAPass->SetTiedSourceHint(!HostFeatures.AVX);
 
   RAPass->AllocateRegisterSet(RegisterCount, RegisterClasses);
   RAPass->AddRegisters(FEXCore::IR::GPRClass, NumGPRs);
@@ -141,7 +226,39 @@ JITCore::JITCore(FEXCore::Context::Context *ctx, FEXCore::Core::InternalThreadSt
 }
 
 JITCore::~JITCore() {
-  printf("Used %ld bytes for compiling\n", getCurr<uintptr_t>() - getCode<uintptr_t>());
+  CodeBuffer::Stats Stats;
+  CodeMemory.GetStats(&Stats);
+  printf("Used %ld bytes for compiling, %ld bytes in %ld chunks (%ld huge page backed)\n",
+    Stats.BytesUsed, Stats.BytesAllocated, Stats.Chunks, Stats.HugePageChunks);
+}
+
+void JITCore::SetCodeChunk(CodeBuffer::Chunk const *Chunk) {
+  top_ = Chunk->Writable;
+  maxSize_ = Chunk->Size;
+  reset();
+}
+
+void JITCore::EnsureCodeSpace(size_t Size) {
+  if (getSize() + Size > maxSize_) {
+    SetCodeChunk(CodeMemory.AllocateChunk(Size));
+  }
+}
+
+void JITCore::ClearCache() {
+  // The dispatcher lives at the start of the first chunk and the block being mapped at the end of the current one
+  CodeMemory.RecycleChunks();
+  UpdateCodeStats();
+}
+
+void JITCore::UpdateCodeStats() {
+  CodeBuffer::Stats Stats;
+  CodeMemory.SetUsed(getSize());
+  CodeMemory.GetStats(&Stats);
+
+  ThreadState->Stats.CodeChunks = Stats.Chunks;
+  ThreadState->Stats.CodeHugePageChunks = Stats.HugePageChunks;
+  ThreadState->Stats.CodeBytesAllocated = Stats.BytesAllocated;
+  ThreadState->Stats.CodeBytesUsed = Stats.BytesUsed;
 }
 
 static void LoadMem(uint64_t Addr, uint64_t Data, uint8_t Size) {
@@ -218,6 +335,119 @@ Xbyak::Xmm JITCore::GetDst(uint32_t Node) {
   return RAXMM_x[Reg];
 }
 
+JITCore::SavedRegisters JITCore::PushLiveCallerSaved(uint32_t Node, uint32_t ScratchSize) {
+  SavedRegisters Saved{};
+
+  uint32_t SSACount = CurrentIR->GetSSACount();
+  for (uint32_t i = 0; i < SSACount; ++i) {
+    if (!RAPass->IsLiveAcross(i, Node)) {
+      continue;
+    }
+
+    uint64_t PhysReg = RAPass->GetNodeRegister(i);
+    uint32_t Reg = PhysReg;
+    if (PhysReg >= GPRPairBase) {
+      // Pairs overlap RA64 the same way the RA conflicts were set up
+      Saved.GPRMask |= 0b11U << (Reg * 2);
+    }
+    else if (PhysReg >= XMMBase) {
+      Saved.XMMMask |= 1U << Reg;
+    }
+    else {
+      Saved.GPRMask |= 1U << Reg;
+    }
+  }
+
+  Saved.GPRMask &= RA64CallerSavedMask;
+
+  Saved.XMMOffset = AlignUp(ScratchSize, 16);
+  Saved.GPROffset = Saved.XMMOffset + __builtin_popcount(Saved.XMMMask) * 16;
+  Saved.StackSize = AlignUp(Saved.GPROffset + __builtin_popcount(Saved.GPRMask) * 8, 16);
+
+  if (Saved.StackSize) {
+    sub(rsp, Saved.StackSize);
+  }
+
+  uint32_t XMMOffset = Saved.XMMOffset;
+  uint32_t GPROffset = Saved.GPROffset;
+
+  for (uint32_t i = 0; i < NumXMMs; ++i) {
+    if (Saved.XMMMask & (1U << i)) {
+      movaps(xword [rsp + XMMOffset], RAXMM_x[i]);
+      XMMOffset += 16;
+    }
+  }
+
+  for (uint32_t i = 0; i < NumGPRs; ++i) {
+    if (Saved.GPRMask & (1U << i)) {
+      mov(qword [rsp + GPROffset], RA64[i]);
+      GPROffset += 8;
+    }
+  }
+
+  return Saved;
+}
+
+void JITCore::PopLiveCallerSaved(SavedRegisters const &Saved) {
+  uint32_t XMMOffset = Saved.XMMOffset;
+  uint32_t GPROffset = Saved.GPROffset;
+
+  for (uint32_t i = 0; i < NumXMMs; ++i) {
+    if (Saved.XMMMask & (1U << i)) {
+      movaps(RAXMM_x[i], xword [rsp + XMMOffset]);
+      XMMOffset += 16;
+    }
+  }
+
+  for (uint32_t i = 0; i < NumGPRs; ++i) {
+    if (Saved.GPRMask & (1U << i)) {
+      mov(RA64[i], qword [rsp + GPROffset]);
+      GPROffset += 8;
+    }
+  }
+
+  if (Saved.StackSize) {
+    add(rsp, Saved.StackSize);
+  }
+}
+
+void JITCore::DetectHostFeatures() {
+  if (CTX->Config.HostFeatures == FEXCore::Config::CONFIG_HOSTFEATURES_BASELINE) {
+    return;
+  }
+
+  // Xbyak only reports the AVX feature bits when the OS also saves the YMM/ZMM state
+  Xbyak::util::Cpu Features;
+  HostFeatures.BMI1 = Features.has(Xbyak::util::Cpu::tBMI1);
+  HostFeatures.BMI2 = Features.has(Xbyak::util::Cpu::tBMI2);
+  HostFeatures.LZCNT = Features.has(Xbyak::util::Cpu::tLZCNT);
+  HostFeatures.POPCNT = Features.has(Xbyak::util::Cpu::tPOPCNT);
+  HostFeatures.AVX = Features.has(Xbyak::util::Cpu::tAVX);
+  HostFeatures.AVX2 = Features.has(Xbyak::util::Cpu::tAVX2);
+  HostFeatures.AVX512VL = Features.has(Xbyak::util::Cpu::tAVX512VL);
+}
+
+bool JITCore::IsInlineConstant(IR::OrderedNodeWrapper const &Arg, uint64_t *Value) const {
+  auto OpHeader = Arg.GetNode(CurrentIR->GetListData())->Op(CurrentIR->GetData());
+  if (OpHeader->Op != IR::OP_CONSTANT) {
+    return false;
+  }
+
+  *Value = OpHeader->C<IR::IROp_Constant>()->Constant;
+  return true;
+}
+
+void JITCore::CopyXMM(Xbyak::Xmm const &Dst, Xbyak::Xmm const &Src) {
+  if (Dst.getIdx() != Src.getIdx()) {
+    movapd(Dst, Src);
+  }
+}
+
+void JITCore::CallHelper(uintptr_t Function) {
+  mov(rax, Function);
+  call(rax);
+}
+
 void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const *IR, [[maybe_unused]] FEXCore::Core::DebugData *DebugData) {
   JumpTargets.clear();
   CurrentIR = IR;
@@ -225,13 +455,18 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
   uintptr_t ListBegin = CurrentIR->GetListData();
   uintptr_t DataBegin = CurrentIR->GetData();
 
-  uint32_t SSACount = CurrentIR->GetSSACount();
-  uint64_t ListStackSize = SSACount * 16;
+  // SSA IDs leave gaps for the op data, size by the number of nodes the RA actually saw
+  uint32_t NodeCount = RAPass->GetNodeCount();
+  uint64_t ListStackSize = NodeCount * 16;
   if (ListStackSize > Stack.size()) {
     Stack.resize(ListStackSize);
   }
 
+  // A block has to fit in a single chunk, the labels and branches don't reach across them
+  EnsureCodeSpace((NodeCount + 1) * MAX_CODE_SIZE_PER_OP);
+
 	void *Entry = getCurr<void*>();
+  DebugData->GuestOpcodes.clear();
 
   LogMan::Throw::A(RAPass->HasFullRA(), "Needs RA");
 
@@ -325,16 +560,25 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
     ret();
   };
 
-  IR::OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
-  while (1) {
+  CalculateBlockLayout(CurrentIR, &BlockLayout);
+
+  for (size_t BlockIndex = 0; BlockIndex < BlockLayout.size(); ++BlockIndex) {
     using namespace FEXCore::IR;
-    auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+    IR::OrderedNode const *BlockNode = BlockLayout[BlockIndex];
+    auto BlockIROp = BlockNode->Op(DataBegin)->C<FEXCore::IR::IROp_CodeBlock>();
     LogMan::Throw::A(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
 
     // We grab these nodes this way so we can iterate easily
     auto CodeBegin = CurrentIR->at(BlockIROp->Begin);
     auto CodeLast = CurrentIR->at(BlockIROp->Last);
 
+    // A branch to the block emitted right after this one can fall through
+    // Only if the EndBlock behind the branch has nothing to do, it is never reached otherwise
+    uint32_t FallthroughBlock = 0;
+    if (BlockIndex + 1 < BlockLayout.size() && CodeLast()->GetNode(ListBegin)->Op(DataBegin)->C<IR::IROp_EndBlock>()->RIPIncrement == 0) {
+      FallthroughBlock = BlockLayout[BlockIndex + 1]->Wrapped(ListBegin).ID();
+    }
+
     {
       uint32_t Node = BlockNode->Wrapped(ListBegin).ID();
       auto IsTarget = JumpTargets.find(Node);
@@ -442,6 +686,9 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_JUMP: {
           auto Op = IROp->C<IR::IROp_Jump>();
+          if (Op->Header.Args[0].ID() == FallthroughBlock) {
+            break;
+          }
 
           Label *TargetLabel;
           auto IsTarget = JumpTargets.find(Op->Header.Args[0].ID());
@@ -481,8 +728,16 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
 
           // Take branch if (src != 0)
           cmp(GetSrc<RA_64>(Op->Header.Args[0].ID()), 0);
-          jne(*TrueTargetLabel, T_NEAR);
-          jmp(*FalseTargetLabel, T_NEAR);
+          if (Op->Header.Args[2].ID() == FallthroughBlock) {
+            jne(*TrueTargetLabel, T_NEAR);
+          }
+          else if (Op->Header.Args[1].ID() == FallthroughBlock) {
+            je(*FalseTargetLabel, T_NEAR);
+          }
+          else {
+            jne(*TrueTargetLabel, T_NEAR);
+            jmp(*FalseTargetLabel, T_NEAR);
+          }
           break;
         }
         case IR::OP_LOADCONTEXT: {
@@ -1039,6 +1294,31 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         case IR::OP_AND: {
           auto Op = IROp->C<IR::IROp_And>();
           auto Dst = GetDst<RA_64>(Node);
+
+          if (HostFeatures.BMI1) {
+            // And with an inverted source is a single andn
+            // The Not's source has to still be in its register, which it only is if it lives past this op
+            uintptr_t ListBegin = CurrentIR->GetListData();
+            uintptr_t DataBegin = CurrentIR->GetData();
+            bool Inverted = false;
+            for (uint32_t i = 0; i < 2 && !Inverted; ++i) {
+              auto ArgOp = Op->Header.Args[i].GetNode(ListBegin)->Op(DataBegin);
+              if (ArgOp->Op != IR::OP_NOT) {
+                continue;
+              }
+
+              uint32_t NotSrc = ArgOp->Args[0].ID();
+              if (NotSrc == Op->Header.Args[i ^ 1].ID() || RAPass->IsLiveAcross(NotSrc, Node)) {
+                andn(Dst.cvt64(), GetSrc<RA_64>(NotSrc).cvt64(), GetSrc<RA_64>(Op->Header.Args[i ^ 1].ID()));
+                Inverted = true;
+              }
+            }
+
+            if (Inverted) {
+              break;
+            }
+          }
+
           mov(rax, GetSrc<RA_64>(Op->Header.Args[1].ID()));
           and(rax, GetSrc<RA_64>(Op->Header.Args[0].ID()));
           mov(Dst, rax);
@@ -1066,6 +1346,42 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           auto Op = IROp->C<IR::IROp_Popcount>();
           auto Dst64 = GetDst<RA_64>(Node);
 
+          if (!HostFeatures.POPCNT) {
+            // Bit counting in parallel, summing neighbouring bits then pairs then nibbles
+            switch (OpSize) {
+            case 1: movzx(eax, GetSrc<RA_8>(Op->Header.Args[0].ID())); break;
+            case 2: movzx(eax, GetSrc<RA_16>(Op->Header.Args[0].ID())); break;
+            case 4: mov(eax, GetSrc<RA_32>(Op->Header.Args[0].ID())); break;
+            case 8: mov(rax, GetSrc<RA_64>(Op->Header.Args[0].ID())); break;
+            default: LogMan::Msg::A("Unknown Popcount size: %d", OpSize); break;
+            }
+
+            mov(rcx, rax);
+            shr(rcx, 1);
+            mov(rdx, 0x5555'5555'5555'5555ULL);
+            and(rcx, rdx);
+            sub(rax, rcx);
+
+            mov(rdx, 0x3333'3333'3333'3333ULL);
+            mov(rcx, rax);
+            shr(rcx, 2);
+            and(rax, rdx);
+            and(rcx, rdx);
+            add(rax, rcx);
+
+            mov(rcx, rax);
+            shr(rcx, 4);
+            add(rax, rcx);
+            mov(rdx, 0x0F0F'0F0F'0F0F'0F0FULL);
+            and(rax, rdx);
+
+            mov(rdx, 0x0101'0101'0101'0101ULL);
+            imul(rax, rdx);
+            shr(rax, 56);
+            mov(Dst64, rax);
+            break;
+          }
+
           switch (OpSize) {
           case 1:
             movzx(GetDst<RA_32>(Node), GetSrc<RA_8>(Op->Header.Args[0].ID()));
@@ -1119,8 +1435,7 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           }
           else {
             if (Op->SrcSize == 64) {
-              vmovq(xmm15, Reg64(GetSrc<RA_64>(Op->Header.Args[0].ID()).getIdx()));
-              movapd(GetDst(Node), xmm15);
+              vmovq(GetDst(Node), Reg64(GetSrc<RA_64>(Op->Header.Args[0].ID()).getIdx()));
             }
             else {
               auto Dst = GetDst<RA_64>(Node);
@@ -1179,6 +1494,11 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
 
             mov (GetDst<RA_64>(Node), rax);
           }
+          else if (HostFeatures.BMI1 && Op->Width != 64) {
+            // bextr takes the start in bits 7:0 and the length in bits 15:8 of the control register
+            mov(ecx, Op->lsb | (Op->Width << 8));
+            bextr(GetDst<RA_64>(Node).cvt64(), GetSrc<RA_64>(Op->Header.Args[0].ID()), rcx);
+          }
           else {
             auto Dst = GetDst<RA_64>(Node);
             mov(rax, GetSrc<RA_64>(Op->Header.Args[0].ID()));
@@ -1198,6 +1518,17 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           auto Op = IROp->C<IR::IROp_Lshr>();
           uint8_t Mask = OpSize * 8 - 1;
 
+          if (HostFeatures.BMI2 && OpSize >= 4) {
+            // shrx masks the shift to the operand size itself and leaves the flags alone
+            if (OpSize == 4) {
+              shrx(GetDst<RA_32>(Node).cvt32(), GetSrc<RA_32>(Op->Header.Args[0].ID()), GetSrc<RA_32>(Op->Header.Args[1].ID()).cvt32());
+            }
+            else {
+              shrx(GetDst<RA_64>(Node).cvt64(), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()).cvt64());
+            }
+            break;
+          }
+
           mov (rcx, GetSrc<RA_64>(Op->Header.Args[1].ID()));
           and(rcx, Mask);
 
@@ -1227,6 +1558,17 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           auto Op = IROp->C<IR::IROp_Lshl>();
           uint8_t Mask = OpSize * 8 - 1;
 
+          if (HostFeatures.BMI2 && OpSize >= 4) {
+            // shlx masks the shift to the operand size itself and leaves the flags alone
+            if (OpSize == 4) {
+              shlx(GetDst<RA_32>(Node).cvt32(), GetSrc<RA_32>(Op->Header.Args[0].ID()), GetSrc<RA_32>(Op->Header.Args[1].ID()).cvt32());
+            }
+            else {
+              shlx(GetDst<RA_64>(Node).cvt64(), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()).cvt64());
+            }
+            break;
+          }
+
           mov (rcx, GetSrc<RA_64>(Op->Header.Args[1].ID()));
           and(rcx, Mask);
 
@@ -1255,6 +1597,17 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           auto Op = IROp->C<IR::IROp_Ashr>();
           uint8_t Mask = OpSize * 8 - 1;
 
+          if (HostFeatures.BMI2 && OpSize >= 4) {
+            // sarx masks the shift to the operand size itself and leaves the flags alone
+            if (OpSize == 4) {
+              sarx(GetDst<RA_32>(Node).cvt32(), GetSrc<RA_32>(Op->Header.Args[0].ID()), GetSrc<RA_32>(Op->Header.Args[1].ID()).cvt32());
+            }
+            else {
+              sarx(GetDst<RA_64>(Node).cvt64(), GetSrc<RA_64>(Op->Header.Args[0].ID()), GetSrc<RA_64>(Op->Header.Args[1].ID()).cvt64());
+            }
+            break;
+          }
+
           mov (rcx, GetSrc<RA_64>(Op->Header.Args[1].ID()));
           and(rcx, Mask);
           switch (OpSize) {
@@ -1284,6 +1637,19 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           auto Op = IROp->C<IR::IROp_Rol>();
           uint8_t Mask = OpSize * 8 - 1;
 
+          uint64_t Shift{};
+          if (HostFeatures.BMI2 && OpSize >= 4 && IsInlineConstant(Op->Header.Args[1], &Shift)) {
+            // Rotating left is rotating right by the rest of the width
+            uint8_t Amount = (OpSize * 8 - (Shift & Mask)) & Mask;
+            if (OpSize == 4) {
+              rorx(GetDst<RA_32>(Node).cvt32(), GetSrc<RA_32>(Op->Header.Args[0].ID()), Amount);
+            }
+            else {
+              rorx(GetDst<RA_64>(Node).cvt64(), GetSrc<RA_64>(Op->Header.Args[0].ID()), Amount);
+            }
+            break;
+          }
+
           mov (rcx, GetSrc<RA_64>(Op->Header.Args[1].ID()));
           and(rcx, Mask);
           switch (OpSize) {
@@ -1315,6 +1681,18 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           auto Op = IROp->C<IR::IROp_Ror>();
           uint8_t Mask = OpSize * 8 - 1;
 
+          uint64_t Shift{};
+          if (HostFeatures.BMI2 && OpSize >= 4 && IsInlineConstant(Op->Header.Args[1], &Shift)) {
+            uint8_t Amount = Shift & Mask;
+            if (OpSize == 4) {
+              rorx(GetDst<RA_32>(Node).cvt32(), GetSrc<RA_32>(Op->Header.Args[0].ID()), Amount);
+            }
+            else {
+              rorx(GetDst<RA_64>(Node).cvt64(), GetSrc<RA_64>(Op->Header.Args[0].ID()), Amount);
+            }
+            break;
+          }
+
           mov (rcx, GetSrc<RA_64>(Op->Header.Args[1].ID()));
           and(rcx, Mask);
           switch (OpSize) {
@@ -1949,54 +2327,99 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           }
           break;
         }
-        case IR::OP_SYSCALL: {
-          auto Op = IROp->C<IR::IROp_Syscall>();
-          // XXX: This is very terrible, but I don't care for right now
+        case IR::OP_MEMCPY: {
+          auto Op = IROp->C<IR::IROp_MemCpy>();
 
-          auto NumPush = 1 + RA64.size();
-          push(rdi);
+          // The host string ops match the guest ones exactly, overlapping copies and the direction included
+          mov(rdi, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+          mov(rax, GetSrc<RA_64>(Op->Header.Args[1].ID()));
+          mov(rcx, GetSrc<RA_64>(Op->Header.Args[2].ID()));
+          mov(rdx, GetSrc<RA_64>(Op->Header.Args[3].ID()));
 
-          for (auto &Reg : RA64)
-            push(Reg);
+          // RSI is allocatable, so it needs to be saved
+          push(rsi);
+          mov(rsi, rax);
 
-          // Syscall ABI for x86-64
-          // this: rdi
-          // Thread: rsi
-          // ArgPointer: rdx (Stack)
-          //
-          // Result: RAX
+          if (!CTX->Config.UnifiedMemory) {
+            mov(rax, CTX->MemoryMapper.GetBaseOffset<uint64_t>(0));
+            add(rdi, rax);
+            add(rsi, rax);
+          }
 
-          // These are pushed in reverse order because stacks
-          for (uint32_t i = FEXCore::HLE::SyscallArguments::MAX_ARGS; i > 0; --i) {
-            if (Op->Header.Args[i - 1].IsInvalid()) continue;
-            push(GetSrc<RA_64>(Op->Header.Args[i - 1].ID()));
-            ++NumPush;
+          Label Forward;
+          test(rdx, rdx);
+          jns(Forward);
+          std();
+          L(Forward);
+
+          rep();
+          switch (Op->Size) {
+            case 1: movsb(); break;
+            case 2: movsw(); break;
+            case 4: movsd(); break;
+            case 8: movsq(); break;
+            default: LogMan::Msg::A("Unhandled MemCpy size: %d", Op->Size);
           }
 
-          mov(rsi, rdi); // Move thread in to rsi
-          mov(rdi, reinterpret_cast<uint64_t>(CTX->SyscallHandler));
-          mov(rdx, rsp);
+          // The host ABI expects DF to be clear
+          cld();
+          pop(rsi);
+          break;
+        }
+        case IR::OP_MEMSET: {
+          auto Op = IROp->C<IR::IROp_MemSet>();
+
+          mov(rdi, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+          mov(rax, GetSrc<RA_64>(Op->Header.Args[1].ID()));
+          mov(rcx, GetSrc<RA_64>(Op->Header.Args[2].ID()));
+
+          if (!CTX->Config.UnifiedMemory) {
+            mov(rdx, CTX->MemoryMapper.GetBaseOffset<uint64_t>(0));
+            add(rdi, rdx);
+          }
 
-          mov(rax, reinterpret_cast<uint64_t>(FEXCore::HandleSyscall));
+          mov(rdx, GetSrc<RA_64>(Op->Header.Args[3].ID()));
 
-          if (NumPush & 1)
-            sub(rsp, 8); // Align
+          Label Forward;
+          test(rdx, rdx);
+          jns(Forward);
+          std();
+          L(Forward);
+
+          rep();
+          switch (Op->Size) {
+            case 1: stosb(); break;
+            case 2: stosw(); break;
+            case 4: stosd(); break;
+            case 8: stosq(); break;
+            default: LogMan::Msg::A("Unhandled MemSet size: %d", Op->Size);
+          }
 
-          call(rax);
+          cld();
+          break;
+        }
+        case IR::OP_SYSCALL: {
+          auto Op = IROp->C<IR::IROp_Syscall>();
 
-          if (NumPush & 1)
-            add(rsp, 8); // Align
+          // Syscall ABI for x86-64
+          // this: rdi
+          // Thread: rsi
+          // ArgPointer: rdx (Scratch space)
+          //
+          // Result: RAX
+          auto Saved = PushLiveCallerSaved(Node, sizeof(FEXCore::HLE::SyscallArguments));
 
-          // Reload arguments just in case they are sill live after the fact
           for (uint32_t i = 0; i < FEXCore::HLE::SyscallArguments::MAX_ARGS; ++i) {
             if (Op->Header.Args[i].IsInvalid()) continue;
-            pop(GetSrc<RA_64>(Op->Header.Args[i].ID()));
+            mov(qword [rsp + i * 8], GetSrc<RA_64>(Op->Header.Args[i].ID()));
           }
 
-          for (uint32_t i = RA64.size(); i > 0; --i)
-            pop(RA64[i - 1]);
+          mov(rdi, reinterpret_cast<uint64_t>(CTX->SyscallHandler));
+          mov(rsi, STATE);
+          mov(rdx, rsp);
+          CallHelper(reinterpret_cast<uintptr_t>(FEXCore::HandleSyscall));
 
-          pop(rdi);
+          PopLiveCallerSaved(Saved);
 
           mov (GetDst<RA_64>(Node), rax);
           break;
@@ -2028,7 +2451,28 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_VINSGPR: {
           auto Op = IROp->C<IR::IROp_VInsGPR>();
-          movapd(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
+          if (HostFeatures.AVX) {
+            auto Dst = GetDst(Node);
+            auto Src = GetSrc(Op->Header.Args[0].ID());
+            switch (Op->ElementSize) {
+            case 1:
+              vpinsrb(Dst, Src, GetSrc<RA_32>(Op->Header.Args[1].ID()), Op->Index);
+            break;
+            case 2:
+              vpinsrw(Dst, Src, GetSrc<RA_32>(Op->Header.Args[1].ID()), Op->Index);
+            break;
+            case 4:
+              vpinsrd(Dst, Src, GetSrc<RA_32>(Op->Header.Args[1].ID()), Op->Index);
+            break;
+            case 8:
+              vpinsrq(Dst, Src, GetSrc<RA_64>(Op->Header.Args[1].ID()), Op->Index);
+            break;
+            default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+            }
+            break;
+          }
+
+          CopyXMM(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
 
           switch (Op->ElementSize) {
           case 1: {
@@ -2055,31 +2499,12 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         case IR::OP_PRINT: {
           auto Op = IROp->C<IR::IROp_Print>();
 
-          push(rdi);
-          push(rdi);
-
-          for (auto &Reg : RA64)
-            push(Reg);
-
-          auto NumPush = RA64.size();
-          if (NumPush & 1)
-            sub(rsp, 8); // Align
+          auto Saved = PushLiveCallerSaved(Node);
 
           mov (rdi, GetSrc<RA_64>(Op->Header.Args[0].ID()));
+          CallHelper(reinterpret_cast<uintptr_t>(PrintValue));
 
-          mov(rax, reinterpret_cast<uintptr_t>(PrintValue));
-
-          call(rax);
-
-          if (NumPush & 1)
-            add(rsp, 8); // Align
-
-          for (uint32_t i = RA64.size(); i > 0; --i)
-            pop(RA64[i - 1]);
-
-          pop(rdi);
-          pop(rdi);
-
+          PopLiveCallerSaved(Saved);
           break;
         }
 
@@ -2093,32 +2518,18 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           } Ptr;
           Ptr.ClassPtr = &CPUIDEmu::RunFunction;
 
-          for (auto &Reg : RA64)
-            push(Reg);
+          auto Saved = PushLiveCallerSaved(Node);
 
           // CPUID ABI
           // this: rdi
           // Function: rsi
           //
           // Result: RAX, RDX. 4xi32
-          push(rdi);
           mov (rsi, GetSrc<RA_64>(Op->Header.Args[0].ID()));
           mov (rdi, reinterpret_cast<uint64_t>(&CTX->CPUID));
+          CallHelper(Ptr.Raw);
 
-          auto NumPush = RA64.size() + 1;
-          if (NumPush & 1)
-            sub(rsp, 8); // Align
-
-          mov(rax, Ptr.Raw);
-          call(rax);
-
-          if (NumPush & 1)
-            add(rsp, 8); // Align
-
-          pop(rdi);
-
-          for (uint32_t i = RA64.size(); i > 0; --i)
-            pop(RA64[i - 1]);
+          PopLiveCallerSaved(Saved);
 
           auto Dst = GetDst(Node);
           pinsrq(Dst, rax, 0);
@@ -2142,8 +2553,13 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
 
           switch (ElementSize) {
             case 4:
-              movapd(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
-              shufps(GetDst(Node), GetDst(Node), 0);
+              if (HostFeatures.AVX) {
+                vshufps(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), GetSrc(Op->Header.Args[0].ID()), 0);
+              }
+              else {
+                CopyXMM(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
+                shufps(GetDst(Node), GetDst(Node), 0);
+              }
             break;
             case 8:
               movddup(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
@@ -2154,6 +2570,33 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_VINSELEMENT: {
           auto Op = IROp->C<IR::IROp_VInsElement>();
+          if (HostFeatures.AVX) {
+            // The element goes through a GPR, so the destination is free to share a register with either source
+            auto Dst = GetDst(Node);
+            auto Src1 = GetSrc(Op->Header.Args[0].ID());
+            auto Src2 = GetSrc(Op->Header.Args[1].ID());
+            switch (Op->ElementSize) {
+            case 1:
+              pextrb(eax, Src2, Op->SrcIdx);
+              vpinsrb(Dst, Src1, eax, Op->DestIdx);
+            break;
+            case 2:
+              pextrw(eax, Src2, Op->SrcIdx);
+              vpinsrw(Dst, Src1, eax, Op->DestIdx);
+            break;
+            case 4:
+              pextrd(eax, Src2, Op->SrcIdx);
+              vpinsrd(Dst, Src1, eax, Op->DestIdx);
+            break;
+            case 8:
+              pextrq(rax, Src2, Op->SrcIdx);
+              vpinsrq(Dst, Src1, rax, Op->DestIdx);
+            break;
+            default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+            }
+            break;
+          }
+
           movapd(xmm15, GetSrc(Op->Header.Args[0].ID()));
 
           // Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
@@ -2189,6 +2632,33 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_VINSSCALARELEMENT: {
           auto Op = IROp->C<IR::IROp_VInsScalarElement>();
+          if (HostFeatures.AVX) {
+            // The element goes through a GPR, so the destination is free to share a register with either source
+            auto Dst = GetDst(Node);
+            auto Src1 = GetSrc(Op->Header.Args[0].ID());
+            auto Src2 = GetSrc(Op->Header.Args[1].ID());
+            switch (Op->ElementSize) {
+            case 1:
+              pextrb(eax, Src2, 0);
+              vpinsrb(Dst, Src1, eax, Op->DestIdx);
+            break;
+            case 2:
+              pextrw(eax, Src2, 0);
+              vpinsrw(Dst, Src1, eax, Op->DestIdx);
+            break;
+            case 4:
+              pextrd(eax, Src2, 0);
+              vpinsrd(Dst, Src1, eax, Op->DestIdx);
+            break;
+            case 8:
+              pextrq(rax, Src2, 0);
+              vpinsrq(Dst, Src1, rax, Op->DestIdx);
+            break;
+            default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+            }
+            break;
+          }
+
           movapd(xmm15, GetSrc(Op->Header.Args[0].ID()));
 
           // Dst_d[Op->DestIdx] = Src2_d[Op->SrcIdx];
@@ -2535,22 +3005,37 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
             case 1: {
               vpxor(xmm15, xmm15, xmm15);
               pextrb(eax, GetSrc(Op->Header.Args[0].ID()), 0);
-              pinsrb(xmm15, eax, 0);
-              movapd(GetDst(Node), xmm15);
+              if (HostFeatures.AVX) {
+                vpinsrb(GetDst(Node), xmm15, eax, 0);
+              }
+              else {
+                pinsrb(xmm15, eax, 0);
+                movapd(GetDst(Node), xmm15);
+              }
               break;
             }
             case 2: {
               vpxor(xmm15, xmm15, xmm15);
               pextrw(eax, GetSrc(Op->Header.Args[0].ID()), 0);
-              pinsrw(xmm15, eax, 0);
-              movapd(GetDst(Node), xmm15);
+              if (HostFeatures.AVX) {
+                vpinsrw(GetDst(Node), xmm15, eax, 0);
+              }
+              else {
+                pinsrw(xmm15, eax, 0);
+                movapd(GetDst(Node), xmm15);
+              }
               break;
             }
             case 4: {
               vpxor(xmm15, xmm15, xmm15);
               pextrd(eax, GetSrc(Op->Header.Args[0].ID()), 0);
-              pinsrd(xmm15, eax, 0);
-              movapd(GetDst(Node), xmm15);
+              if (HostFeatures.AVX) {
+                vpinsrd(GetDst(Node), xmm15, eax, 0);
+              }
+              else {
+                pinsrd(xmm15, eax, 0);
+                movapd(GetDst(Node), xmm15);
+              }
               break;
             }
             case 8: {
@@ -2558,7 +3043,7 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
               break;
             }
             case 16: {
-              movaps(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
+              CopyXMM(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
               break;
             }
             default: LogMan::Msg::A("Unknown Element Size: %d", GetArgSize(Op->Header.Args[0])); break;
@@ -2900,6 +3385,21 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_VSQXTN: {
           auto Op = IROp->C<IR::IROp_VSQXTN>();
+          if (HostFeatures.AVX) {
+            // Narrow in to both halves then vmovq clears the upper one
+            switch (Op->ElementSize) {
+              case 2:
+                vpacksswb(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), GetSrc(Op->Header.Args[0].ID()));
+              break;
+              case 4:
+                vpackssdw(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), GetSrc(Op->Header.Args[0].ID()));
+              break;
+              default: LogMan::Msg::A("Unknown element size: %d", Op->ElementSize);
+            }
+            vmovq(GetDst(Node), GetDst(Node));
+            break;
+          }
+
           switch (Op->ElementSize) {
             case 2:
               packsswb(xmm15, GetSrc(Op->Header.Args[0].ID()));
@@ -2935,6 +3435,21 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_VSQXTUN: {
           auto Op = IROp->C<IR::IROp_VSQXTUN>();
+          if (HostFeatures.AVX) {
+            // Narrow in to both halves then vmovq clears the upper one
+            switch (Op->ElementSize) {
+              case 2:
+                vpackuswb(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), GetSrc(Op->Header.Args[0].ID()));
+              break;
+              case 4:
+                vpackusdw(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), GetSrc(Op->Header.Args[0].ID()));
+              break;
+              default: LogMan::Msg::A("Unknown element size: %d", Op->ElementSize);
+            }
+            vmovq(GetDst(Node), GetDst(Node));
+            break;
+          }
+
           switch (Op->ElementSize) {
             case 2:
               packuswb(xmm15, GetSrc(Op->Header.Args[0].ID()));
@@ -3088,7 +3603,7 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_VBITCAST: {
           auto Op = IROp->C<IR::IROp_VBitcast>();
-          movaps(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
+          CopyXMM(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
         break;
         }
         case IR::OP_VCASTFROMGPR: {
@@ -3387,6 +3902,20 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_VZIP: {
           auto Op = IROp->C<IR::IROp_VZip>();
+          if (HostFeatures.AVX) {
+            auto Dst = GetDst(Node);
+            auto Src1 = GetSrc(Op->Header.Args[0].ID());
+            auto Src2 = GetSrc(Op->Header.Args[1].ID());
+            switch (Op->ElementSize) {
+            case 1: vpunpcklbw(Dst, Src1, Src2); break;
+            case 2: vpunpcklwd(Dst, Src1, Src2); break;
+            case 4: vpunpckldq(Dst, Src1, Src2); break;
+            case 8: vpunpcklqdq(Dst, Src1, Src2); break;
+            default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+            }
+            break;
+          }
+
           movapd(xmm15, GetSrc(Op->Header.Args[0].ID()));
 
           switch (Op->ElementSize) {
@@ -3413,7 +3942,6 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_VZIP2: {
           auto Op = IROp->C<IR::IROp_VZip2>();
-          movapd(xmm15, GetSrc(Op->Header.Args[0].ID()));
 
           if (Op->RegisterSize == 8) {
             vpslldq(xmm15, GetSrc(Op->Header.Args[0].ID()), 4);
@@ -3434,7 +3962,20 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
             default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
             }
           }
+          else if (HostFeatures.AVX) {
+            auto Dst = GetDst(Node);
+            auto Src1 = GetSrc(Op->Header.Args[0].ID());
+            auto Src2 = GetSrc(Op->Header.Args[1].ID());
+            switch (Op->ElementSize) {
+            case 1: vpunpckhbw(Dst, Src1, Src2); break;
+            case 2: vpunpckhwd(Dst, Src1, Src2); break;
+            case 4: vpunpckhdq(Dst, Src1, Src2); break;
+            case 8: vpunpckhqdq(Dst, Src1, Src2); break;
+            default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+            }
+          }
           else {
+            movapd(xmm15, GetSrc(Op->Header.Args[0].ID()));
             switch (Op->ElementSize) {
             case 1: {
               punpckhbw(xmm15, GetSrc(Op->Header.Args[1].ID()));
@@ -3520,21 +4061,41 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_VSLI: {
           auto Op = IROp->C<IR::IROp_VSLI>();
-          movapd(xmm15, GetSrc(Op->Header.Args[0].ID()));
-          pslldq(xmm15, Op->ByteShift);
-          movapd(GetDst(Node), xmm15);
+          if (HostFeatures.AVX) {
+            vpslldq(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), Op->ByteShift);
+          }
+          else {
+            CopyXMM(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
+            pslldq(GetDst(Node), Op->ByteShift);
+          }
           break;
         }
         case IR::OP_VSRI: {
           auto Op = IROp->C<IR::IROp_VSRI>();
-          movapd(xmm15, GetSrc(Op->Header.Args[0].ID()));
-          psrldq(xmm15, Op->ByteShift);
-          movapd(GetDst(Node), xmm15);
+          if (HostFeatures.AVX) {
+            vpsrldq(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), Op->ByteShift);
+          }
+          else {
+            CopyXMM(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
+            psrldq(GetDst(Node), Op->ByteShift);
+          }
           break;
         }
         case IR::OP_VUSHRI: {
           auto Op = IROp->C<IR::IROp_VUShrI>();
-          movapd(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
+          if (HostFeatures.AVX) {
+            auto Dst = GetDst(Node);
+            auto Src = GetSrc(Op->Header.Args[0].ID());
+            switch (Op->ElementSize) {
+            case 2: vpsrlw(Dst, Src, Op->BitShift); break;
+            case 4: vpsrld(Dst, Src, Op->BitShift); break;
+            case 8: vpsrlq(Dst, Src, Op->BitShift); break;
+            default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+            }
+            break;
+          }
+
+          CopyXMM(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
           switch (Op->ElementSize) {
             case 2: {
               psrlw(GetDst(Node), Op->BitShift);
@@ -3554,7 +4115,19 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_VSHLI: {
           auto Op = IROp->C<IR::IROp_VShlI>();
-          movapd(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
+          if (HostFeatures.AVX) {
+            auto Dst = GetDst(Node);
+            auto Src = GetSrc(Op->Header.Args[0].ID());
+            switch (Op->ElementSize) {
+            case 2: vpsllw(Dst, Src, Op->BitShift); break;
+            case 4: vpslld(Dst, Src, Op->BitShift); break;
+            case 8: vpsllq(Dst, Src, Op->BitShift); break;
+            default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+            }
+            break;
+          }
+
+          CopyXMM(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
           switch (Op->ElementSize) {
             case 2: {
               psllw(GetDst(Node), Op->BitShift);
@@ -3574,7 +4147,18 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_VSSHRI: {
           auto Op = IROp->C<IR::IROp_VSShrI>();
-          movapd(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
+          if (HostFeatures.AVX) {
+            auto Dst = GetDst(Node);
+            auto Src = GetSrc(Op->Header.Args[0].ID());
+            switch (Op->ElementSize) {
+            case 2: vpsraw(Dst, Src, Op->BitShift); break;
+            case 4: vpsrad(Dst, Src, Op->BitShift); break;
+            default: LogMan::Msg::A("Unknown Element Size: %d", Op->ElementSize); break;
+            }
+            break;
+          }
+
+          CopyXMM(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
           switch (Op->ElementSize) {
             case 2: {
               psraw(GetDst(Node), Op->BitShift);
@@ -3590,25 +4174,38 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_VUSHRNI: {
           auto Op = IROp->C<IR::IROp_VUShrNI>();
-          movapd(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
-          vpxor(xmm15, xmm15, xmm15);
+          if (HostFeatures.AVX) {
+            switch (Op->ElementSize) {
+              case 2: vpsrlw(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), Op->BitShift); break;
+              case 4: vpsrld(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), Op->BitShift); break;
+              case 8: vpsrlq(GetDst(Node), GetSrc(Op->Header.Args[0].ID()), Op->BitShift); break;
+              default: break;
+            }
+          }
+          else {
+            CopyXMM(GetDst(Node), GetSrc(Op->Header.Args[0].ID()));
+            switch (Op->ElementSize) {
+              case 2: psrlw(GetDst(Node), Op->BitShift); break;
+              case 4: psrld(GetDst(Node), Op->BitShift); break;
+              case 8: psrlq(GetDst(Node), Op->BitShift); break;
+              default: break;
+            }
+          }
+
           switch (Op->ElementSize) {
             case 2: {
-              psrlw(GetDst(Node), Op->BitShift);
               // <8 x i16> -> <8 x i8>
               mov(rax, 0x0E'0C'0A'08'06'04'02'00); // Lower
               mov(rcx, 0x80'80'80'80'80'80'80'80); // Upper
               break;
             }
             case 4: {
-              psrld(GetDst(Node), Op->BitShift);
               // <4 x i32> -> <4 x i16>
               mov(rax, 0x0D'0C'09'08'05'04'01'00); // Lower
               mov(rcx, 0x80'80'80'80'80'80'80'80); // Upper
               break;
             }
             case 8: {
-              psrlq(GetDst(Node), Op->BitShift);
               // <2 x i64> -> <2 x i32>
               mov(rax, 0x0B'0A'09'08'03'02'01'00); // Lower
               mov(rcx, 0x80'80'80'80'80'80'80'80); // Upper
@@ -4130,14 +4727,13 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
               Label Loop;
               L(Loop);
               mov(TMP2.cvt8(), TMP1.cvt8());
-              mov(TMP3.cvt8(), TMP1.cvt8());
               and(TMP2.cvt8(), GetSrc<RA_8>(Op->Header.Args[1].ID()));
 
               // Updates RAX with the value from memory
               lock(); cmpxchg(byte [MemReg], TMP2.cvt8());
               jne(Loop);
-              // Result is the previous value from memory, which is currently in TMP3
-              movzx(GetDst<RA_64>(Node), TMP3.cvt8());
+              // cmpxchg only succeeds when RAX matched memory, so RAX still holds the previous value
+              movzx(GetDst<RA_64>(Node), TMP1.cvt8());
               break;
             }
             case 2: {
@@ -4146,15 +4742,14 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
               Label Loop;
               L(Loop);
               mov(TMP2.cvt16(), TMP1.cvt16());
-              mov(TMP3.cvt16(), TMP1.cvt16());
               and(TMP2.cvt16(), GetSrc<RA_16>(Op->Header.Args[1].ID()));
 
               // Updates RAX with the value from memory
               lock(); cmpxchg(word [MemReg], TMP2.cvt16());
               jne(Loop);
 
-              // Result is the previous value from memory, which is currently in TMP3
-              movzx(GetDst<RA_64>(Node), TMP3.cvt16());
+              // cmpxchg only succeeds when RAX matched memory, so RAX still holds the previous value
+              movzx(GetDst<RA_64>(Node), TMP1.cvt16());
               break;
             }
             case 4: {
@@ -4163,15 +4758,14 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
               Label Loop;
               L(Loop);
               mov(TMP2.cvt32(), TMP1.cvt32());
-              mov(TMP3.cvt32(), TMP1.cvt32());
               and(TMP2.cvt32(), GetSrc<RA_32>(Op->Header.Args[1].ID()));
 
               // Updates RAX with the value from memory
               lock(); cmpxchg(dword [MemReg], TMP2.cvt32());
               jne(Loop);
 
-              // Result is the previous value from memory, which is currently in TMP3
-              mov(GetDst<RA_32>(Node), TMP3.cvt32());
+              // cmpxchg only succeeds when RAX matched memory, so RAX still holds the previous value
+              mov(GetDst<RA_32>(Node), TMP1.cvt32());
               break;
             }
             case 8: {
@@ -4180,15 +4774,14 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
               Label Loop;
               L(Loop);
               mov(TMP2.cvt64(), TMP1.cvt64());
-              mov(TMP3.cvt64(), TMP1.cvt64());
               and(TMP2.cvt64(), GetSrc<RA_64>(Op->Header.Args[1].ID()));
 
               // Updates RAX with the value from memory
               lock(); cmpxchg(qword [MemReg], TMP2.cvt64());
               jne(Loop);
 
-              // Result is the previous value from memory, which is currently in TMP3
-              mov(GetDst<RA_64>(Node), TMP3.cvt64());
+              // cmpxchg only succeeds when RAX matched memory, so RAX still holds the previous value
+              mov(GetDst<RA_64>(Node), TMP1.cvt64());
               break;
             }
             default:  LogMan::Msg::A("Unhandled AtomicFetchAdd size: %d", Op->Size);
@@ -4215,14 +4808,13 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
               Label Loop;
               L(Loop);
               mov(TMP2.cvt8(), TMP1.cvt8());
-              mov(TMP3.cvt8(), TMP1.cvt8());
               or(TMP2.cvt8(), GetSrc<RA_8>(Op->Header.Args[1].ID()));
 
               // Updates RAX with the value from memory
               lock(); cmpxchg(byte [MemReg], TMP2.cvt8());
               jne(Loop);
-              // Result is the previous value from memory, which is currently in TMP3
-              movzx(GetDst<RA_64>(Node), TMP3.cvt8());
+              // cmpxchg only succeeds when RAX matched memory, so RAX still holds the previous value
+              movzx(GetDst<RA_64>(Node), TMP1.cvt8());
               break;
             }
             case 2: {
@@ -4231,15 +4823,14 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
               Label Loop;
               L(Loop);
               mov(TMP2.cvt16(), TMP1.cvt16());
-              mov(TMP3.cvt16(), TMP1.cvt16());
               or(TMP2.cvt16(), GetSrc<RA_16>(Op->Header.Args[1].ID()));
 
               // Updates RAX with the value from memory
               lock(); cmpxchg(word [MemReg], TMP2.cvt16());
               jne(Loop);
 
-              // Result is the previous value from memory, which is currently in TMP3
-              movzx(GetDst<RA_64>(Node), TMP3.cvt16());
+              // cmpxchg only succeeds when RAX matched memory, so RAX still holds the previous value
+              movzx(GetDst<RA_64>(Node), TMP1.cvt16());
               break;
             }
             case 4: {
@@ -4248,15 +4839,14 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
               Label Loop;
               L(Loop);
               mov(TMP2.cvt32(), TMP1.cvt32());
-              mov(TMP3.cvt32(), TMP1.cvt32());
               or(TMP2.cvt32(), GetSrc<RA_32>(Op->Header.Args[1].ID()));
 
               // Updates RAX with the value from memory
               lock(); cmpxchg(dword [MemReg], TMP2.cvt32());
               jne(Loop);
 
-              // Result is the previous value from memory, which is currently in TMP3
-              mov(GetDst<RA_32>(Node), TMP3.cvt32());
+              // cmpxchg only succeeds when RAX matched memory, so RAX still holds the previous value
+              mov(GetDst<RA_32>(Node), TMP1.cvt32());
               break;
             }
             case 8: {
@@ -4265,15 +4855,14 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
               Label Loop;
               L(Loop);
               mov(TMP2.cvt64(), TMP1.cvt64());
-              mov(TMP3.cvt64(), TMP1.cvt64());
               or(TMP2.cvt64(), GetSrc<RA_64>(Op->Header.Args[1].ID()));
 
               // Updates RAX with the value from memory
               lock(); cmpxchg(qword [MemReg], TMP2.cvt64());
               jne(Loop);
 
-              // Result is the previous value from memory, which is currently in TMP3
-              mov(GetDst<RA_64>(Node), TMP3.cvt64());
+              // cmpxchg only succeeds when RAX matched memory, so RAX still holds the previous value
+              mov(GetDst<RA_64>(Node), TMP1.cvt64());
               break;
             }
             default:  LogMan::Msg::A("Unhandled AtomicFetchAdd size: %d", Op->Size);
@@ -4300,14 +4889,13 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
               Label Loop;
               L(Loop);
               mov(TMP2.cvt8(), TMP1.cvt8());
-              mov(TMP3.cvt8(), TMP1.cvt8());
               xor(TMP2.cvt8(), GetSrc<RA_8>(Op->Header.Args[1].ID()));
 
               // Updates RAX with the value from memory
               lock(); cmpxchg(byte [MemReg], TMP2.cvt8());
               jne(Loop);
-              // Result is the previous value from memory, which is currently in TMP3
-              movzx(GetDst<RA_64>(Node), TMP3.cvt8());
+              // cmpxchg only succeeds when RAX matched memory, so RAX still holds the previous value
+              movzx(GetDst<RA_64>(Node), TMP1.cvt8());
               break;
             }
             case 2: {
@@ -4316,15 +4904,14 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
               Label Loop;
               L(Loop);
               mov(TMP2.cvt16(), TMP1.cvt16());
-              mov(TMP3.cvt16(), TMP1.cvt16());
               xor(TMP2.cvt16(), GetSrc<RA_16>(Op->Header.Args[1].ID()));
 
               // Updates RAX with the value from memory
               lock(); cmpxchg(word [MemReg], TMP2.cvt16());
               jne(Loop);
 
-              // Result is the previous value from memory, which is currently in TMP3
-              movzx(GetDst<RA_64>(Node), TMP3.cvt16());
+              // cmpxchg only succeeds when RAX matched memory, so RAX still holds the previous value
+              movzx(GetDst<RA_64>(Node), TMP1.cvt16());
               break;
             }
             case 4: {
@@ -4333,15 +4920,14 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
               Label Loop;
               L(Loop);
               mov(TMP2.cvt32(), TMP1.cvt32());
-              mov(TMP3.cvt32(), TMP1.cvt32());
               xor(TMP2.cvt32(), GetSrc<RA_32>(Op->Header.Args[1].ID()));
 
               // Updates RAX with the value from memory
               lock(); cmpxchg(dword [MemReg], TMP2.cvt32());
               jne(Loop);
 
-              // Result is the previous value from memory, which is currently in TMP3
-              mov(GetDst<RA_32>(Node), TMP3.cvt32());
+              // cmpxchg only succeeds when RAX matched memory, so RAX still holds the previous value
+              mov(GetDst<RA_32>(Node), TMP1.cvt32());
               break;
             }
             case 8: {
@@ -4350,15 +4936,14 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
               Label Loop;
               L(Loop);
               mov(TMP2.cvt64(), TMP1.cvt64());
-              mov(TMP3.cvt64(), TMP1.cvt64());
               xor(TMP2.cvt64(), GetSrc<RA_64>(Op->Header.Args[1].ID()));
 
               // Updates RAX with the value from memory
               lock(); cmpxchg(qword [MemReg], TMP2.cvt64());
               jne(Loop);
 
-              // Result is the previous value from memory, which is currently in TMP3
-              mov(GetDst<RA_64>(Node), TMP3.cvt64());
+              // cmpxchg only succeeds when RAX matched memory, so RAX still holds the previous value
+              mov(GetDst<RA_64>(Node), TMP1.cvt64());
               break;
             }
             default:  LogMan::Msg::A("Unhandled AtomicFetchAdd size: %d", Op->Size);
@@ -4388,6 +4973,19 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_FINDMSB: {
           auto Op = IROp->C<IR::IROp_FindMSB>();
+          if (HostFeatures.LZCNT && OpSize >= 4) {
+            // lzcnt is cheaper than bsr on some hosts, bits - 1 - lzcnt is an xor since lzcnt can't exceed bits - 1 here
+            if (OpSize == 4) {
+              lzcnt(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()));
+              xor(GetDst<RA_32>(Node), 31);
+            }
+            else {
+              lzcnt(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()));
+              xor(GetDst<RA_64>(Node), 63);
+            }
+            break;
+          }
+
           switch (OpSize) {
           case 2:
             bsr(GetDst<RA_16>(Node), GetSrc<RA_16>(Op->Header.Args[0].ID()));
@@ -4423,6 +5021,27 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
         }
         case IR::OP_FINDTRAILINGZEROS: {
           auto Op = IROp->C<IR::IROp_FindTrailingZeros>();
+          if (!HostFeatures.BMI1) {
+            // tzcnt decodes as bsf without BMI1, which leaves the destination undefined for a zero source
+            mov(eax, OpSize * 8);
+            switch (OpSize) {
+              case 2:
+                bsf(GetDst<RA_16>(Node), GetSrc<RA_16>(Op->Header.Args[0].ID()));
+                cmovz(GetDst<RA_16>(Node), ax);
+                break;
+              case 4:
+                bsf(GetDst<RA_32>(Node), GetSrc<RA_32>(Op->Header.Args[0].ID()));
+                cmovz(GetDst<RA_32>(Node), eax);
+                break;
+              case 8:
+                bsf(GetDst<RA_64>(Node), GetSrc<RA_64>(Op->Header.Args[0].ID()));
+                cmovz(GetDst<RA_64>(Node), rax);
+                break;
+              default: LogMan::Msg::A("Unknown size: %d", OpSize); break;
+            }
+            break;
+          }
+
           switch (OpSize) {
             case 2:
               tzcnt(GetDst<RA_16>(Node), GetSrc<RA_16>(Op->Header.Args[0].ID()));
@@ -4437,6 +5056,19 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
           }
           break;
         }
+        case IR::OP_GUESTOPCODE: {
+          auto Op = IROp->C<IR::IROp_GuestOpcode>();
+          uint32_t HostOffset = getCurr<uintptr_t>() - reinterpret_cast<uintptr_t>(Entry);
+          auto &GuestOpcodes = DebugData->GuestOpcodes;
+          // A marker without any code in front of the next one covers nothing
+          if (!GuestOpcodes.empty() && GuestOpcodes.back().HostEntryOffset == HostOffset) {
+            GuestOpcodes.back().GuestRIP = Op->GuestRIP;
+          }
+          else {
+            GuestOpcodes.push_back({HostOffset, Op->GuestRIP});
+          }
+          break;
+        }
         case IR::OP_DUMMY:
         case IR::OP_IRHEADER:
         case IR::OP_PHIVALUE:
@@ -4453,20 +5085,15 @@ void *JITCore::CompileCode([[maybe_unused]] FEXCore::IR::IRListView<true> const
       }
       ++CodeBegin;
     }
-
-    if (BlockIROp->Next.ID() == 0) {
-      break;
-    } else {
-      BlockNode = BlockIROp->Next.GetNode(ListBegin);
-    }
   }
 
   void *Exit = getCurr<void*>();
 
   ready();
+  UpdateCodeStats();
 
   DebugData->HostCodeSize = reinterpret_cast<uintptr_t>(Exit) - reinterpret_cast<uintptr_t>(Entry);
-  return Entry;
+  return CodeMemory.ToExecutable(Entry);
 }
 
 void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
@@ -4480,7 +5107,7 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
 // 1St Argument: rdi <ThreadState>
 // XMM:
 // All temp
-  DispatchPtr = getCurr<CustomDispatch>();
+  DispatchPtr = reinterpret_cast<CustomDispatch>(CodeMemory.ToExecutable(getCurr<void*>()));
 
   // while (!Thread->State.RunningEvents.ShouldStop.load()) {
   //    Ptr = FindBlock(RIP)
@@ -4590,6 +5217,7 @@ void JITCore::CreateCustomDispatch(FEXCore::Core::InternalThreadState *Thread) {
   }
 
   ready();
+  UpdateCodeStats();
   // CustomDispatchGenerated = true;
 }
 
@@ -38,6 +38,22 @@ static void CPUIDRun_Thunk(CPUIDEmu::FunctionResults *Results, FEXCore::CPUIDEmu
   *Results = Class->RunFunction(Function);
 }
 
+// Element by element so overlapping copies see the elements that were already stored
+static void MemCpy_Thunk(uint64_t Dest, uint64_t Src, uint64_t Counter, int64_t Dir, uint8_t Size) {
+  for (uint64_t i = 0; i < Counter; ++i) {
+    memcpy(reinterpret_cast<void*>(Dest), reinterpret_cast<void*>(Src), Size);
+    Dest += Dir;
+    Src += Dir;
+  }
+}
+
+static void MemSet_Thunk(uint64_t Dest, uint64_t Value, uint64_t Counter, int64_t Dir, uint8_t Size) {
+  for (uint64_t i = 0; i < Counter; ++i) {
+    memcpy(reinterpret_cast<void*>(Dest), &Value, Size);
+    Dest += Dir;
+  }
+}
+
 static void SetExitState_Thunk(FEXCore::Core::InternalThreadState *Thread) {
   Thread->State.RunningEvents.ShouldStop = true;
 }
@@ -97,6 +113,8 @@ private:
   struct LLVMCurrentState {
     llvm::Function *SyscallFunction;
     llvm::Function *CPUIDFunction;
+    llvm::Function *MemCpyFunction;
+    llvm::Function *MemSetFunction;
     llvm::Function *ExitVMFunction;
     llvm::Function *ValuePrinter;
 #if defined(_M_ARM_64) && !defined(AARCH64_ON_X86)
@@ -734,6 +752,15 @@ private:
   FEXCore::IR::IRListView<true> const *CurrentIR;
 
   std::unordered_map<IR::OrderedNodeWrapper::NodeOffsetType, llvm::BasicBlock*> JumpTargets;
+  // The LLVM block that an IR block ends in, ops can create LLVM blocks of their own
+  std::unordered_map<IR::OrderedNodeWrapper::NodeOffsetType, llvm::BasicBlock*> BlockExits;
+
+  struct PendingPhi {
+    llvm::PHINode *Phi;
+    FEXCore::IR::IROp_Phi const *Op;
+  };
+  // Phis can reference values from blocks that haven't been emitted yet
+  std::vector<PendingPhi> PendingPhis;
 
   // Target Machines
 #ifdef _M_X86_64
@@ -920,6 +947,37 @@ void LLVMJITCore::CreateGlobalVariables(llvm::ExecutionEngine *Engine, llvm::Mod
     Engine->addGlobalMapping(JITCurrentState.CPUIDFunction, Ptr.Data);
   }
 
+  // MemCpy and MemSet Functions
+  {
+    auto FuncType = FunctionType::get(voidTy,
+      {
+        i64, // Dest
+        i64, // Src or Value
+        i64, // Counter
+        i64, // Direction
+        i8,  // Element size
+      },
+      false);
+    JITCurrentState.MemCpyFunction = Function::Create(FuncType,
+      Function::ExternalLinkage,
+      "MemCpy",
+      FunctionModule);
+    JITCurrentState.MemSetFunction = Function::Create(FuncType,
+      Function::ExternalLinkage,
+      "MemSet",
+      FunctionModule);
+    using ClassPtrType = void (*)(uint64_t, uint64_t, uint64_t, int64_t, uint8_t);
+    union PtrCast {
+      ClassPtrType ClassPtr;
+      void* Data;
+    };
+    PtrCast Ptr;
+    Ptr.ClassPtr = &MemCpy_Thunk;
+    Engine->addGlobalMapping(JITCurrentState.MemCpyFunction, Ptr.Data);
+    Ptr.ClassPtr = &MemSet_Thunk;
+    Engine->addGlobalMapping(JITCurrentState.MemSetFunction, Ptr.Data);
+  }
+
 #if defined(_M_ARM_64) && !defined(AARCH64_ON_X86)
   // AArch64ReadCycleCounter Function
   {
@@ -3821,11 +3879,46 @@ void LLVMJITCore::HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrap
       CreateMemoryStore(Dst, Src, Op->Align);
     break;
     }
+    case IR::OP_MEMCPY:
+    case IR::OP_MEMSET: {
+      auto Op = IROp->C<IR::IROp_MemCpy>();
+      auto Dst = GetSrc(Op->Header.Args[0]);
+      auto Src = GetSrc(Op->Header.Args[1]);
+      auto Counter = GetSrc(Op->Header.Args[2]);
+      auto Dir = GetSrc(Op->Header.Args[3]);
+
+      Dst = JITState.IRBuilder->CreateZExtOrTrunc(Dst, Type::getInt64Ty(*Con));
+      if (!ThreadState->CTX->Config.UnifiedMemory) {
+        Dst = JITState.IRBuilder->CreateAdd(Dst, JITState.IRBuilder->getInt64(CTX->MemoryMapper.GetBaseOffset<uint64_t>(0)));
+      }
+
+      // MemSet's second source is the value rather than a pointer
+      Src = JITState.IRBuilder->CreateZExtOrTrunc(Src, Type::getInt64Ty(*Con));
+      if (IROp->Op == IR::OP_MEMCPY && !ThreadState->CTX->Config.UnifiedMemory) {
+        Src = JITState.IRBuilder->CreateAdd(Src, JITState.IRBuilder->getInt64(CTX->MemoryMapper.GetBaseOffset<uint64_t>(0)));
+      }
+
+      std::vector<llvm::Value*> Args{};
+      Args.emplace_back(Dst);
+      Args.emplace_back(Src);
+      Args.emplace_back(JITState.IRBuilder->CreateZExtOrTrunc(Counter, Type::getInt64Ty(*Con)));
+      Args.emplace_back(JITState.IRBuilder->CreateSExtOrTrunc(Dir, Type::getInt64Ty(*Con)));
+      Args.emplace_back(JITState.IRBuilder->getInt8(Op->Size));
+      JITState.IRBuilder->CreateCall(IROp->Op == IR::OP_MEMCPY ? JITCurrentState.MemCpyFunction : JITCurrentState.MemSetFunction, Args);
+    break;
+    }
     case IR::OP_ATOMICFETCHADD:
     case IR::OP_ATOMICFETCHSUB:
     case IR::OP_ATOMICFETCHAND:
     case IR::OP_ATOMICFETCHOR:
-    case IR::OP_ATOMICFETCHXOR: {
+    case IR::OP_ATOMICFETCHXOR:
+    case IR::OP_ATOMICADD:
+    case IR::OP_ATOMICSUB:
+    case IR::OP_ATOMICAND:
+    case IR::OP_ATOMICOR:
+    case IR::OP_ATOMICXOR:
+    case IR::OP_ATOMICSWAP: {
+      // All of the atomics share the same layout, the non-fetching ones just don't have a destination
       auto Op = IROp->C<IR::IROp_AtomicFetchAdd>();
       auto Src = GetSrc(Op->Header.Args[0]);
       auto Value = GetSrc(Op->Header.Args[1]);
@@ -3840,15 +3933,33 @@ void LLVMJITCore::HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrap
         case IR::OP_ATOMICFETCHAND: AtomicOp = AtomicRMWInst::And; break;
         case IR::OP_ATOMICFETCHOR:  AtomicOp = AtomicRMWInst::Or; break;
         case IR::OP_ATOMICFETCHXOR: AtomicOp = AtomicRMWInst::Xor; break;
+        case IR::OP_ATOMICADD:      AtomicOp = AtomicRMWInst::Add; break;
+        case IR::OP_ATOMICSUB:      AtomicOp = AtomicRMWInst::Sub; break;
+        case IR::OP_ATOMICAND:      AtomicOp = AtomicRMWInst::And; break;
+        case IR::OP_ATOMICOR:       AtomicOp = AtomicRMWInst::Or; break;
+        case IR::OP_ATOMICXOR:      AtomicOp = AtomicRMWInst::Xor; break;
+        case IR::OP_ATOMICSWAP:     AtomicOp = AtomicRMWInst::Xchg; break;
         default: LogMan::Msg::A("Unknown Atomic Op: %d", IROp->Op);
       }
       // Cast the pointer type correctly
       Src = JITState.IRBuilder->CreateIntToPtr(Src, Type::getIntNTy(*Con, Op->Size * 8)->getPointerTo());
+      Value = JITState.IRBuilder->CreateZExtOrTrunc(Value, Src->getType()->getPointerElementType());
       auto Result = JITState.IRBuilder->CreateAtomicRMW(AtomicOp, Src, Value, AtomicOrdering::AcquireRelease);
-      SetDest(*WrapperOp, Result);
+      if (IROp->HasDest) {
+        SetDest(*WrapperOp, Result);
+      }
+    break;
+    }
+    case IR::OP_PHI: {
+      auto Op = IROp->C<IR::IROp_Phi>();
+      auto Phi = JITState.IRBuilder->CreatePHI(Type::getIntNTy(*Con, OpSize * 8), 2);
+      PendingPhis.emplace_back(PendingPhi{Phi, Op});
+      SetDest(*WrapperOp, Phi);
     break;
     }
+    case IR::OP_PHIVALUE:
     case IR::OP_DUMMY:
+    case IR::OP_GUESTOPCODE:
     break;
     default:
       LogMan::Msg::A("Unknown IR Op: %d(%s)", IROp->Op, FEXCore::IR::GetName(IROp->Op).data());
@@ -3859,6 +3970,8 @@ void LLVMJITCore::HandleIR(FEXCore::IR::IRListView<true> const *IR, IR::NodeWrap
 void* FEXCore::CPU::LLVMJITCore::CompileCode(FEXCore::IR::IRListView<true> const *IR, FEXCore::Core::DebugData *DebugData) {
   using namespace llvm;
   JumpTargets.clear();
+  BlockExits.clear();
+  PendingPhis.clear();
   JITCurrentState.Blocks.clear();
 
   CurrentIR = IR;
@@ -3866,7 +3979,7 @@ void* FEXCore::CPU::LLVMJITCore::CompileCode(FEXCore::IR::IRListView<true> const
 #if DESTMAP_AS_MAP
   DestMap.clear();
 #else
-  uintptr_t ListSize = CurrentIR->GetListSize();
+  uintptr_t ListSize = CurrentIR->GetSSACount();
   if (ListSize > DestMap.size()) {
     DestMap.resize(std::max(DestMap.size() * 2, ListSize));
   }
@@ -3973,6 +4086,8 @@ void* FEXCore::CPU::LLVMJITCore::CompileCode(FEXCore::IR::IRListView<true> const
       ++CodeBegin;
     }
 
+    BlockExits[BlockNode->Wrapped(ListBegin).ID()] = JITState.IRBuilder->GetInsertBlock();
+
     if (BlockIROp->Next.ID() == 0) {
       break;
     } else {
@@ -3980,6 +4095,22 @@ void* FEXCore::CPU::LLVMJITCore::CompileCode(FEXCore::IR::IRListView<true> const
     }
   }
 
+  // Every block has been emitted, now we can fill in the incoming values of the Phis
+  for (auto &Pending : PendingPhis) {
+    auto PhiValueNode = Pending.Op->PhiBegin;
+    while (PhiValueNode.ID() != 0) {
+      auto PhiValueOp = PhiValueNode.GetNode(ListBegin)->Op(DataBegin)->C<IR::IROp_PhiValue>();
+      auto IncomingBlock = BlockExits[PhiValueOp->Block.ID()];
+
+      // Values can have a different type per predecessor, cast them in the predecessor
+      JITState.IRBuilder->SetInsertPoint(IncomingBlock->getTerminator());
+      auto Value = CastToOpaqueStructure(GetSrc(PhiValueOp->Value), Pending.Phi->getType());
+      Pending.Phi->addIncoming(Value, IncomingBlock);
+
+      PhiValueNode = PhiValueOp->Next;
+    }
+  }
+
   llvm::ModulePassManager MPM;
 
   llvm::LoopAnalysisManager LAM;
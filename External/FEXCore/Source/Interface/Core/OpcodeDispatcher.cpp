@@ -1,3 +1,4 @@
+#include "Interface/Context/Context.h"
 #include "Interface/Core/OpcodeDispatcher.h"
 #include <FEXCore/Core/CoreState.h>
 #include <climits>
@@ -1097,7 +1098,7 @@ void OpDispatchBuilder::CMOVOp(OpcodeArgs) {
 }
 
 void OpDispatchBuilder::CPUIDOp(OpcodeArgs) {
-  OrderedNode *Src = LoadSource(FPRClass, Op, Op->Src[0], Op->Flags, -1);
+  OrderedNode *Src = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
   auto Res = _CPUID(Src);
 
   _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RAX]), _Zext(32, _VExtractToGPR(16, 4, Res, 0)));
@@ -1949,67 +1950,27 @@ void OpDispatchBuilder::STOSOp(OpcodeArgs) {
 
   }
   else {
-    // Create all our blocks
-    auto LoopHead = CreateNewCodeBlock();
-    auto LoopTail = CreateNewCodeBlock();
-    auto LoopEnd = CreateNewCodeBlock();
-
-    // At the time this was written, our RA can't handle accessing nodes across blocks.
-    // So we need to re-load and re-calculate essential values each iteration of the loop.
-
-    // First thing we need to do is finish this block and jump to the start of the loop.
-    _Jump(LoopHead);
-
-      SetCurrentCodeBlock(LoopHead);
-      {
-        OrderedNode *Counter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
-        auto ZeroConst = _Constant(0);
-
-        // Can we end the block?
-        auto CanLeaveCond = _Select(FEXCore::IR::COND_EQ,
-            Counter, ZeroConst,
-            _Constant(1), ZeroConst);
-
-        _CondJump(CanLeaveCond, LoopEnd, LoopTail);
-      }
-
-      SetCurrentCodeBlock(LoopTail);
-      {
-        OrderedNode *Src = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
-        OrderedNode *Dest = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
+    // REP STOS is a memset, the backends do the whole fill in one op
 
-        // Store to memory where RDI points
-        _StoreMem(GPRClass, Size, Dest, Src, Size);
-
-        OrderedNode *TailCounter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
-        OrderedNode *TailDest = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
-
-        // Decrement counter
-        TailCounter = _Sub(TailCounter, _Constant(1));
-
-        // Store the counter so we don't have to deal with PHI here
-        _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), TailCounter);
-
-        auto SizeConst = _Constant(Size);
-        auto NegSizeConst = _Constant(-Size);
-
-        // Calculate direction.
-        auto DF = GetRFLAG(FEXCore::X86State::RFLAG_DF_LOC);
-        auto PtrDir = _Select(FEXCore::IR::COND_EQ,
-            DF,  _Constant(0),
-            SizeConst, NegSizeConst);
+    auto SizeConst = _Constant(Size);
+    auto NegSizeConst = _Constant(-Size);
 
-        // Offset the pointer
-        TailDest = _Add(TailDest, PtrDir);
-        _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), TailDest);
+    // Calculate direction.
+    auto DF = GetRFLAG(FEXCore::X86State::RFLAG_DF_LOC);
+    auto PtrDir = _Select(FEXCore::IR::COND_EQ,
+        DF,  _Constant(0),
+        SizeConst, NegSizeConst);
 
-        // Jump back to the start, we have more work to do
-        _Jump(LoopHead);
-      }
+    OrderedNode *Src = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1);
+    OrderedNode *Counter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
+    OrderedNode *Dest = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
 
-    // Make sure to start a new block after ending this one
+    _MemSet(Dest, Src, Counter, PtrDir, Size);
 
-    SetCurrentCodeBlock(LoopEnd);
+    // RDI ends up one element past the last one stored, RCX runs down to zero
+    OrderedNode *TailDest = _Add(Dest, _Mul(Counter, PtrDir));
+    _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), TailDest);
+    _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), _Constant(0));
   }
 }
 
@@ -2019,72 +1980,30 @@ void OpDispatchBuilder::MOVSOp(OpcodeArgs) {
   if (Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_REP_PREFIX) {
     auto Size = GetSrcSize(Op);
 
-    // Create all our blocks
-    auto LoopHead = CreateNewCodeBlock();
-    auto LoopTail = CreateNewCodeBlock();
-    auto LoopEnd = CreateNewCodeBlock();
-
-    // At the time this was written, our RA can't handle accessing nodes across blocks.
-    // So we need to re-load and re-calculate essential values each iteration of the loop.
-
-    // First thing we need to do is finish this block and jump to the start of the loop.
-    _Jump(LoopHead);
-
-      SetCurrentCodeBlock(LoopHead);
-      {
-        OrderedNode *Counter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
-        auto ZeroConst = _Constant(0);
-
-        // Can we end the block?
-        auto CanLeaveCond = _Select(FEXCore::IR::COND_EQ,
-            Counter, ZeroConst,
-            _Constant(1), ZeroConst);
-
-        _CondJump(CanLeaveCond, LoopEnd, LoopTail);
-      }
-
-      SetCurrentCodeBlock(LoopTail);
-      {
-        OrderedNode *Src = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), GPRClass);
-        OrderedNode *Dest = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
-
-        Src = _LoadMem(GPRClass, Size, Src, Size);
-
-        // Store to memory where RDI points
-        _StoreMem(GPRClass, Size, Dest, Src, Size);
-
-        OrderedNode *TailCounter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
+    // REP MOVS is a memcpy, the backends do the whole copy in one op
 
-        // Decrement counter
-        TailCounter = _Sub(TailCounter, _Constant(1));
-
-        // Store the counter so we don't have to deal with PHI here
-        _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), TailCounter);
-
-        auto SizeConst = _Constant(Size);
-        auto NegSizeConst = _Constant(-Size);
+    auto SizeConst = _Constant(Size);
+    auto NegSizeConst = _Constant(-Size);
 
-        // Calculate direction.
-        auto DF = GetRFLAG(FEXCore::X86State::RFLAG_DF_LOC);
-        auto PtrDir = _Select(FEXCore::IR::COND_EQ,
-            DF,  _Constant(0),
-            SizeConst, NegSizeConst);
+    // Calculate direction.
+    auto DF = GetRFLAG(FEXCore::X86State::RFLAG_DF_LOC);
+    auto PtrDir = _Select(FEXCore::IR::COND_EQ,
+        DF,  _Constant(0),
+        SizeConst, NegSizeConst);
 
-        // Offset the pointer
-        OrderedNode *TailSrc = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), GPRClass);
-        OrderedNode *TailDest = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
-        TailSrc = _Add(TailSrc, PtrDir);
-        TailDest = _Add(TailDest, PtrDir);
-        _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), TailSrc);
-        _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), TailDest);
-
-        // Jump back to the start, we have more work to do
-        _Jump(LoopHead);
-      }
+    OrderedNode *Counter = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), GPRClass);
+    OrderedNode *Src = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), GPRClass);
+    OrderedNode *Dest = _LoadContext(8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), GPRClass);
 
-    // Make sure to start a new block after ending this one
+    _MemCpy(Dest, Src, Counter, PtrDir, Size);
 
-    SetCurrentCodeBlock(LoopEnd);
+    // Both pointers end up one element past the last one copied, RCX runs down to zero
+    OrderedNode *Offset = _Mul(Counter, PtrDir);
+    OrderedNode *TailSrc = _Add(Src, Offset);
+    OrderedNode *TailDest = _Add(Dest, Offset);
+    _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RSI]), TailSrc);
+    _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RDI]), TailDest);
+    _StoreContext(GPRClass, 8, offsetof(FEXCore::Core::CPUState, gregs[FEXCore::X86State::REG_RCX]), _Constant(0));
   }
   else {
     auto Size = GetSrcSize(Op);
@@ -3142,10 +3061,59 @@ OpDispatchBuilder::IRPair<IROp_CodeBlock> OpDispatchBuilder::CreateNewCodeBlock(
   return CodeNode;
 }
 
+OpDispatchBuilder::IRPair<IROp_CodeBlock> OpDispatchBuilder::CreateBlockBefore(OrderedNode *Block) {
+  uintptr_t ListBegin = Data.Begin();
+  uintptr_t DataBegin = Data.Begin();
+
+  auto OldCursor = GetWriteCursor();
+
+  // Link the new nodes right after the header so they don't end up inside of another block
+  auto HeaderNode = ViewIR().begin()()->GetNode(ListBegin);
+  auto HeaderOp = HeaderNode->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
+  SetWriteCursor(HeaderNode);
+
+  auto CodeNode = CreateCodeNode();
+  auto BeginNode = _Dummy();
+  _Jump(Block);
+  auto EndBlock = _EndBlock(0);
+  SetCodeNodeBegin(CodeNode, BeginNode);
+  SetCodeNodeLast(CodeNode, EndBlock);
+
+  OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+  if (BlockNode == Block) {
+    // New entry block
+    CodeNode.first->Next = Block->Wrapped(ListBegin);
+    HeaderOp->Blocks = CodeNode.Node->Wrapped(ListBegin);
+  }
+  else {
+    while (1) {
+      auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+      LogMan::Throw::A(BlockIROp->Next.ID() != 0, "Block %%ssa%d isn't in the block list", Block->Wrapped(ListBegin).ID());
+
+      if (BlockIROp->Next.GetNode(ListBegin) == Block) {
+        break;
+      }
+      BlockNode = BlockIROp->Next.GetNode(ListBegin);
+    }
+
+    LinkCodeBlocks(BlockNode, CodeNode);
+  }
+
+  SetWriteCursor(OldCursor);
+
+  return CodeNode;
+}
+
 void OpDispatchBuilder::SetCurrentCodeBlock(OrderedNode *Node) {
   CurrentCodeBlock = Node;
+  // Nodes from other blocks aren't usable here
+  ResetX87Cache();
   LogMan::Throw::A(Node->Op(Data.Begin())->Op == OP_CODEBLOCK, "Node wasn't codeblock. It was '%s'", std::string(IR::GetName(Node->Op(Data.Begin())->Op)).c_str());
-  SetWriteCursor(Node->Op(Data.Begin())->CW<IROp_CodeBlock>()->Begin.GetNode(ListData.Begin()));
+  SetWriteCursor(Node->Op(Data.Begin())->CW<IROp_CodeBlock>()->Begin.GetNode(Data.Begin()));
+
+  if (CurrentGuestOpcode) {
+    _GuestOpcode(CurrentGuestOpcode);
+  }
 }
 
 void OpDispatchBuilder::CreateJumpBlocks(std::vector<FEXCore::Frontend::Decoder::DecodedBlocks> const *Blocks) {
@@ -3176,15 +3144,18 @@ void OpDispatchBuilder::BeginFunction(uint64_t RIP, std::vector<FEXCore::Fronten
 
   auto Block = GetNewJumpBlock(RIP);
   SetCurrentCodeBlock(Block);
-  IRHeader.first->Blocks = Block->Wrapped(ListData.Begin());
+  IRHeader.first->Blocks = Block->Wrapped(Data.Begin());
 }
 
 void OpDispatchBuilder::Finalize() {
-  // Node 0 is invalid node
-  OrderedNode *RealNode = reinterpret_cast<OrderedNode*>(GetNode(1));
+  // Node 0 is invalid node, the header directly follows it
+  OrderedNode *RealNode = OrderedNodeWrapper::WrapOffset(sizeof(OrderedNode)).GetNode(Data.Begin());
   FEXCore::IR::IROp_Header *IROp = RealNode->Op(Data.Begin());
   LogMan::Throw::A(IROp->Op == OP_IRHEADER, "First op in function must be our header");
 
+  // The exits below don't belong to any guest instruction
+  CurrentGuestOpcode = 0;
+
   // Let's walk the jump blocks and see if we have handled every block target
   for (auto &Handler : JumpTargets) {
     if (Handler.second.HaveEmitted) continue;
@@ -3361,6 +3332,8 @@ void OpDispatchBuilder::StoreResult_WithOpSize(FEXCore::IR::RegisterClassType Cl
   }
   else if (Operand.TypeNone.Type == FEXCore::X86Tables::DecodedOperand::TYPE_GPR) {
     if (Operand.TypeGPR.GPR >= FEXCore::X86State::REG_MM_0) {
+      // MMX registers alias the x87 stack
+      ResetX87Cache();
       _StoreContext(Src, OpSize, offsetof(FEXCore::Core::CPUState, mm[Operand.TypeGPR.GPR - FEXCore::X86State::REG_MM_0]), Class);
     }
     else if (Operand.TypeGPR.GPR >= FEXCore::X86State::REG_XMM_0) {
@@ -3465,23 +3438,33 @@ void OpDispatchBuilder::StoreResult(FEXCore::IR::RegisterClassType Class, FEXCor
 
 OpDispatchBuilder::OpDispatchBuilder(FEXCore::Context::Context *ctx)
   : CTX {ctx}
-  , Data {8 * 1024 * 1024}
-  , ListData {8 * 1024 * 1024} {
+  , Data {8 * 1024 * 1024} {
   ResetWorkingList();
 }
 
 void OpDispatchBuilder::ResetWorkingList() {
   Data.Reset();
-  ListData.Reset();
   CodeBlocks.clear();
   JumpTargets.clear();
   BlockSetRIP = false;
   CurrentWriteCursor = nullptr;
   // This is necessary since we do "null" pointer checks
-  InvalidNode = reinterpret_cast<OrderedNode*>(ListData.Allocate(sizeof(OrderedNode)));
+  // It is always at offset 0 of the list, so ID 0 is invalid
+  InvalidNode = reinterpret_cast<OrderedNode*>(AllocateListData(sizeof(OrderedNode)));
   DecodeFailure = false;
   ShouldDump = false;
   CurrentCodeBlock = nullptr;
+  CurrentGuestOpcode = 0;
+  ResetX87Cache();
+}
+
+void OpDispatchBuilder::LoadIR(IRListView<true> const *IR) {
+  ResetWorkingList();
+
+  // The invalid node is the first node of the list, which the loaded IR already has
+  Data.Reset();
+  LogMan::Throw::A(Data.CheckSize(IR->GetDataSize()), "IR is too large to load");
+  memcpy(Data.Allocate(IR->GetDataSize()), reinterpret_cast<void*>(IR->GetData()), IR->GetDataSize());
 }
 
 template<unsigned BitOffset>
@@ -4843,20 +4826,23 @@ void OpDispatchBuilder::SetX87Top(OrderedNode *Value) {
 
 template<size_t width>
 void OpDispatchBuilder::FLD(OpcodeArgs) {
+  if (CTX->Config.X87ReducedPrecision) {
+    FLDF64<width>(Op);
+    return;
+  }
+
   // Update TOP
   auto orig_top = GetX87Top();
   auto top = _And(_Sub(orig_top, _Constant(1)), _Constant(7));
   SetX87Top(top);
 
-  size_t read_width = (width == 80) ? 16 : width / 8;
-
-  // Read from memory
-  auto data = LoadSource_WithOpSize(GPRClass, Op, Op->Src[0], read_width, Op->Flags, -1);
-
   OrderedNode *converted;
 
   // Convert to 80bit float
   if (width == 32 || width == 64) {
+    // Read from memory
+    auto data = LoadSource_WithOpSize(GPRClass, Op, Op->Src[0], width / 8, Op->Flags, -1);
+
     _Zext(32, data);
     if (width == 32)
       data = _Zext(32, data);
@@ -4883,7 +4869,19 @@ void OpDispatchBuilder::FLD(OpcodeArgs) {
     converted = _VInsElement(16, 8, 1, 0, converted, _VCastFromGPR(16, 8, upper));
   }
   else if (width == 80) {
-    // TODO
+    // Already in the layout of ST(i), only 10 bytes may be read so it is loaded in two parts
+    OrderedNode *Mem = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1, false);
+    if (Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_FS_PREFIX) {
+      Mem = _Add(Mem, _LoadContext(8, offsetof(FEXCore::Core::CPUState, fs), GPRClass));
+    }
+    else if (Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_GS_PREFIX) {
+      Mem = _Add(Mem, _LoadContext(8, offsetof(FEXCore::Core::CPUState, gs), GPRClass));
+    }
+
+    auto Mantissa = _LoadMem(GPRClass, 8, Mem, 1);
+    auto Upper = _LoadMem(GPRClass, 2, _Add(Mem, _Constant(8)), 1);
+    converted = _VCastFromGPR(16, 8, Mantissa);
+    converted = _VInsElement(16, 8, 1, 0, converted, _VCastFromGPR(16, 8, Upper));
   }
   // Write to ST[TOP]
   _StoreContextIndexed(converted, top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
@@ -4892,6 +4890,11 @@ void OpDispatchBuilder::FLD(OpcodeArgs) {
 
 template<size_t width, bool pop>
 void OpDispatchBuilder::FST(OpcodeArgs) {
+  if (CTX->Config.X87ReducedPrecision) {
+    FSTF64<width, pop>(Op);
+    return;
+  }
+
   auto orig_top = GetX87Top();
   if (width == 80) {
     auto data = _LoadContextIndexed(orig_top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
@@ -4907,6 +4910,11 @@ void OpDispatchBuilder::FST(OpcodeArgs) {
 }
 
 void OpDispatchBuilder::FADD(OpcodeArgs) {
+  if (CTX->Config.X87ReducedPrecision) {
+    FALUF64<IR::OP_VFADD, 0, false, false, true>(Op);
+    return;
+  }
+
   auto top = GetX87Top();
   OrderedNode* arg;
 
@@ -4974,6 +4982,234 @@ void OpDispatchBuilder::FADD(OpcodeArgs) {
   _StoreContextIndexed(result, top, 16, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
 }
 
+OrderedNode *OpDispatchBuilder::GetX87StackIndex(uint8_t Offset) {
+  if (!X87Cache.BaseTop) {
+    X87Cache.BaseTop = GetX87Top();
+  }
+
+  uint8_t Slot = (X87Cache.TopOffset + Offset) & 7;
+  if (!X87Cache.Index[Slot]) {
+    X87Cache.Index[Slot] = Slot == 0 ? X87Cache.BaseTop : _And(_Add(X87Cache.BaseTop, _Constant(Slot)), _Constant(7));
+  }
+  return X87Cache.Index[Slot];
+}
+
+OrderedNode *OpDispatchBuilder::LoadX87F64(uint8_t Offset) {
+  auto Index = GetX87StackIndex(Offset);
+  uint8_t Slot = (X87Cache.TopOffset + Offset) & 7;
+  if (!X87Cache.Values[Slot]) {
+    X87Cache.Values[Slot] = _LoadContextIndexed(Index, 8, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  }
+  return X87Cache.Values[Slot];
+}
+
+void OpDispatchBuilder::StoreX87F64(uint8_t Offset, OrderedNode *Value) {
+  auto Index = GetX87StackIndex(Offset);
+  uint8_t Slot = (X87Cache.TopOffset + Offset) & 7;
+  _StoreContextIndexed(Value, Index, 8, offsetof(FEXCore::Core::CPUState, mm[0][0]), 16, FPRClass);
+  X87Cache.Values[Slot] = Value;
+}
+
+void OpDispatchBuilder::PushX87F64(OrderedNode *Value) {
+  // Make sure BaseTop is loaded before TOP changes
+  GetX87StackIndex(0);
+  X87Cache.TopOffset = (X87Cache.TopOffset - 1) & 7;
+  SetX87Top(GetX87StackIndex(0));
+  StoreX87F64(0, Value);
+}
+
+void OpDispatchBuilder::PopX87F64() {
+  GetX87StackIndex(0);
+  X87Cache.TopOffset = (X87Cache.TopOffset + 1) & 7;
+  SetX87Top(GetX87StackIndex(0));
+}
+
+OrderedNode *OpDispatchBuilder::ConvertF80ToF64(OrderedNode *Mantissa, OrderedNode *Upper) {
+  // The mantissa is truncated, same as the arithmetic in this mode doesn't round to 80bit
+  auto Sign = _Lshl(_And(Upper, _Constant(0x8000)), _Constant(48));
+  auto Exponent = _And(Upper, _Constant(0x7FFF));
+
+  // Drops the explicit integer bit
+  auto Fraction = _And(_Lshr(Mantissa, _Constant(11)), _Constant(0x000FFFFFFFFFFFFFULL));
+  auto AdjustedExponent = _Lshl(_Sub(Exponent, _Constant(16383 - 1023)), _Constant(52));
+  OrderedNode *Result = _Or(AdjustedExponent, Fraction);
+
+  // Below the smallest normal double the value becomes a double denormal, the integer bit ends up in the fraction
+  // Anything shifted out entirely is zero, this covers zero and 80bit denormals as well
+  auto DenormalShift = _Sub(_Constant(16383 - 1023 + 12), Exponent);
+  auto Denormal = _Select(COND_UGT, DenormalShift, _Constant(63), _Constant(0), _Lshr(Mantissa, DenormalShift));
+  Result = _Select(COND_ULT, Exponent, _Constant(16383 - 1022), Denormal, Result);
+
+  // Above the largest double the value overflows to infinity
+  Result = _Select(COND_UGT, Exponent, _Constant(16383 + 1023), _Constant(0x7FF0000000000000ULL), Result);
+
+  // Infinity stays infinity, NaNs are quieted so they can't turn in to infinity when the low mantissa bits are dropped
+  auto NaN = _Or(Fraction, _Constant(0x7FF8000000000000ULL));
+  auto Special = _Select(COND_EQ, _Lshl(Mantissa, _Constant(1)), _Constant(0), _Constant(0x7FF0000000000000ULL), NaN);
+  Result = _Select(COND_EQ, Exponent, _Constant(0x7FFF), Special, Result);
+
+  return _VCastFromGPR(8, 8, _Or(Sign, Result));
+}
+
+OrderedNode *OpDispatchBuilder::ConvertF64ToF80(OrderedNode *Value) {
+  auto Data = _VExtractToGPR(8, 8, Value, 0);
+
+  auto Sign = _Lshr(_And(Data, _Constant(0x8000000000000000ULL)), _Constant(48));
+  auto Exponent = _Lshr(_And(Data, _Constant(0x7FF0000000000000ULL)), _Constant(52));
+  auto DataFraction = _And(Data, _Constant(0x000FFFFFFFFFFFFFULL));
+  auto Fraction = _Lshl(DataFraction, _Constant(11));
+
+  OrderedNode *AdjustedExponent = _Add(Exponent, _Constant(16383 - 1023));
+  AdjustedExponent = _Select(COND_EQ, Exponent, _Constant(0x7FF), _Constant(0x7FFF), AdjustedExponent);
+  OrderedNode *Mantissa = _Or(_Constant(1ULL << 63), Fraction);
+
+  // Double denormals are normal 80bit values, shift the highest set bit up to the integer bit
+  // FindMSB is meaningless for zero, the result is zero either way
+  auto MSB = _FindMSB(DataFraction);
+  auto DenormalExponent = _Select(COND_EQ, DataFraction, _Constant(0), _Constant(0), _Add(MSB, _Constant(16383 - 1074)));
+  auto DenormalMantissa = _Lshl(DataFraction, _Sub(_Constant(63), MSB));
+  AdjustedExponent = _Select(COND_EQ, Exponent, _Constant(0), DenormalExponent, AdjustedExponent);
+  Mantissa = _Select(COND_EQ, Exponent, _Constant(0), DenormalMantissa, Mantissa);
+
+  auto Lower = _VCastFromGPR(16, 8, Mantissa);
+  auto Upper = _VCastFromGPR(16, 8, _Or(Sign, AdjustedExponent));
+  return _VInsElement(16, 8, 1, 0, Lower, Upper);
+}
+
+template<size_t width>
+void OpDispatchBuilder::FLDF64(OpcodeArgs) {
+  if (!CTX->Config.X87ReducedPrecision) {
+    UnhandledOp(Op);
+    return;
+  }
+
+  OrderedNode *Data;
+  if (width == 80) {
+    // Only 10 bytes may be read so it is loaded in two parts
+    OrderedNode *Mem = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1, false);
+    if (Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_FS_PREFIX) {
+      Mem = _Add(Mem, _LoadContext(8, offsetof(FEXCore::Core::CPUState, fs), GPRClass));
+    }
+    else if (Op->Flags & FEXCore::X86Tables::DecodeFlags::FLAG_GS_PREFIX) {
+      Mem = _Add(Mem, _LoadContext(8, offsetof(FEXCore::Core::CPUState, gs), GPRClass));
+    }
+
+    auto Mantissa = _LoadMem(GPRClass, 8, Mem, 1);
+    auto Upper = _LoadMem(GPRClass, 2, _Add(Mem, _Constant(8)), 1);
+    Data = ConvertF80ToF64(Mantissa, Upper);
+  }
+  else {
+    Data = LoadSource_WithOpSize(FPRClass, Op, Op->Src[0], width / 8, Op->Flags, -1);
+    if (width == 32) {
+      Data = _Float_FToF(Data, 8, 4);
+    }
+  }
+
+  PushX87F64(Data);
+}
+
+void OpDispatchBuilder::FLD_StackF64(OpcodeArgs) {
+  if (!CTX->Config.X87ReducedPrecision) {
+    UnhandledOp(Op);
+    return;
+  }
+
+  PushX87F64(LoadX87F64(Op->OP & 7));
+}
+
+template<size_t width, bool pop>
+void OpDispatchBuilder::FSTF64(OpcodeArgs) {
+  if (!CTX->Config.X87ReducedPrecision) {
+    UnhandledOp(Op);
+    return;
+  }
+
+  auto Data = LoadX87F64(0);
+  if (width == 80) {
+    StoreResult_WithOpSize(FPRClass, Op, Op->Dest, ConvertF64ToF80(Data), 10, 1);
+  }
+  else if (width == 64) {
+    StoreResult_WithOpSize(FPRClass, Op, Op->Dest, Data, 8, -1);
+  }
+  else {
+    StoreResult_WithOpSize(FPRClass, Op, Op->Dest, _Float_FToF(Data, 4, 8), 4, -1);
+  }
+
+  if (pop) {
+    PopX87F64();
+  }
+}
+
+template<bool pop>
+void OpDispatchBuilder::FST_StackF64(OpcodeArgs) {
+  if (!CTX->Config.X87ReducedPrecision) {
+    UnhandledOp(Op);
+    return;
+  }
+
+  StoreX87F64(Op->OP & 7, LoadX87F64(0));
+
+  if (pop) {
+    PopX87F64();
+  }
+}
+
+void OpDispatchBuilder::FXCHF64(OpcodeArgs) {
+  if (!CTX->Config.X87ReducedPrecision) {
+    UnhandledOp(Op);
+    return;
+  }
+
+  uint8_t Offset = Op->OP & 7;
+  auto Top = LoadX87F64(0);
+  auto Other = LoadX87F64(Offset);
+  StoreX87F64(0, Other);
+  StoreX87F64(Offset, Top);
+}
+
+template<FEXCore::IR::IROps IROp, size_t width, bool ResInST0, bool Reverse, bool Pop>
+void OpDispatchBuilder::FALUF64(OpcodeArgs) {
+  if (!CTX->Config.X87ReducedPrecision) {
+    UnhandledOp(Op);
+    return;
+  }
+
+  // width is the size of the memory source, zero for the ST(0), ST(i) forms
+  OrderedNode *Src1;
+  OrderedNode *Src2;
+  uint8_t DestOffset = 0;
+  if (width != 0) {
+    Src1 = LoadX87F64(0);
+    Src2 = LoadSource_WithOpSize(FPRClass, Op, Op->Src[0], width / 8, Op->Flags, -1);
+    if (width == 32) {
+      Src2 = _Float_FToF(Src2, 8, 4);
+    }
+  }
+  else if (ResInST0) {
+    Src1 = LoadX87F64(0);
+    Src2 = LoadX87F64(Op->OP & 7);
+  }
+  else {
+    DestOffset = Op->OP & 7;
+    Src1 = LoadX87F64(DestOffset);
+    Src2 = LoadX87F64(0);
+  }
+
+  if (Reverse) {
+    std::swap(Src1, Src2);
+  }
+
+  auto ALUOp = _VFAdd(Src1, Src2, 8, 8);
+  // Overwrite our IR's op type
+  ALUOp.first->Header.Op = IROp;
+
+  StoreX87F64(DestOffset, ALUOp);
+
+  if (Pop) {
+    PopX87F64();
+  }
+}
+
 void OpDispatchBuilder::FXSaveOp(OpcodeArgs) {
   OrderedNode *Mem = LoadSource(GPRClass, Op, Op->Dest, Op->Flags, -1, false);
 
@@ -5051,6 +5287,7 @@ void OpDispatchBuilder::FXSaveOp(OpcodeArgs) {
 }
 
 void OpDispatchBuilder::FXRStoreOp(OpcodeArgs) {
+  ResetX87Cache();
   OrderedNode *Mem = LoadSource(GPRClass, Op, Op->Src[0], Op->Flags, -1, false);
   for (unsigned i = 0; i < 8; ++i) {
     OrderedNode *MemLocation = _Add(Mem, _Constant(i * 16 + 32));
@@ -5303,7 +5540,7 @@ void OpDispatchBuilder::UnimplementedOp(OpcodeArgs) {
 #undef OpcodeArgs
 
 void OpDispatchBuilder::ReplaceAllUsesWithInclusive(OrderedNode *Node, OrderedNode *NewNode, IR::NodeWrapperIterator After, IR::NodeWrapperIterator End) {
-  uintptr_t ListBegin = ListData.Begin();
+  uintptr_t ListBegin = Data.Begin();
   uintptr_t DataBegin = Data.Begin();
 
   while (After != End) {
@@ -5325,7 +5562,7 @@ void OpDispatchBuilder::ReplaceAllUsesWithInclusive(OrderedNode *Node, OrderedNo
 }
 
 void OpDispatchBuilder::ReplaceNodeArgument(OrderedNode *Node, uint8_t Arg, OrderedNode *NewArg) {
-  uintptr_t ListBegin = ListData.Begin();
+  uintptr_t ListBegin = Data.Begin();
   uintptr_t DataBegin = Data.Begin();
 
   FEXCore::IR::IROp_Header *IROp = Node->Op(DataBegin);
@@ -5337,7 +5574,7 @@ void OpDispatchBuilder::ReplaceNodeArgument(OrderedNode *Node, uint8_t Arg, Orde
 }
 
 void OpDispatchBuilder::RemoveArgUses(OrderedNode *Node) {
-  uintptr_t ListBegin = ListData.Begin();
+  uintptr_t ListBegin = Data.Begin();
   uintptr_t DataBegin = Data.Begin();
 
   FEXCore::IR::IROp_Header *IROp = Node->Op(DataBegin);
@@ -5352,7 +5589,7 @@ void OpDispatchBuilder::RemoveArgUses(OrderedNode *Node) {
 void OpDispatchBuilder::Remove(OrderedNode *Node) {
   RemoveArgUses(Node);
 
-  Node->Unlink(ListData.Begin());
+  Node->Unlink(Data.Begin());
 }
 
 void InstallOpcodeHandlers() {
@@ -5918,10 +6155,49 @@ constexpr uint16_t PF_F2 = 3;
 #define OPDReg(op, reg) (((op - 0xD8) << 8) | (reg << 3))
 #define OPD(op, modrmop) (((op - 0xD8) << 8) | modrmop)
   const std::vector<std::tuple<uint16_t, uint8_t, FEXCore::X86Tables::OpDispatchPtr>> X87OpTable = {
+    {OPDReg(0xD8, 0) | 0x00, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFADD, 32, true, false, false>},
+    {OPDReg(0xD8, 0) | 0x40, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFADD, 32, true, false, false>},
+    {OPDReg(0xD8, 0) | 0x80, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFADD, 32, true, false, false>},
+
+    {OPDReg(0xD8, 1) | 0x00, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFMUL, 32, true, false, false>},
+    {OPDReg(0xD8, 1) | 0x40, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFMUL, 32, true, false, false>},
+    {OPDReg(0xD8, 1) | 0x80, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFMUL, 32, true, false, false>},
+
+    {OPDReg(0xD8, 4) | 0x00, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 32, true, false, false>},
+    {OPDReg(0xD8, 4) | 0x40, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 32, true, false, false>},
+    {OPDReg(0xD8, 4) | 0x80, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 32, true, false, false>},
+
+    {OPDReg(0xD8, 5) | 0x00, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 32, true, true, false>},
+    {OPDReg(0xD8, 5) | 0x40, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 32, true, true, false>},
+    {OPDReg(0xD8, 5) | 0x80, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 32, true, true, false>},
+
+    {OPDReg(0xD8, 6) | 0x00, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 32, true, false, false>},
+    {OPDReg(0xD8, 6) | 0x40, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 32, true, false, false>},
+    {OPDReg(0xD8, 6) | 0x80, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 32, true, false, false>},
+
+    {OPDReg(0xD8, 7) | 0x00, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 32, true, true, false>},
+    {OPDReg(0xD8, 7) | 0x40, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 32, true, true, false>},
+    {OPDReg(0xD8, 7) | 0x80, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 32, true, true, false>},
+
+    {OPD(0xD8, 0xC0), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFADD, 0, true, false, false>},
+    {OPD(0xD8, 0xC8), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFMUL, 0, true, false, false>},
+    {OPD(0xD8, 0xE0), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 0, true, false, false>},
+    {OPD(0xD8, 0xE8), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 0, true, true, false>},
+    {OPD(0xD8, 0xF0), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 0, true, false, false>},
+    {OPD(0xD8, 0xF8), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 0, true, true, false>},
+
     {OPDReg(0xD9, 0) | 0x00, 8, &OpDispatchBuilder::FLD<32>},
     {OPDReg(0xD9, 0) | 0x40, 8, &OpDispatchBuilder::FLD<32>},
     {OPDReg(0xD9, 0) | 0x80, 8, &OpDispatchBuilder::FLD<32>},
 
+    {OPDReg(0xD9, 2) | 0x00, 8, &OpDispatchBuilder::FSTF64<32, false>},
+    {OPDReg(0xD9, 2) | 0x40, 8, &OpDispatchBuilder::FSTF64<32, false>},
+    {OPDReg(0xD9, 2) | 0x80, 8, &OpDispatchBuilder::FSTF64<32, false>},
+
+    {OPDReg(0xD9, 3) | 0x00, 8, &OpDispatchBuilder::FSTF64<32, true>},
+    {OPDReg(0xD9, 3) | 0x40, 8, &OpDispatchBuilder::FSTF64<32, true>},
+    {OPDReg(0xD9, 3) | 0x80, 8, &OpDispatchBuilder::FSTF64<32, true>},
+
     {OPDReg(0xD9, 5) | 0x00, 8, &OpDispatchBuilder::NOPOp}, // XXX: stubbed FLDCW
     {OPDReg(0xD9, 5) | 0x40, 8, &OpDispatchBuilder::NOPOp}, // XXX: stubbed FLDCW
     {OPDReg(0xD9, 5) | 0x80, 8, &OpDispatchBuilder::NOPOp}, // XXX: stubbed FLDCW
@@ -5930,15 +6206,69 @@ constexpr uint16_t PF_F2 = 3;
     {OPDReg(0xD9, 7) | 0x40, 8, &OpDispatchBuilder::NOPOp}, // XXX: stubbed FNSTCW
     {OPDReg(0xD9, 7) | 0x80, 8, &OpDispatchBuilder::NOPOp}, // XXX: stubbed FNSTCW
 
+    {OPD(0xD9, 0xC0), 8, &OpDispatchBuilder::FLD_StackF64},
+    {OPD(0xD9, 0xC8), 8, &OpDispatchBuilder::FXCHF64},
+
+    {OPDReg(0xDB, 5) | 0x00, 8, &OpDispatchBuilder::FLD<80>},
+    {OPDReg(0xDB, 5) | 0x40, 8, &OpDispatchBuilder::FLD<80>},
+    {OPDReg(0xDB, 5) | 0x80, 8, &OpDispatchBuilder::FLD<80>},
+
     {OPDReg(0xDB, 7) | 0x00, 8, &OpDispatchBuilder::FST<80, true>},
     {OPDReg(0xDB, 7) | 0x40, 8, &OpDispatchBuilder::FST<80, true>},
     {OPDReg(0xDB, 7) | 0x80, 8, &OpDispatchBuilder::FST<80, true>},
 
+    {OPDReg(0xDC, 0) | 0x00, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFADD, 64, true, false, false>},
+    {OPDReg(0xDC, 0) | 0x40, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFADD, 64, true, false, false>},
+    {OPDReg(0xDC, 0) | 0x80, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFADD, 64, true, false, false>},
+
+    {OPDReg(0xDC, 1) | 0x00, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFMUL, 64, true, false, false>},
+    {OPDReg(0xDC, 1) | 0x40, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFMUL, 64, true, false, false>},
+    {OPDReg(0xDC, 1) | 0x80, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFMUL, 64, true, false, false>},
+
+    {OPDReg(0xDC, 4) | 0x00, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 64, true, false, false>},
+    {OPDReg(0xDC, 4) | 0x40, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 64, true, false, false>},
+    {OPDReg(0xDC, 4) | 0x80, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 64, true, false, false>},
+
+    {OPDReg(0xDC, 5) | 0x00, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 64, true, true, false>},
+    {OPDReg(0xDC, 5) | 0x40, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 64, true, true, false>},
+    {OPDReg(0xDC, 5) | 0x80, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 64, true, true, false>},
+
+    {OPDReg(0xDC, 6) | 0x00, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 64, true, false, false>},
+    {OPDReg(0xDC, 6) | 0x40, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 64, true, false, false>},
+    {OPDReg(0xDC, 6) | 0x80, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 64, true, false, false>},
+
+    {OPDReg(0xDC, 7) | 0x00, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 64, true, true, false>},
+    {OPDReg(0xDC, 7) | 0x40, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 64, true, true, false>},
+    {OPDReg(0xDC, 7) | 0x80, 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 64, true, true, false>},
+
+    {OPD(0xDC, 0xC0), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFADD, 0, false, false, false>},
+    {OPD(0xDC, 0xC8), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFMUL, 0, false, false, false>},
+    {OPD(0xDC, 0xE0), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 0, false, true, false>},
+    {OPD(0xDC, 0xE8), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 0, false, false, false>},
+    {OPD(0xDC, 0xF0), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 0, false, true, false>},
+    {OPD(0xDC, 0xF8), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 0, false, false, false>},
+
     {OPDReg(0xDD, 0) | 0x00, 8, &OpDispatchBuilder::FLD<64>},
     {OPDReg(0xDD, 0) | 0x40, 8, &OpDispatchBuilder::FLD<64>},
     {OPDReg(0xDD, 0) | 0x80, 8, &OpDispatchBuilder::FLD<64>},
 
+    {OPDReg(0xDD, 2) | 0x00, 8, &OpDispatchBuilder::FSTF64<64, false>},
+    {OPDReg(0xDD, 2) | 0x40, 8, &OpDispatchBuilder::FSTF64<64, false>},
+    {OPDReg(0xDD, 2) | 0x80, 8, &OpDispatchBuilder::FSTF64<64, false>},
+
+    {OPDReg(0xDD, 3) | 0x00, 8, &OpDispatchBuilder::FSTF64<64, true>},
+    {OPDReg(0xDD, 3) | 0x40, 8, &OpDispatchBuilder::FSTF64<64, true>},
+    {OPDReg(0xDD, 3) | 0x80, 8, &OpDispatchBuilder::FSTF64<64, true>},
+
+    {OPD(0xDD, 0xD0), 8, &OpDispatchBuilder::FST_StackF64<false>},
+    {OPD(0xDD, 0xD8), 8, &OpDispatchBuilder::FST_StackF64<true>},
+
     {OPD(0xDE, 0xC0), 8, &OpDispatchBuilder::FADD},
+    {OPD(0xDE, 0xC8), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFMUL, 0, false, false, true>},
+    {OPD(0xDE, 0xE0), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 0, false, true, true>},
+    {OPD(0xDE, 0xE8), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFSUB, 0, false, false, true>},
+    {OPD(0xDE, 0xF0), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 0, false, true, true>},
+    {OPD(0xDE, 0xF8), 8, &OpDispatchBuilder::FALUF64<IR::OP_VFDIV, 0, false, false, true>},
   };
 #undef OPD
 #undef OPDReg
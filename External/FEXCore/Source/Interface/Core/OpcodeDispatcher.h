@@ -44,7 +44,7 @@ public:
 
     it->second.HaveEmitted = true;
 
-    if (CurrentCodeBlock->Wrapped(ListData.Begin()).ID() == it->second.BlockEntry->Wrapped(ListData.Begin()).ID()) return;
+    if (CurrentCodeBlock->Wrapped(Data.Begin()).ID() == it->second.BlockEntry->Wrapped(Data.Begin()).ID()) return;
 
     // We have hit a RIP that is a jump target
     // Thus we need to end up in a new block
@@ -83,9 +83,18 @@ public:
 
   OpDispatchBuilder(FEXCore::Context::Context *ctx);
 
-  IRListView<false> ViewIR() { return IRListView<false>(&Data, &ListData); }
-  IRListView<true> *CreateIRCopy() { return new IRListView<true>(&Data, &ListData); }
+  IRListView<false> ViewIR() { return IRListView<false>(&Data); }
+  /**
+   * @brief Copies the working list out
+   *
+   * @param Slab Where the copy lives. The copy is malloc'd and owned by the IRListView without one
+   */
+  IRListView<true> *CreateIRCopy(SlabAllocator *Slab = nullptr) { return new IRListView<true>(&Data, Slab); }
   void ResetWorkingList();
+  /**
+   * @brief Replaces the working list with a copy of IR, so the passes can be run on IR that didn't come from the frontend
+   */
+  void LoadIR(IRListView<true> const *IR);
   bool HadDecodeFailure() { return DecodeFailure; }
 
   void BeginFunction(uint64_t RIP, std::vector<FEXCore::Frontend::Decoder::DecodedBlocks> const *Blocks);
@@ -279,6 +288,19 @@ public:
   void FST(OpcodeArgs);
 
   void FADD(OpcodeArgs);
+
+  // X87 Ops in reduced precision mode, only used with X87ReducedPrecision set
+  template<size_t width>
+  void FLDF64(OpcodeArgs);
+  void FLD_StackF64(OpcodeArgs);
+  template<size_t width, bool pop>
+  void FSTF64(OpcodeArgs);
+  template<bool pop>
+  void FST_StackF64(OpcodeArgs);
+  void FXCHF64(OpcodeArgs);
+  template<FEXCore::IR::IROps IROp, size_t width, bool ResInST0, bool Reverse, bool Pop>
+  void FALUF64(OpcodeArgs);
+
   void FXSaveOp(OpcodeArgs);
   void FXRStoreOp(OpcodeArgs);
 
@@ -343,7 +365,7 @@ public:
     Op.first->Header.Elements = RegisterSize / ElementSize;
     Op.first->Header.NumArgs = 1;
     Op.first->Header.HasDest = true;
-    Op.first->Header.Args[0] = ssa0->Wrapped(ListData.Begin());
+    Op.first->Header.Args[0] = ssa0->Wrapped(Data.Begin());
     ssa0->AddUse();
     return Op;
   }
@@ -576,71 +598,71 @@ public:
   void AddPhiValue(IR::IROp_Phi *Phi, OrderedNode *Value) {
     // Got to do some bookkeeping first
     Value->AddUse();
-    auto ValueIROp = Value->Op(Data.Begin())->C<IR::IROp_PhiValue>()->Value.GetNode(ListData.Begin())->Op(Data.Begin());
+    auto ValueIROp = Value->Op(Data.Begin())->C<IR::IROp_PhiValue>()->Value.GetNode(Data.Begin())->Op(Data.Begin());
     Phi->Header.Size = ValueIROp->Size;
     Phi->Header.Elements = ValueIROp->Elements;
 
     if (!Phi->PhiBegin.ID()) {
-      Phi->PhiBegin = Phi->PhiEnd = Value->Wrapped(ListData.Begin());
+      Phi->PhiBegin = Phi->PhiEnd = Value->Wrapped(Data.Begin());
       return;
     }
-    auto PhiValueEndNode = Phi->PhiEnd.GetNode(ListData.Begin());
+    auto PhiValueEndNode = Phi->PhiEnd.GetNode(Data.Begin());
     auto PhiValueEndOp = PhiValueEndNode->Op(Data.Begin())->CW<IR::IROp_PhiValue>();
-    PhiValueEndOp->Next = Value->Wrapped(ListData.Begin());
+    PhiValueEndOp->Next = Value->Wrapped(Data.Begin());
   }
 
   void SetJumpTarget(IR::IROp_Jump *Op, OrderedNode *Target) {
     LogMan::Throw::A(Target->Op(Data.Begin())->Op == OP_CODEBLOCK,
         "Tried setting Jump target to %%ssa%d %s",
-        Target->Wrapped(ListData.Begin()).ID(),
+        Target->Wrapped(Data.Begin()).ID(),
         std::string(IR::GetName(Target->Op(Data.Begin())->Op)).c_str());
 
-    Op->Header.Args[0].NodeOffset = Target->Wrapped(ListData.Begin()).NodeOffset;
+    Op->Header.Args[0].NodeOffset = Target->Wrapped(Data.Begin()).NodeOffset;
   }
   void SetTrueJumpTarget(IR::IROp_CondJump *Op, OrderedNode *Target) {
     LogMan::Throw::A(Target->Op(Data.Begin())->Op == OP_CODEBLOCK,
         "Tried setting CondJump target to %%ssa%d %s",
-        Target->Wrapped(ListData.Begin()).ID(),
+        Target->Wrapped(Data.Begin()).ID(),
         std::string(IR::GetName(Target->Op(Data.Begin())->Op)).c_str());
 
-    Op->Header.Args[1].NodeOffset = Target->Wrapped(ListData.Begin()).NodeOffset;
+    Op->Header.Args[1].NodeOffset = Target->Wrapped(Data.Begin()).NodeOffset;
   }
   void SetFalseJumpTarget(IR::IROp_CondJump *Op, OrderedNode *Target) {
     LogMan::Throw::A(Target->Op(Data.Begin())->Op == OP_CODEBLOCK,
         "Tried setting CondJump target to %%ssa%d %s",
-        Target->Wrapped(ListData.Begin()).ID(),
+        Target->Wrapped(Data.Begin()).ID(),
         std::string(IR::GetName(Target->Op(Data.Begin())->Op)).c_str());
 
-    Op->Header.Args[2].NodeOffset = Target->Wrapped(ListData.Begin()).NodeOffset;
+    Op->Header.Args[2].NodeOffset = Target->Wrapped(Data.Begin()).NodeOffset;
   }
 
   void SetJumpTarget(IRPair<IROp_Jump> Op, OrderedNode *Target) {
     LogMan::Throw::A(Target->Op(Data.Begin())->Op == OP_CODEBLOCK,
         "Tried setting Jump target to %%ssa%d %s",
-        Target->Wrapped(ListData.Begin()).ID(),
+        Target->Wrapped(Data.Begin()).ID(),
         std::string(IR::GetName(Target->Op(Data.Begin())->Op)).c_str());
 
-    Op.first->Header.Args[0].NodeOffset = Target->Wrapped(ListData.Begin()).NodeOffset;
+    Op.first->Header.Args[0].NodeOffset = Target->Wrapped(Data.Begin()).NodeOffset;
   }
   void SetTrueJumpTarget(IRPair<IROp_CondJump> Op, OrderedNode *Target) {
     LogMan::Throw::A(Target->Op(Data.Begin())->Op == OP_CODEBLOCK,
         "Tried setting CondJump target to %%ssa%d %s",
-        Target->Wrapped(ListData.Begin()).ID(),
+        Target->Wrapped(Data.Begin()).ID(),
         std::string(IR::GetName(Target->Op(Data.Begin())->Op)).c_str());
-    Op.first->Header.Args[1].NodeOffset = Target->Wrapped(ListData.Begin()).NodeOffset;
+    Op.first->Header.Args[1].NodeOffset = Target->Wrapped(Data.Begin()).NodeOffset;
   }
   void SetFalseJumpTarget(IRPair<IROp_CondJump> Op, OrderedNode *Target) {
     LogMan::Throw::A(Target->Op(Data.Begin())->Op == OP_CODEBLOCK,
         "Tried setting CondJump target to %%ssa%d %s",
-        Target->Wrapped(ListData.Begin()).ID(),
+        Target->Wrapped(Data.Begin()).ID(),
         std::string(IR::GetName(Target->Op(Data.Begin())->Op)).c_str());
-    Op.first->Header.Args[2].NodeOffset = Target->Wrapped(ListData.Begin()).NodeOffset;
+    Op.first->Header.Args[2].NodeOffset = Target->Wrapped(Data.Begin()).NodeOffset;
   }
 
   /**  @} */
 
   bool IsValueConstant(OrderedNodeWrapper ssa, uint64_t *Constant) {
-     OrderedNode *RealNode = ssa.GetNode(ListData.Begin());
+     OrderedNode *RealNode = ssa.GetNode(Data.Begin());
      FEXCore::IR::IROp_Header *IROp = RealNode->Op(Data.Begin());
      if (IROp->Op == OP_CONSTANT) {
        auto Op = IROp->C<IR::IROp_Constant>();
@@ -677,10 +699,8 @@ public:
   OrderedNode *GetPackedRFLAG(bool Lower8);
 
   void CopyData(OpDispatchBuilder const &rhs) {
-    LogMan::Throw::A(rhs.Data.BackingSize() <= Data.BackingSize(), "Trying to take ownership of data that is too large");
-    LogMan::Throw::A(rhs.ListData.BackingSize() <= ListData.BackingSize(), "Trying to take ownership of data that is too large");
+    LogMan::Throw::A(rhs.Data.Size() <= Data.BackingSize(), "Trying to take ownership of data that is too large");
     Data.CopyData(rhs.Data);
-    ListData.CopyData(rhs.ListData);
     InvalidNode = rhs.InvalidNode;
     CurrentWriteCursor = rhs.CurrentWriteCursor;
     CodeBlocks = rhs.CodeBlocks;
@@ -712,13 +732,13 @@ public:
   void SetCodeNodeBegin(OrderedNode *CodeNode, OrderedNode *Begin) {
      FEXCore::IR::IROp_CodeBlock *IROp = CodeNode->Op(Data.Begin())->CW<FEXCore::IR::IROp_CodeBlock>();
      LogMan::Throw::A(IROp->Header.Op == IROps::OP_CODEBLOCK, "Invalid");
-     IROp->Begin = Begin->Wrapped(ListData.Begin());
+     IROp->Begin = Begin->Wrapped(Data.Begin());
   }
 
   void SetCodeNodeLast(OrderedNode *CodeNode, OrderedNode *Last) {
      FEXCore::IR::IROp_CodeBlock *IROp = CodeNode->Op(Data.Begin())->CW<FEXCore::IR::IROp_CodeBlock>();
      LogMan::Throw::A(IROp->Header.Op == IROps::OP_CODEBLOCK, "Invalid");
-     IROp->Last = Last->Wrapped(ListData.Begin());
+     IROp->Last = Last->Wrapped(Data.Begin());
   }
 
   /**
@@ -739,7 +759,7 @@ public:
      OrderedNodeWrapper OldNext = CurrentIROp->Next;
      // First thing is to assign CodeNode->Next to the incoming node
      {
-       CurrentIROp->Next = Next->Wrapped(ListData.Begin());
+       CurrentIROp->Next = Next->Wrapped(Data.Begin());
      }
 
      // Second thing is to assign the incoming node's Next to what was in CodeNode->Next
@@ -752,11 +772,29 @@ public:
   }
 
   IRPair<IROp_CodeBlock> CreateNewCodeBlock();
+
+  /**
+   * @brief Creates a new block that jumps to Block and links it in front of Block
+   *
+   * Usable after Finalize, from the optimization passes.
+   * Nothing is retargeted, branches that should go through the new block need to be updated by the caller.
+   */
+  IRPair<IROp_CodeBlock> CreateBlockBefore(OrderedNode *Block);
   void SetCurrentCodeBlock(OrderedNode *Node);
 
   void SetMultiblock(bool _Multiblock) { Multiblock = _Multiblock; }
   bool GetMultiblock() { return Multiblock; }
 
+  /**
+   * @brief Marks the start of the guest instruction at RIP for the JIT symbol line tables
+   *
+   * Blocks that get switched to in the middle of the instruction are marked again, so their code isn't attributed to whatever the JIT emits in front of them.
+   */
+  void StartGuestOpcode(uint64_t RIP) {
+    CurrentGuestOpcode = RIP;
+    _GuestOpcode(RIP);
+  }
+
 private:
   void RemoveArgUses(OrderedNode *Node);
   bool DecodeFailure{false};
@@ -796,12 +834,43 @@ private:
   OrderedNode * GetX87Top();
   void SetX87Top(OrderedNode *Value);
 
-  OrderedNode *CreateNode(IROp_Header *Op) {
-    uintptr_t ListBegin = ListData.Begin();
-    size_t Size = sizeof(OrderedNode);
-    void *Ptr = ListData.Allocate(Size);
+  /**
+   * @name Reduced precision x87 stack
+   *
+   * The stack registers hold a host double in the low half of each mm register.
+   * TOP is tracked as a constant offset from the TOP the code block started with,
+   * so every stack slot maps to a single index node and values written earlier in the block don't need to be reloaded.
+   * @{ */
+  struct X87StackCache {
+    OrderedNode *BaseTop;   ///< TOP when the current code block first touched the stack, nullptr if nothing is tracked
+    uint8_t TopOffset;      ///< Current TOP relative to BaseTop
+    OrderedNode *Index[8];  ///< mm register index of each slot relative to BaseTop
+    OrderedNode *Values[8]; ///< Known value of each slot relative to BaseTop
+  };
+  X87StackCache X87Cache{};
+
+  void ResetX87Cache() { X87Cache = {}; }
+  OrderedNode *GetX87StackIndex(uint8_t Offset);
+  OrderedNode *LoadX87F64(uint8_t Offset);
+  void StoreX87F64(uint8_t Offset, OrderedNode *Value);
+  void PushX87F64(OrderedNode *Value);
+  void PopX87F64();
+  OrderedNode *ConvertF80ToF64(OrderedNode *Mantissa, OrderedNode *Upper);
+  OrderedNode *ConvertF64ToF80(OrderedNode *Value);
+  /**  @} */
+
+  // Ops are all a multiple of 4 bytes already, this only keeps the nodes that follow odd sized allocations aligned
+  void *AllocateListData(size_t Size) {
+    constexpr size_t Alignment = alignof(OrderedNode);
+    return Data.Allocate((Size + Alignment - 1) & ~(Alignment - 1));
+  }
+
+  // Allocates a node along with the space for its op, which directly follows the node
+  OrderedNode *CreateNode(size_t OpSize) {
+    uintptr_t ListBegin = Data.Begin();
+    void *Ptr = AllocateListData(sizeof(OrderedNode) + OpSize);
     OrderedNode *Node = new (Ptr) OrderedNode();
-    Node->Header.Value.SetOffset(Data.Begin(), reinterpret_cast<uintptr_t>(Op));
+    Node->Header.Value.SetOffset(ListBegin, reinterpret_cast<uintptr_t>(Ptr) + sizeof(OrderedNode));
 
     if (CurrentWriteCursor) {
       CurrentWriteCursor->append(ListBegin, Node);
@@ -810,15 +879,9 @@ private:
     return Node;
   }
 
-  OrderedNode *GetNode(uint32_t SSANode) {
-    uintptr_t ListBegin = ListData.Begin();
-    OrderedNode *Node = reinterpret_cast<OrderedNode *>(ListBegin + SSANode * sizeof(OrderedNode));
-    return Node;
-  }
-
   OrderedNode *EmplaceOrphanedNode(OrderedNode *OldNode) {
     size_t Size = sizeof(OrderedNode);
-    OrderedNode *Ptr = reinterpret_cast<OrderedNode*>(ListData.Allocate(Size));
+    OrderedNode *Ptr = reinterpret_cast<OrderedNode*>(AllocateListData(Size));
     memcpy(Ptr, OldNode, Size);
     return Ptr;
   }
@@ -832,14 +895,14 @@ private:
 
   OrderedNode *CurrentWriteCursor = nullptr;
 
-  // These could be combined with a little bit of work to be more efficient with memory usage. Isn't a big deal
+  // Nodes and their ops are interleaved in the same allocator
   IntrusiveAllocator Data;
-  IntrusiveAllocator ListData;
 
   OrderedNode *InvalidNode;
   OrderedNode *CurrentCodeBlock{};
   std::vector<OrderedNode*> CodeBlocks;
   bool Multiblock{};
+  uint64_t CurrentGuestOpcode{}; ///< Last RIP passed to StartGuestOpcode, zero outside of marked instructions
   uint64_t Entry;
 };
 
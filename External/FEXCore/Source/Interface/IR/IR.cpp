@@ -1,5 +1,6 @@
 #include <FEXCore/IR/IR.h>
 #include <FEXCore/IR/IntrusiveIRList.h>
+#include "Interface/IR/IRLoader.h"
 #include "LogManager.h"
 
 namespace FEXCore::IR {
@@ -140,20 +141,18 @@ void Dump(std::stringstream *out, IRListView<false> const* IR) {
           auto Op = IROp->C<IR::IROp_Phi>();
           auto NodeBegin = IR->at(Op->PhiBegin);
           *out << " ";
+          PrintArg(out, IR, RegisterClassType{Op->Class});
 
           while (NodeBegin != NodeBegin.Invalid()) {
             OrderedNodeWrapper *NodeOp = NodeBegin();
             OrderedNode *NodeNode = NodeOp->GetNode(ListBegin);
             auto IRNodeOp  = NodeNode->Op(DataBegin)->C<IR::IROp_PhiValue>();
-            *out << "[ ";
+            *out << ", [ ";
             PrintArg(out, IR, IRNodeOp->Value);
             *out << ", ";
             PrintArg(out, IR, IRNodeOp->Block);
             *out << " ]";
 
-            if (IRNodeOp->Next.ID())
-              *out << ", ";
-
             NodeBegin = IR->at(IRNodeOp->Next);
           }
           break;
@@ -183,4 +182,273 @@ void Dump(std::stringstream *out, IRListView<false> const* IR) {
   }
 }
 
+// Ops are written out in the order Dump prints them, the arguments of every op are generated from IR.json
+// SSA values are renumbered in that order and most values are LEB128 encoded, so dead ops and sparse IDs don't take up space
+constexpr uint32_t SERIALIZE_MAGIC = 0x52495846; // 'FXIR'
+constexpr uint32_t SERIALIZE_VERSION = 2;
+
+struct SerializedHeader {
+  uint32_t Magic;
+  uint32_t Version;
+};
+
+namespace {
+  struct SerializeWriter {
+    std::ostream *out;
+    // Node ID -> Serialized ID
+    std::vector<uint32_t> IDs;
+  };
+
+  struct DeserializeReader {
+    std::istream *in;
+    bool Error;
+  };
+
+  void WriteVarint(SerializeWriter *Writer, uint64_t Value) {
+    do {
+      uint8_t Byte = Value & 0x7F;
+      Value >>= 7;
+      Writer->out->put(Byte | (Value ? 0x80 : 0));
+    } while (Value);
+  }
+
+  void WriteArg(SerializeWriter *Writer, uint64_t Arg) {
+    WriteVarint(Writer, Arg);
+  }
+
+  void WriteArg(SerializeWriter *Writer, uint32_t Arg) {
+    WriteVarint(Writer, Arg);
+  }
+
+  void WriteArg(SerializeWriter *Writer, uint8_t Arg) {
+    Writer->out->put(Arg);
+  }
+
+  void WriteArg(SerializeWriter *Writer, CondClassType Arg) {
+    Writer->out->put(Arg.Val);
+  }
+
+  void WriteArg(SerializeWriter *Writer, RegisterClassType Arg) {
+    WriteVarint(Writer, Arg.Val);
+  }
+
+  void WriteArg(SerializeWriter *Writer, OrderedNodeWrapper Arg) {
+    uint32_t ID = Writer->IDs.at(Arg.ID());
+    LogMan::Throw::A(ID != ~0U, "%%ssa%d is used but isn't in any block", Arg.ID());
+    WriteVarint(Writer, ID);
+  }
+
+  uint64_t ReadVarint(DeserializeReader *Reader) {
+    uint64_t Value{};
+    for (uint32_t Shift = 0; Shift < 64; Shift += 7) {
+      int Byte = Reader->in->get();
+      if (Byte == std::char_traits<char>::eof()) {
+        break;
+      }
+
+      Value |= static_cast<uint64_t>(Byte & 0x7F) << Shift;
+      if (!(Byte & 0x80)) {
+        return Value;
+      }
+    }
+
+    Reader->Error = true;
+    return 0;
+  }
+
+  template<typename Type>
+  Type ReadArg(DeserializeReader *Reader);
+
+  template<>
+  uint64_t ReadArg(DeserializeReader *Reader) {
+    return ReadVarint(Reader);
+  }
+
+  template<>
+  uint32_t ReadArg(DeserializeReader *Reader) {
+    uint64_t Value = ReadVarint(Reader);
+    Reader->Error |= Value > ~0U;
+    return Value;
+  }
+
+  template<>
+  uint8_t ReadArg(DeserializeReader *Reader) {
+    int Byte = Reader->in->get();
+    Reader->Error |= Byte == std::char_traits<char>::eof();
+    return Byte;
+  }
+
+  template<>
+  CondClassType ReadArg(DeserializeReader *Reader) {
+    return CondClassType{ReadArg<uint8_t>(Reader)};
+  }
+
+  template<>
+  RegisterClassType ReadArg(DeserializeReader *Reader) {
+    return RegisterClassType{ReadArg<uint32_t>(Reader)};
+  }
+
+  template<>
+  OrderedNodeWrapper ReadArg(DeserializeReader *Reader) {
+    return IRLoader::WrapID(ReadArg<uint32_t>(Reader));
+  }
+
+  void WriteOp(SerializeWriter *Writer, IRListView<false> const* IR, IROp_Header const *IROp) {
+    uintptr_t ListBegin = IR->GetListData();
+    uintptr_t DataBegin = IR->GetData();
+
+    WriteArg(Writer, static_cast<uint8_t>(IROp->Op));
+    WriteArg(Writer, IROp->Size);
+    WriteArg(Writer, static_cast<uint8_t>((IROp->HasDest << 7) | IROp->Elements));
+
+    #define IROP_SERIALIZE_HELPER
+    #include <FEXCore/IR/IRDefines.inc>
+    case IR::OP_PHI: {
+      auto Op = IROp->C<IR::IROp_Phi>();
+      WriteArg(Writer, Op->Class);
+
+      std::vector<IROp_PhiValue const*> Values;
+      auto NodeBegin = IR->at(Op->PhiBegin);
+      while (NodeBegin != NodeBegin.Invalid()) {
+        OrderedNode *NodeNode = NodeBegin()->GetNode(ListBegin);
+        auto IRNodeOp = NodeNode->Op(DataBegin)->C<IR::IROp_PhiValue>();
+        Values.emplace_back(IRNodeOp);
+        NodeBegin = IR->at(IRNodeOp->Next);
+      }
+
+      WriteVarint(Writer, Values.size());
+      for (auto Value : Values) {
+        WriteArg(Writer, Value->Value);
+        WriteArg(Writer, Value->Block);
+      }
+      break;
+    }
+    default: LogMan::Msg::A("Can't serialize %s", std::string(GetName(IROp->Op)).c_str()); break;
+    }
+  }
+
+  void ReadOp(DeserializeReader *Reader, IRLoader *Loader, uint32_t ID) {
+    uint8_t RawOp = ReadArg<uint8_t>(Reader);
+    uint8_t Size = ReadArg<uint8_t>(Reader);
+    uint8_t Flags = ReadArg<uint8_t>(Reader);
+    if (Reader->Error || RawOp >= OP_LAST) {
+      Reader->Error = true;
+      return;
+    }
+
+    auto IROp = Loader->AllocateOp(ID, static_cast<IROps>(RawOp));
+    IROp->Size = Size;
+    IROp->Elements = Flags & 0x7F;
+    IROp->HasDest = Flags >> 7;
+
+    #define IROP_DESERIALIZE_HELPER
+    #include <FEXCore/IR/IRDefines.inc>
+    case IR::OP_PHI: {
+      auto Op = IROp->CW<IR::IROp_Phi>();
+      Op->Header.NumArgs = 2;
+      Op->Class = ReadArg<uint8_t>(Reader);
+
+      // Allocating the values invalidates the Phi op
+      uint64_t NumValues = ReadVarint(Reader);
+      for (uint64_t i = 0; i < NumValues && !Reader->Error; ++i) {
+        auto Value = ReadArg<OrderedNodeWrapper>(Reader);
+        auto Block = ReadArg<OrderedNodeWrapper>(Reader);
+
+        auto ValueOp = Loader->AllocateOp(0, OP_PHIVALUE)->CW<IR::IROp_PhiValue>();
+        ValueOp->Value = Value;
+        ValueOp->Block = Block;
+      }
+      break;
+    }
+    default: Reader->Error = true; break;
+    }
+  }
+}
+
+void Serialize(std::ostream *out, IRListView<false> const* IR) {
+  uintptr_t ListBegin = IR->GetListData();
+  uintptr_t DataBegin = IR->GetData();
+
+  // Gather the ops in the order they get written out
+  // PhiValues are written out as part of their Phi
+  std::vector<OrderedNode*> Nodes;
+
+  OrderedNode *HeaderNode = IR->begin()()->GetNode(ListBegin);
+  auto HeaderOp = HeaderNode->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
+  LogMan::Throw::A(HeaderOp->Header.Op == OP_IRHEADER, "First op wasn't IRHeader");
+  Nodes.emplace_back(HeaderNode);
+
+  OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+  while (1) {
+    auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+    LogMan::Throw::A(BlockIROp->Header.Op == OP_CODEBLOCK, "IR type failed to be a code block");
+    Nodes.emplace_back(BlockNode);
+
+    // We grab these nodes this way so we can iterate easily
+    auto CodeBegin = IR->at(BlockIROp->Begin);
+    auto CodeLast = IR->at(BlockIROp->Last);
+
+    while (1) {
+      OrderedNode *CodeNode = CodeBegin()->GetNode(ListBegin);
+      if (CodeNode->Op(DataBegin)->Op != OP_PHIVALUE) {
+        Nodes.emplace_back(CodeNode);
+      }
+
+      // CodeLast is inclusive. So we still need to write the CodeLast op as well
+      if (CodeBegin == CodeLast) {
+        break;
+      }
+      ++CodeBegin;
+    }
+
+    if (BlockIROp->Next.ID() == 0) {
+      break;
+    } else {
+      BlockNode = BlockIROp->Next.GetNode(ListBegin);
+    }
+  }
+
+  // ID 0 stays the invalid node
+  SerializeWriter Writer{out, std::vector<uint32_t>(IR->GetSSACount(), ~0U)};
+  Writer.IDs[0] = 0;
+  for (size_t i = 0; i < Nodes.size(); ++i) {
+    Writer.IDs[Nodes[i]->Wrapped(ListBegin).ID()] = i + 1;
+  }
+
+  SerializedHeader Header{SERIALIZE_MAGIC, SERIALIZE_VERSION};
+  out->write(reinterpret_cast<char const*>(&Header), sizeof(Header));
+  WriteVarint(&Writer, Nodes.size());
+
+  for (auto Node : Nodes) {
+    WriteOp(&Writer, IR, Node->Op(DataBegin));
+  }
+}
+
+IRListView<true> *Deserialize(std::istream *in) {
+  SerializedHeader Header{};
+  if (!in->read(reinterpret_cast<char*>(&Header), sizeof(Header))) {
+    return nullptr;
+  }
+
+  if (Header.Magic != SERIALIZE_MAGIC || Header.Version != SERIALIZE_VERSION) {
+    LogMan::Msg::E("Serialized IR has unknown magic or version");
+    return nullptr;
+  }
+
+  DeserializeReader Reader{in, false};
+  IRLoader Loader;
+
+  uint64_t NumOps = ReadVarint(&Reader);
+  for (uint64_t ID = 1; ID <= NumOps && !Reader.Error; ++ID) {
+    ReadOp(&Reader, &Loader, ID);
+  }
+
+  if (Reader.Error) {
+    LogMan::Msg::E("Serialized IR was truncated or corrupt");
+    return nullptr;
+  }
+
+  return Loader.CreateIR();
+}
+
 }
@@ -0,0 +1,172 @@
+#include "Interface/IR/IRLoader.h"
+#include "Interface/Core/OpcodeDispatcher.h"
+
+#include "LogManager.h"
+
+#include <unordered_map>
+
+namespace FEXCore::IR {
+
+IROp_Header *IRLoader::AllocateOp(uint32_t ID, IROps Op) {
+  size_t Size = FEXCore::IR::GetSize(Op);
+  LoadedOp Loaded{ID, OpData.size()};
+  OpData.resize(OpData.size() + Size);
+
+  if (Op == OP_IRHEADER) {
+    Header.emplace_back(Loaded);
+  }
+  else if (Op == OP_CODEBLOCK) {
+    Blocks.emplace_back(LoadedBlock{Loaded, {}});
+  }
+  else if (Blocks.empty()) {
+    // Still hand out the op so the caller can finish reading it
+    LogMan::Msg::E("%s op %%ssa%d isn't inside of a CodeBlock", std::string(GetName(Op)).c_str(), ID);
+    HadError = true;
+  }
+  else {
+    Blocks.back().Ops.emplace_back(Loaded);
+  }
+
+  auto IROp = GetOp(Loaded);
+  IROp->Op = Op;
+  return IROp;
+}
+
+bool IRLoader::Load(OpDispatchBuilder *Disp) {
+  if (HadError) {
+    return false;
+  }
+
+  if (Header.size() != 1) {
+    LogMan::Msg::E("IR needs exactly one IRHeader, found %ld", Header.size());
+    return false;
+  }
+
+  if (Blocks.empty()) {
+    LogMan::Msg::E("IR doesn't have any CodeBlocks");
+    return false;
+  }
+
+  Disp->ResetWorkingList();
+  auto CurrentIR = Disp->ViewIR();
+  uintptr_t ListBegin = CurrentIR.GetListData();
+  uintptr_t DataBegin = CurrentIR.GetData();
+
+  bool Result = true;
+
+  // Input ID -> Node in the new list
+  std::unordered_map<uint32_t, OrderedNode*> Nodes;
+  Nodes[0] = Disp->Invalid();
+
+  auto CopyOp = [&](LoadedOp const &Op) {
+    auto IROp = GetOp(Op);
+    size_t Size = FEXCore::IR::GetSize(IROp->Op);
+    auto NewOp = Disp->AllocateRawOp(Size);
+    memcpy(NewOp.first, IROp, Size);
+
+    if (Op.ID != 0 && !Nodes.try_emplace(Op.ID, NewOp.Node).second) {
+      LogMan::Msg::E("%%ssa%d is defined more than once", Op.ID);
+      Result = false;
+    }
+    return NewOp.Node;
+  };
+
+  auto Resolve = [&](OrderedNodeWrapper Arg) {
+    auto it = Nodes.find(Arg.ID());
+    if (it == Nodes.end()) {
+      LogMan::Msg::E("%%ssa%d is used but never defined", Arg.ID());
+      Result = false;
+      return Disp->Invalid();
+    }
+    return it->second;
+  };
+
+  // Same layout that IRCompaction generates
+  // The header, all of the code blocks and then the ops of every block
+  OrderedNode *HeaderNode = CopyOp(Header.front());
+
+  std::vector<OrderedNode*> BlockNodes;
+  for (auto &Block : Blocks) {
+    BlockNodes.emplace_back(CopyOp(Block.Block));
+  }
+
+  std::vector<std::vector<OrderedNode*>> OpNodes(Blocks.size());
+  for (size_t i = 0; i < Blocks.size(); ++i) {
+    if (Blocks[i].Ops.empty()) {
+      LogMan::Msg::E("CodeBlock %%ssa%d doesn't have any ops", Blocks[i].Block.ID);
+      return false;
+    }
+
+    for (auto &Op : Blocks[i].Ops) {
+      OpNodes[i].emplace_back(CopyOp(Op));
+    }
+  }
+
+  auto HeaderOp = HeaderNode->Op(DataBegin)->CW<IROp_IRHeader>();
+  HeaderOp->Header.NumArgs = 1;
+  HeaderOp->Blocks = BlockNodes.front()->Wrapped(ListBegin);
+
+  for (size_t i = 0; i < Blocks.size(); ++i) {
+    auto BlockOp = BlockNodes[i]->Op(DataBegin)->CW<IROp_CodeBlock>();
+    OrderedNode *NextBlock = i + 1 < BlockNodes.size() ? BlockNodes[i + 1] : Disp->Invalid();
+    BlockOp->Header.NumArgs = 3;
+    BlockOp->Begin = OpNodes[i].front()->Wrapped(ListBegin);
+    BlockOp->Last = OpNodes[i].back()->Wrapped(ListBegin);
+    BlockOp->Next = NextBlock->Wrapped(ListBegin);
+
+    IROp_Phi *CurrentPhi {};
+    for (auto Node : OpNodes[i]) {
+      auto IROp = Node->Op(DataBegin);
+
+      switch (IROp->Op) {
+        case OP_PHI: {
+          CurrentPhi = IROp->CW<IROp_Phi>();
+          CurrentPhi->Header.NumArgs = 2;
+          CurrentPhi->PhiBegin = CurrentPhi->PhiEnd = Disp->Invalid()->Wrapped(ListBegin);
+          break;
+        }
+        case OP_PHIVALUE: {
+          if (!CurrentPhi) {
+            LogMan::Msg::E("PhiValue that doesn't follow a Phi");
+            return false;
+          }
+
+          auto Op = IROp->CW<IROp_PhiValue>();
+          OrderedNode *Value = Resolve(Op->Value);
+          OrderedNode *Block = Resolve(Op->Block);
+          Op->Header.NumArgs = 3;
+          Op->Header.Size = Value->Op(DataBegin)->Size;
+          Op->Value = Value->Wrapped(ListBegin);
+          Op->Block = Block->Wrapped(ListBegin);
+          Op->Next = Disp->Invalid()->Wrapped(ListBegin);
+          Value->AddUse();
+          Block->AddUse();
+          Disp->AddPhiValue(CurrentPhi, Node);
+          break;
+        }
+        default: {
+          CurrentPhi = nullptr;
+          for (uint8_t Arg = 0; Arg < IROp->NumArgs; ++Arg) {
+            OrderedNode *ArgNode = Resolve(IROp->Args[Arg]);
+            IROp->Args[Arg] = ArgNode->Wrapped(ListBegin);
+            ArgNode->AddUse();
+          }
+          break;
+        }
+      }
+    }
+  }
+
+  return Result;
+}
+
+IRListView<true> *IRLoader::CreateIR() {
+  OpDispatchBuilder Disp {nullptr};
+  if (!Load(&Disp)) {
+    return nullptr;
+  }
+
+  return Disp.CreateIRCopy();
+}
+
+}
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <FEXCore/IR/IR.h>
+#include <FEXCore/IR/IntrusiveIRList.h>
+
+#include <vector>
+
+namespace FEXCore::IR {
+class OpDispatchBuilder;
+
+/**
+ * @brief Rebuilds IR in an OpDispatchBuilder from ops that were read back in from text or the serialized form
+ *
+ * Ops are handed over in the order Dump writes them out: The IRHeader, then every CodeBlock followed by its ops.
+ * SSA arguments are stored with the ID the op had in the input. They get resolved once everything is loaded,
+ * so arguments are free to refer to ops that come later (Branches to later blocks, Phi values coming from a back edge).
+ *
+ * The CodeBlock and IRHeader arguments are rebuilt from the order of the ops.
+ * PhiValues that directly follow a Phi are linked to that Phi.
+ */
+class IRLoader final {
+public:
+  /**
+   * @brief Allocates a zeroed backing op
+   *
+   * @param ID The SSA ID that other ops refer to this op with. 0 if nothing can refer to it
+   *
+   * @return The backing op, only valid until the next call to AllocateOp
+   */
+  IROp_Header *AllocateOp(uint32_t ID, IROps Op);
+
+  /**
+   * @brief Stores the ID of an SSA argument until the loaded IR is built
+   */
+  static OrderedNodeWrapper WrapID(uint32_t ID) { return OrderedNodeWrapper::WrapOffset(ID * NODE_ID_STRIDE); }
+
+  /**
+   * @brief Replaces the working list of Disp with the loaded IR
+   *
+   * @return false if the ops don't form valid IR. The working list is left in an undefined state in that case
+   */
+  bool Load(OpDispatchBuilder *Disp);
+
+  /**
+   * @brief Builds the loaded IR in its own list
+   *
+   * @return The IR, owned by the caller. nullptr if the ops don't form valid IR
+   */
+  IRListView<true> *CreateIR();
+
+private:
+  struct LoadedOp {
+    uint32_t ID;
+    size_t Offset;
+  };
+
+  struct LoadedBlock {
+    LoadedOp Block;
+    std::vector<LoadedOp> Ops;
+  };
+
+  std::vector<uint8_t> OpData;
+  std::vector<LoadedOp> Header;
+  std::vector<LoadedBlock> Blocks;
+  bool HadError {false};
+
+  IROp_Header *GetOp(LoadedOp const &Op) { return reinterpret_cast<IROp_Header*>(&OpData.at(Op.Offset)); }
+};
+}
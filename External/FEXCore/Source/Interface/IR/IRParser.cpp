@@ -0,0 +1,328 @@
+#include "Interface/IR/IRLoader.h"
+
+#include "LogManager.h"
+
+#include <FEXCore/IR/IR.h>
+#include <FEXCore/IR/IntrusiveIRList.h>
+
+#include <array>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace FEXCore::IR {
+namespace {
+  // Lexes a single line of IR text, the first error sticks
+  struct LineLexer {
+    char const *Cur;
+    char const *Error {};
+    char const *ErrorPos {};
+  };
+
+  struct SSAValue {
+    uint32_t ID;
+    bool HasType;
+    uint8_t Size;
+    uint8_t Elements;
+  };
+
+  void SetError(LineLexer *Lexer, char const *Error) {
+    if (!Lexer->Error) {
+      Lexer->Error = Error;
+      Lexer->ErrorPos = Lexer->Cur;
+    }
+  }
+
+  void SkipWhitespace(LineLexer *Lexer) {
+    while (*Lexer->Cur == ' ' || *Lexer->Cur == '\t' || *Lexer->Cur == '\r') {
+      ++Lexer->Cur;
+    }
+  }
+
+  bool Consume(LineLexer *Lexer, char const *Str) {
+    SkipWhitespace(Lexer);
+    size_t Length = strlen(Str);
+    if (strncmp(Lexer->Cur, Str, Length) != 0) {
+      return false;
+    }
+    Lexer->Cur += Length;
+    return true;
+  }
+
+  void Expect(LineLexer *Lexer, char const *Str, char const *Error) {
+    if (!Consume(Lexer, Str)) {
+      SetError(Lexer, Error);
+    }
+  }
+
+  std::string_view ParseIdentifier(LineLexer *Lexer) {
+    SkipWhitespace(Lexer);
+    char const *Begin = Lexer->Cur;
+    while (isalnum(static_cast<unsigned char>(*Lexer->Cur)) || *Lexer->Cur == '_') {
+      ++Lexer->Cur;
+    }
+
+    if (Begin == Lexer->Cur) {
+      SetError(Lexer, "Expected a name");
+    }
+    return std::string_view(Begin, Lexer->Cur - Begin);
+  }
+
+  uint64_t ParseNumber(LineLexer *Lexer, uint64_t Max) {
+    SkipWhitespace(Lexer);
+    if (!isdigit(*Lexer->Cur)) {
+      SetError(Lexer, "Expected a number");
+      return 0;
+    }
+
+    char *End;
+    uint64_t Value = strtoull(Lexer->Cur, &End, 0);
+    if (Value > Max) {
+      SetError(Lexer, "Number is out of range");
+    }
+    Lexer->Cur = End;
+    return Value;
+  }
+
+  // Dump writes SSA values both as %ssa and %%ssa
+  // Arguments are followed by their size, which is optional when parsing
+  SSAValue ParseSSA(LineLexer *Lexer) {
+    SSAValue Value{};
+    SkipWhitespace(Lexer);
+    if (*Lexer->Cur != '%') {
+      SetError(Lexer, "Expected an SSA value");
+      return Value;
+    }
+
+    while (*Lexer->Cur == '%') {
+      ++Lexer->Cur;
+    }
+    Expect(Lexer, "ssa", "Expected an SSA value");
+    if (!isdigit(*Lexer->Cur)) {
+      SetError(Lexer, "Expected an SSA value");
+      return Value;
+    }
+    Value.ID = ParseNumber(Lexer, ~0U);
+
+    SkipWhitespace(Lexer);
+    if (Lexer->Cur[0] == 'i' && isdigit(Lexer->Cur[1])) {
+      ++Lexer->Cur;
+      uint64_t Bits = ParseNumber(Lexer, 255 * 8);
+      if (Bits % 8) {
+        SetError(Lexer, "SSA size isn't a multiple of 8 bits");
+      }
+      Value.HasType = true;
+      Value.Size = Bits / 8;
+      Value.Elements = 1;
+
+      if (Lexer->Cur[0] == 'v' && isdigit(Lexer->Cur[1])) {
+        ++Lexer->Cur;
+        Value.Elements = ParseNumber(Lexer, 127);
+      }
+    }
+
+    return Value;
+  }
+
+  void ParseSeparator(LineLexer *Lexer) {
+    Expect(Lexer, ",", "Expected ','");
+  }
+
+  template<typename Type>
+  Type ParseArg(LineLexer *Lexer);
+
+  template<>
+  uint64_t ParseArg(LineLexer *Lexer) {
+    return ParseNumber(Lexer, ~0ULL);
+  }
+
+  template<>
+  uint32_t ParseArg(LineLexer *Lexer) {
+    return ParseNumber(Lexer, ~0U);
+  }
+
+  template<>
+  uint8_t ParseArg(LineLexer *Lexer) {
+    return ParseNumber(Lexer, 0xFF);
+  }
+
+  template<>
+  CondClassType ParseArg(LineLexer *Lexer) {
+    const std::array<std::pair<std::string_view, uint8_t>, 14> CondNames = {{
+      {"EQ", COND_EQ},
+      {"NEQ", COND_NEQ},
+      {"UGE", COND_UGE},
+      {"ULT", COND_ULT},
+      {"MI", COND_MI},
+      {"PL", COND_PL},
+      {"VS", COND_VS},
+      {"VC", COND_VC},
+      {"UGT", COND_UGT},
+      {"ULE", COND_ULE},
+      {"SGE", COND_SGE},
+      {"SLT", COND_SLT},
+      {"SGT", COND_SGT},
+      {"SLE", COND_SLE},
+    }};
+
+    auto Name = ParseIdentifier(Lexer);
+    for (auto &Cond : CondNames) {
+      if (Cond.first == Name) {
+        return CondClassType{Cond.second};
+      }
+    }
+
+    SetError(Lexer, "Unknown condition");
+    return CondClassType{};
+  }
+
+  template<>
+  RegisterClassType ParseArg(LineLexer *Lexer) {
+    auto Name = ParseIdentifier(Lexer);
+    if (Name == "GPR")
+      return GPRClass;
+    else if (Name == "FPR")
+      return FPRClass;
+    else if (Name == "GPRPair")
+      return GPRPairClass;
+
+    SetError(Lexer, "Unknown register class");
+    return InvalidClass;
+  }
+
+  template<>
+  OrderedNodeWrapper ParseArg(LineLexer *Lexer) {
+    return IRLoader::WrapID(ParseSSA(Lexer).ID);
+  }
+
+  bool FindOp(std::string_view Name, IROps *Op) {
+    static std::unordered_map<std::string_view, IROps> const Ops = [] {
+      std::unordered_map<std::string_view, IROps> Ops;
+      for (uint32_t i = 0; i < OP_LAST; ++i) {
+        Ops[GetName(static_cast<IROps>(i))] = static_cast<IROps>(i);
+      }
+      return Ops;
+    }();
+
+    auto it = Ops.find(Name);
+    if (it == Ops.end()) {
+      return false;
+    }
+    *Op = it->second;
+    return true;
+  }
+
+  void ParseOp(LineLexer *Lexer, IRLoader *Loader) {
+    SSAValue Dest{};
+    bool HasDest = !Consume(Lexer, "(");
+    Dest = ParseSSA(Lexer);
+    if (HasDest) {
+      if (!Dest.HasType) {
+        SetError(Lexer, "Expected the size of the destination");
+      }
+      Expect(Lexer, "=", "Expected '='");
+    }
+    else {
+      Expect(Lexer, ")", "Expected ')'");
+    }
+
+    auto Name = ParseIdentifier(Lexer);
+    if (Lexer->Error) {
+      return;
+    }
+
+    IROps ParsedOp;
+    if (!FindOp(Name, &ParsedOp)) {
+      Lexer->Cur -= Name.size();
+      SetError(Lexer, "Unknown op");
+      return;
+    }
+
+    auto IROp = Loader->AllocateOp(Dest.ID, ParsedOp);
+    if (HasDest) {
+      IROp->HasDest = true;
+      IROp->Size = Dest.Size;
+      IROp->Elements = Dest.Elements;
+    }
+
+    // The header is written out by hand in a different order than the generated printer uses
+    if (ParsedOp == OP_IRHEADER) {
+      auto HeaderOp = IROp->CW<IR::IROp_IRHeader>();
+      HeaderOp->Header.NumArgs = 1;
+      HeaderOp->Entry = ParseArg<uint64_t>(Lexer);
+      ParseSeparator(Lexer);
+      HeaderOp->Blocks = ParseArg<OrderedNodeWrapper>(Lexer);
+      ParseSeparator(Lexer);
+      HeaderOp->BlockCount = ParseArg<uint32_t>(Lexer);
+      return;
+    }
+
+    // BeginBlock prints its own SSA value
+    if (ParsedOp == OP_BEGINBLOCK) {
+      SkipWhitespace(Lexer);
+      if (*Lexer->Cur == '%') {
+        ParseSSA(Lexer);
+      }
+    }
+
+    #define IROP_ARGPARSER_HELPER
+    #include <FEXCore/IR/IRDefines.inc>
+    case IR::OP_PHI: {
+      auto Op = IROp->CW<IR::IROp_Phi>();
+      Op->Header.NumArgs = 2;
+      Op->Class = ParseArg<RegisterClassType>(Lexer).Val;
+
+      // Allocating the values invalidates the Phi op
+      while (Consume(Lexer, ",")) {
+        Expect(Lexer, "[", "Expected '['");
+        auto Value = ParseArg<OrderedNodeWrapper>(Lexer);
+        ParseSeparator(Lexer);
+        auto Block = ParseArg<OrderedNodeWrapper>(Lexer);
+        Expect(Lexer, "]", "Expected ']'");
+
+        auto ValueOp = Loader->AllocateOp(0, OP_PHIVALUE)->CW<IR::IROp_PhiValue>();
+        ValueOp->Value = Value;
+        ValueOp->Block = Block;
+      }
+      break;
+    }
+    default: SetError(Lexer, "Op can't be parsed"); break;
+    }
+  }
+}
+
+IRListView<true> *Parse(std::istream *in) {
+  IRLoader Loader;
+  std::string Line;
+  uint32_t LineNumber{};
+
+  while (std::getline(*in, Line)) {
+    ++LineNumber;
+
+    LineLexer Lexer{Line.c_str()};
+    SkipWhitespace(&Lexer);
+    if (*Lexer.Cur == '\0') {
+      continue;
+    }
+
+    ParseOp(&Lexer, &Loader);
+
+    SkipWhitespace(&Lexer);
+    if (*Lexer.Cur != '\0') {
+      SetError(&Lexer, "Unexpected characters after op");
+    }
+
+    if (Lexer.Error) {
+      LogMan::Msg::E("IR line %d column %ld: %s", LineNumber, Lexer.ErrorPos - Line.c_str() + 1, Lexer.Error);
+      LogMan::Msg::E("  %s", Line.c_str());
+      return nullptr;
+    }
+  }
+
+  return Loader.CreateIR();
+}
+
+}
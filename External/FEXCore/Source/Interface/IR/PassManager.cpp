@@ -1,35 +1,276 @@
 #include "Interface/IR/Passes.h"
 #include "Interface/IR/Passes/RegisterAllocationPass.h"
 #include "Interface/IR/PassManager.h"
+#include "Interface/Core/OpcodeDispatcher.h"
+
+#include "LogManager.h"
+
+#include <chrono>
+#include <sstream>
+#include <unordered_map>
+
+namespace {
+  struct PassDefinition {
+    char const *Name;
+    FEXCore::IR::Pass* (*Create)();
+    bool Cleanup;
+  };
+
+  // Every pass that is allowed in a pipeline
+  // Register allocation isn't in here, the backends insert it themselves
+  // DeadFlagCalculationElimination isn't either, it drops flag stores that later blocks can still read
+  const PassDefinition PassDefinitions[] = {
+    {"ContextLoadStoreElimination", FEXCore::IR::CreateContextLoadStoreElimination, true},
+    {"ConstProp",                   FEXCore::IR::CreateConstProp, true},
+    {"StoreLoadForwarding",         FEXCore::IR::CreateStoreLoadForwarding, false},
+    {"LoopInvariantCodeMotion",     FEXCore::IR::CreateLoopInvariantCodeMotion, false},
+    {"SyscallOptimization",         FEXCore::IR::CreateSyscallOptimization, false},
+    {"DeadCodeElimination",         FEXCore::IR::CreatePassDeadCodeElimination, true},
+    {"IRCompaction",                FEXCore::IR::CreateIRCompaction, false},
+  };
+
+  struct IRSnapshot {
+    int64_t NumNodes;
+    // Block ID -> Hash of the block's ops
+    std::unordered_map<uint32_t, uint64_t> Blocks;
+  };
+
+  void TakeSnapshot(FEXCore::IR::OpDispatchBuilder *Disp, IRSnapshot *Snapshot) {
+    using namespace FEXCore::IR;
+    auto CurrentIR = Disp->ViewIR();
+    uintptr_t ListBegin = CurrentIR.GetListData();
+    uintptr_t DataBegin = CurrentIR.GetData();
+
+    Snapshot->NumNodes = 0;
+    Snapshot->Blocks.clear();
+
+    auto HeaderOp = CurrentIR.begin()()->GetNode(ListBegin)->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
+    OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+
+    while (1) {
+      auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+
+      // We grab these nodes this way so we can iterate easily
+      auto CodeBegin = CurrentIR.at(BlockIROp->Begin);
+      auto CodeLast = CurrentIR.at(BlockIROp->Last);
+
+      // FNV-1a over the backing ops
+      uint64_t Hash = 0xcbf29ce484222325ULL;
+      while (1) {
+        auto CodeOp = CodeBegin();
+        OrderedNode *CodeNode = CodeOp->GetNode(ListBegin);
+        auto IROp = CodeNode->Op(DataBegin);
+
+        auto Bytes = reinterpret_cast<uint8_t const*>(IROp);
+        for (size_t i = 0; i < FEXCore::IR::GetSize(IROp->Op); ++i) {
+          Hash = (Hash ^ Bytes[i]) * 0x100000001b3ULL;
+        }
+        ++Snapshot->NumNodes;
+
+        // CodeLast is inclusive. So we still need to dump the CodeLast op as well
+        if (CodeBegin == CodeLast) {
+          break;
+        }
+        ++CodeBegin;
+      }
+
+      Snapshot->Blocks[BlockNode->Wrapped(ListBegin).ID()] = Hash;
+
+      if (BlockIROp->Next.ID() == 0) {
+        break;
+      } else {
+        BlockNode = BlockIROp->Next.GetNode(ListBegin);
+      }
+    }
+  }
+
+  uint64_t CountChangedBlocks(IRSnapshot const &Before, IRSnapshot const &After) {
+    uint64_t Changed = 0;
+    for (auto &Block : After.Blocks) {
+      auto It = Before.Blocks.find(Block.first);
+      if (It == Before.Blocks.end() || It->second != Block.second) {
+        ++Changed;
+      }
+    }
+
+    // Blocks that were removed entirely
+    for (auto &Block : Before.Blocks) {
+      if (After.Blocks.find(Block.first) == After.Blocks.end()) {
+        ++Changed;
+      }
+    }
+    return Changed;
+  }
+
+  FEXCore::IR::PassStatistics *FindStatistics(std::vector<FEXCore::IR::PassStatistics> *Stats, std::string const &Name) {
+    for (auto &Stat : *Stats) {
+      if (Stat.Name == Name) {
+        return &Stat;
+      }
+    }
+
+    auto &Stat = Stats->emplace_back(FEXCore::IR::PassStatistics{});
+    Stat.Name = Name;
+    return &Stat;
+  }
+}
 
 namespace FEXCore::IR {
 
-void PassManager::AddDefaultPasses() {
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(CreateContextLoadStoreElimination()));
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(CreateConstProp()));
-  ////// Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(CreateDeadFlagCalculationEliminination()));
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(CreateSyscallOptimization()));
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(CreatePassDeadCodeElimination()));
+bool PassManager::AddPass(std::string const &Name) {
+  for (auto &Definition : PassDefinitions) {
+    if (Name == Definition.Name) {
+      Pipeline.emplace_back(PassEntry{Name, std::unique_ptr<FEXCore::IR::Pass>(Definition.Create()), Definition.Cleanup});
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void PassManager::AddDefaultPasses(FEXCore::Config::ConfigOptimizationLevel Level) {
+  Pipeline.clear();
+
+  if (Level >= FEXCore::Config::CONFIG_O1) {
+    AddPass("ContextLoadStoreElimination");
+    AddPass("ConstProp");
+  }
+
+  if (Level >= FEXCore::Config::CONFIG_O2) {
+    AddPass("StoreLoadForwarding");
+    // LoopInvariantCodeMotion isn't in here, the RA spills values that live across blocks so hoisting currently trades ALU ops for fills
+  }
+
+  if (Level >= FEXCore::Config::CONFIG_O1) {
+    AddPass("SyscallOptimization");
+    AddPass("DeadCodeElimination");
+  }
 
   // If the IR is compacted post-RA then the node indexing gets messed up and the backend isn't able to find the register assigned to a node
   // Compact before IR, don't worry about RA generating spills/fills
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(CreateIRCompaction()));
+  AddPass("IRCompaction");
+}
+
+bool PassManager::AddPipeline(std::string const &PipelineString) {
+  Pipeline.clear();
+
+  std::istringstream Input(PipelineString);
+  std::string Name;
+  while (std::getline(Input, Name, ',')) {
+    if (Name.empty()) {
+      continue;
+    }
+
+    if (!AddPass(Name)) {
+      LogMan::Msg::E("Unknown pass '%s' in pass pipeline", Name.c_str());
+      Pipeline.clear();
+      return false;
+    }
+  }
+
+  // The backends expect compacted IR
+  if (Pipeline.empty() || Pipeline.back().Name != "IRCompaction") {
+    AddPass("IRCompaction");
+  }
+
+  return true;
+}
+
+std::vector<std::string> PassManager::GetPassNames() {
+  std::vector<std::string> Names;
+  for (auto &Definition : PassDefinitions) {
+    Names.emplace_back(Definition.Name);
+  }
+  return Names;
 }
 
 void PassManager::AddDefaultValidationPasses() {
 #ifndef NDEBUG
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(Validation::CreatePhiValidation()));
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(Validation::CreateIRValidation()));
-  Passes.emplace_back(std::unique_ptr<FEXCore::IR::Pass>(Validation::CreateValueDominanceValidation()));
+  InsertPass(Validation::CreatePhiValidation(), "PhiValidation");
+  InsertPass(Validation::CreateIRValidation(), "IRValidation");
+  InsertPass(Validation::CreateValueDominanceValidation(), "ValueDominanceValidation");
 #endif
 }
 
+bool PassManager::RunPass(PassEntry const &Entry, OpDispatchBuilder *Disp, std::vector<PassStatistics> *LocalStats) {
+  if (!StatisticsEnabled) {
+    return Entry.Instance->Run(Disp);
+  }
+
+  IRSnapshot Before, After;
+  TakeSnapshot(Disp, &Before);
+
+  auto Start = std::chrono::high_resolution_clock::now();
+  bool Changed = Entry.Instance->Run(Disp);
+  auto End = std::chrono::high_resolution_clock::now();
+
+  TakeSnapshot(Disp, &After);
+
+  auto Stat = FindStatistics(LocalStats, Entry.Name);
+  ++Stat->Runs;
+  Stat->TimesChanged += Changed;
+  Stat->TimeNS += std::chrono::duration_cast<std::chrono::nanoseconds>(End - Start).count();
+  Stat->NodesRemoved += Before.NumNodes - After.NumNodes;
+  Stat->BlocksChanged += CountChangedBlocks(Before, After);
+
+  return Changed;
+}
+
 bool PassManager::Run(OpDispatchBuilder *Disp) {
   bool Changed = false;
-  for (auto const &Pass : Passes) {
-    Changed |= Pass->Run(Disp);
+  std::vector<PassStatistics> LocalStats;
+
+  // Compaction always goes last in the pipeline, cleanup iteration needs to happen in front of it
+  size_t PipelineEnd = Pipeline.size();
+  if (PipelineEnd && Pipeline.back().Name == "IRCompaction") {
+    --PipelineEnd;
   }
+
+  for (size_t i = 0; i < PipelineEnd; ++i) {
+    Changed |= RunPass(Pipeline[i], Disp, &LocalStats);
+  }
+
+  bool CleanupChanged = Changed;
+  for (uint32_t Iteration = 1; Iteration < FixedPointIterations && CleanupChanged; ++Iteration) {
+    CleanupChanged = false;
+    for (size_t i = 0; i < PipelineEnd; ++i) {
+      if (Pipeline[i].Cleanup) {
+        CleanupChanged |= RunPass(Pipeline[i], Disp, &LocalStats);
+      }
+    }
+  }
+
+  for (size_t i = PipelineEnd; i < Pipeline.size(); ++i) {
+    Changed |= RunPass(Pipeline[i], Disp, &LocalStats);
+  }
+
+  for (auto const &Entry : FinalPasses) {
+    Changed |= RunPass(Entry, Disp, &LocalStats);
+  }
+
+  if (StatisticsEnabled) {
+    std::lock_guard<std::mutex> lk(StatisticsMutex);
+    for (auto &Local : LocalStats) {
+      auto Stat = FindStatistics(&Statistics, Local.Name);
+      Stat->Runs += Local.Runs;
+      Stat->TimesChanged += Local.TimesChanged;
+      Stat->TimeNS += Local.TimeNS;
+      Stat->NodesRemoved += Local.NodesRemoved;
+      Stat->BlocksChanged += Local.BlocksChanged;
+    }
+  }
+
   return Changed;
 }
 
+void PassManager::GetStatistics(std::vector<PassStatistics> *Stats) {
+  std::lock_guard<std::mutex> lk(StatisticsMutex);
+  *Stats = Statistics;
+}
+
+void PassManager::ResetStatistics() {
+  std::lock_guard<std::mutex> lk(StatisticsMutex);
+  Statistics.clear();
+}
+
 }
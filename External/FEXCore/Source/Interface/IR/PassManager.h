@@ -1,8 +1,12 @@
 #pragma once
 
+#include <FEXCore/Config/Config.h>
 #include <FEXCore/IR/IntrusiveIRList.h>
+#include <FEXCore/IR/PassStatistics.h>
 
 #include <memory>
+#include <mutex>
+#include <string>
 #include <vector>
 
 namespace FEXCore::IR {
@@ -16,15 +20,71 @@ public:
 
 class PassManager final {
 public:
-  void AddDefaultPasses();
+  /**
+   * @brief Sets up the optimization pipeline for an optimization level
+   *
+   * Replaces any previously configured pipeline
+   */
+  void AddDefaultPasses(FEXCore::Config::ConfigOptimizationLevel Level = FEXCore::Config::CONFIG_O2);
+
+  /**
+   * @brief Sets up the optimization pipeline from a comma separated list of pass names
+   *
+   * Replaces any previously configured pipeline. IRCompaction is appended if the pipeline doesn't end with it
+   *
+   * @return false if any of the pass names wasn't known. The pipeline is left empty in that case
+   */
+  bool AddPipeline(std::string const &Pipeline);
+
   void AddDefaultValidationPasses();
-  void InsertPass(Pass *Pass) {
-    Passes.emplace_back(Pass);
+
+  /**
+   * @brief Inserts a pass that runs after the optimization pipeline
+   *
+   * Validation and register allocation live here so they survive the pipeline being reconfigured
+   */
+  void InsertPass(Pass *Pass, std::string const &Name) {
+    FinalPasses.emplace_back(PassEntry{Name, std::unique_ptr<FEXCore::IR::Pass>(Pass), false});
   }
+
+  /**
+   * @brief Reruns the cleanup passes of the pipeline until they stop changing the IR
+   *
+   * @param MaxIterations Upper bound on how many times the cleanup passes run. 1 disables the iteration
+   */
+  void SetFixedPointIterations(uint32_t MaxIterations) { FixedPointIterations = MaxIterations; }
+  void EnableStatistics(bool Enable) { StatisticsEnabled = Enable; }
+  bool GetStatisticsEnabled() const { return StatisticsEnabled; }
+
   bool Run(OpDispatchBuilder *Disp);
 
+  void GetStatistics(std::vector<PassStatistics> *Stats);
+  void ResetStatistics();
+
+  /**
+   * @brief Names of every pass that can be used in a pipeline
+   */
+  static std::vector<std::string> GetPassNames();
+
 private:
-  std::vector<std::unique_ptr<Pass>> Passes;
+  struct PassEntry {
+    std::string Name;
+    std::unique_ptr<FEXCore::IR::Pass> Instance;
+    // Cheap passes that can be rerun to clean up after each other
+    bool Cleanup;
+  };
+
+  std::vector<PassEntry> Pipeline;
+  std::vector<PassEntry> FinalPasses;
+
+  uint32_t FixedPointIterations {1};
+  bool StatisticsEnabled {false};
+
+  std::mutex StatisticsMutex;
+  std::vector<PassStatistics> Statistics;
+
+  bool AddPass(std::string const &Name);
+  bool RunPass(PassEntry const &Entry, OpDispatchBuilder *Disp, std::vector<PassStatistics> *LocalStats);
 };
 }
 
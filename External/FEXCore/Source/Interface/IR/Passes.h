@@ -7,10 +7,13 @@ class RegisterAllocationPass;
 FEXCore::IR::Pass* CreateConstProp();
 FEXCore::IR::Pass* CreateContextLoadStoreElimination();
 FEXCore::IR::Pass* CreateSyscallOptimization();
+FEXCore::IR::Pass* CreateStoreLoadForwarding();
+FEXCore::IR::Pass* CreateLoopInvariantCodeMotion();
 FEXCore::IR::Pass* CreateDeadFlagCalculationEliminination();
 FEXCore::IR::Pass* CreatePassDeadCodeElimination();
 FEXCore::IR::Pass* CreateIRCompaction();
 FEXCore::IR::RegisterAllocationPass* CreateRegisterAllocationPass();
+FEXCore::IR::RegisterAllocationPass* CreateLinearScanRegisterAllocationPass();
 
 namespace Validation {
 FEXCore::IR::Pass* CreateIRValidation();
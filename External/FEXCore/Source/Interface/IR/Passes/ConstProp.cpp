@@ -1,3 +1,4 @@
+#include "Interface/Context/Context.h"
 #include "Interface/IR/PassManager.h"
 #include "Interface/Core/OpcodeDispatcher.h"
 
@@ -173,6 +174,27 @@ bool ConstProp::Run(OpDispatchBuilder *Disp) {
       }
 
 
+      case OP_VEXTRACTTOGPR: {
+        auto Op = IROp->C<IR::IROp_VExtractToGPR>();
+        auto SourceOp = Op->Header.Args[0].GetNode(ListBegin)->Op(DataBegin);
+        uint64_t Function;
+
+        // CPUID results are fixed once the context is initialized
+        // Pull the register out of the results directly, the CPUID op is dead once every register is folded
+        if (SourceOp->Op == OP_CPUID &&
+            Op->ElementSize == 4 &&
+            Disp->IsValueConstant(SourceOp->Args[0], &Function)) {
+          FEXCore::CPUIDEmu::FunctionResults Results;
+          if (Disp->CTX->CPUID.TryRunFunction(Function, &Results)) {
+            Disp->SetWriteCursor(CodeNode);
+            auto ConstantVal = Disp->_Constant(Results.Res[Op->Idx]);
+            Disp->ReplaceAllUsesWithInclusive(CodeNode, ConstantVal, CodeBegin, CodeLast);
+            Changed = true;
+          }
+        }
+        break;
+      }
+
       case OP_BFE: {
         auto Op = IROp->C<IR::IROp_Bfe>();
         uint64_t Constant;
@@ -12,6 +12,17 @@ private:
   void markUsed(OrderedNodeWrapper *CodeOp, IROp_Header *IROp);
 };
 
+static IROps GetNonFetchingAtomic(IROps Op) {
+  switch (Op) {
+  case OP_ATOMICFETCHADD: return OP_ATOMICADD;
+  case OP_ATOMICFETCHSUB: return OP_ATOMICSUB;
+  case OP_ATOMICFETCHAND: return OP_ATOMICAND;
+  case OP_ATOMICFETCHOR:  return OP_ATOMICOR;
+  case OP_ATOMICFETCHXOR: return OP_ATOMICXOR;
+  default: LogMan::Msg::A("Unknown fetching atomic: %d", Op); return Op;
+  }
+}
+
 bool DeadCodeElimination::Run(OpDispatchBuilder *Disp) {
   auto CurrentIR = Disp->ViewIR();
 
@@ -28,6 +39,7 @@ bool DeadCodeElimination::Run(OpDispatchBuilder *Disp) {
   OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
 
   int NumRemoved = 0;
+  int NumDemoted = 0;
 
   while (1) {
     auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
@@ -49,7 +61,15 @@ bool DeadCodeElimination::Run(OpDispatchBuilder *Disp) {
       case OP_STORECONTEXTPAIR:
       case OP_STOREFLAG:
       case OP_STOREMEM:
+      case OP_MEMCPY:
+      case OP_MEMSET:
       case OP_CAS:
+      case OP_ATOMICADD:
+      case OP_ATOMICSUB:
+      case OP_ATOMICAND:
+      case OP_ATOMICOR:
+      case OP_ATOMICXOR:
+      case OP_ATOMICSWAP:
       case OP_PRINT:
         // Keep
         break;
@@ -68,6 +88,23 @@ bool DeadCodeElimination::Run(OpDispatchBuilder *Disp) {
       case OP_ENDBLOCK:
         // Keep, so we don't have to update block first/last
         break;
+      case OP_GUESTOPCODE:
+        // Keep, the JITs build the JIT symbol line tables from these
+        break;
+      // Atomics with a memory side effect
+      case OP_ATOMICFETCHADD:
+      case OP_ATOMICFETCHSUB:
+      case OP_ATOMICFETCHAND:
+      case OP_ATOMICFETCHOR:
+      case OP_ATOMICFETCHXOR:
+        // If nothing reads the previous value then demote to the non-fetching op
+        // Both forms share the same layout so we can just rewrite the header in place
+        if (CodeNode->GetUses() == 0) {
+          IROp->Op = GetNonFetchingAtomic(IROp->Op);
+          IROp->HasDest = false;
+          ++NumDemoted;
+        }
+        break;
       default:
         if (CodeNode->GetUses() == 0) {
           NumRemoved++;
@@ -89,7 +126,7 @@ bool DeadCodeElimination::Run(OpDispatchBuilder *Disp) {
     }
   }
 
-  return NumRemoved != 0;
+  return NumRemoved != 0 || NumDemoted != 0;
 }
 
 void DeadCodeElimination::markUsed(OrderedNodeWrapper *CodeOp, IROp_Header *IROp) {
@@ -345,6 +345,20 @@ void RCLSE::CalculateControlFlowInfo(FEXCore::IR::OpDispatchBuilder *Disp) {
  *   %ssa174 i128 = VBitcast %ssa172 i128
  *   %ssa175 i128 = VAdd %ssa174 i128, %ssa173 i128, 0x10, 0x4
  *   (%%ssa176) StoreContext %ssa175 i128, 0x10, 0xa0
+ *
+ * eg.
+ *   %ssa12 i64 = AtomicFetchAdd %ssa10 i64, %ssa11 i64, 0x4
+ *   %ssa13 i64 = Add %ssa12 i64, %ssa11 i64
+ *   ...
+ *   (%%ssa20) StoreFlag %ssa19 i64, 0x6
+ *   ...
+ *   (%%ssa40) StoreFlag %ssa39 i64, 0x6
+ * Converts to
+ *   %ssa12 i64 = AtomicFetchAdd %ssa10 i64, %ssa11 i64, 0x4
+ *   %ssa13 i64 = Add %ssa12 i64, %ssa11 i64
+ *   ...
+ *   (%%ssa40) StoreFlag %ssa39 i64, 0x6
+ * Once every flag store of the locked op is gone DCE demotes the atomic to its non-fetching form
 
  */
 bool RCLSE::RedundantStoreLoadElimination(FEXCore::IR::OpDispatchBuilder *Disp) {
@@ -449,7 +463,17 @@ bool RCLSE::RedundantStoreLoadElimination(FEXCore::IR::OpDispatchBuilder *Disp)
       }
       else if (IROp->Op == OP_STOREFLAG) {
         auto Op = IROp->CW<IR::IROp_StoreFlag>();
-        RecordAccess(&LocalInfo, FEXCore::IR::GPRClass, offsetof(FEXCore::Core::CPUState, flags[0]) + Op->Flag, 1, ACCESS_WRITE, Op->Header.Args[0].GetNode(ListBegin), CodeNode);
+        auto Info = FindMemberInfo(&LocalInfo, offsetof(FEXCore::Core::CPUState, flags[0]) + Op->Flag, 1);
+        LastAccessType LastAccess = Info->Accessed;
+        OrderedNode *LastNode2 = Info->Node2;
+        RecordAccess(Info, FEXCore::IR::GPRClass, offsetof(FEXCore::Core::CPUState, flags[0]) + Op->Flag, 1, ACCESS_WRITE, Op->Header.Args[0].GetNode(ListBegin), CodeNode);
+
+        if (LastAccess == ACCESS_WRITE) { // 1 byte so always a full write
+          // Nothing read the flag since the last store, so that store is dead
+          // Its flag calculation loses its use here, which lets DCE remove it
+          Disp->Remove(LastNode2);
+          Changed = true;
+        }
       }
       else if (IROp->Op == OP_LOADFLAG) {
         auto Op = IROp->CW<IR::IROp_LoadFlag>();
@@ -478,6 +502,10 @@ bool RCLSE::RedundantStoreLoadElimination(FEXCore::IR::OpDispatchBuilder *Disp)
         // We can't track through these
         ResetClassificationAccesses(&LocalInfo);
       }
+      else if (IROp->Op == OP_SYSCALL) {
+        // Syscalls can read and write the whole context, clone copies it and arch_prctl sets fs/gs
+        ResetClassificationAccesses(&LocalInfo);
+      }
 
       // CodeLast is inclusive. So we still need to dump the CodeLast op as well
       if (CodeBegin == CodeLast) {
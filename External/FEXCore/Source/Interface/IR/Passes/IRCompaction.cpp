@@ -12,6 +12,7 @@ public:
 
 private:
   OpDispatchBuilder LocalBuilder;
+  // Old SSA ID -> Offset of the node in the compacted list
   std::vector<IR::OrderedNodeWrapper::NodeOffsetType> OldToNewRemap;
 };
 
@@ -63,7 +64,7 @@ bool IRCompaction::Run(OpDispatchBuilder *Disp) {
   // Zero is always zero(invalid)
   OldToNewRemap[0] = 0;
   auto LocalHeaderOp = LocalBuilder._IRHeader(OrderedNodeWrapper::WrapOffset(0).GetNode(ListBegin), HeaderOp->Entry, HeaderOp->BlockCount);
-  OldToNewRemap[HeaderNode->Wrapped(ListBegin).ID()] = LocalHeaderOp.Node->Wrapped(LocalListBegin).ID();
+  OldToNewRemap[HeaderNode->Wrapped(ListBegin).ID()] = LocalHeaderOp.Node->Wrapped(LocalListBegin).NodeOffset;
 
   struct CodeBlockData {
     OrderedNode *OldNode;
@@ -80,7 +81,7 @@ bool IRCompaction::Run(OpDispatchBuilder *Disp) {
       LogMan::Throw::A(BlockIROp->Header.Op == OP_CODEBLOCK, "IR type failed to be a code block");
 
       auto LocalBlockIRNode = LocalBuilder.CreateCodeNode();
-      OldToNewRemap[BlockNode->Wrapped(ListBegin).ID()] = LocalBlockIRNode.Node->Wrapped(LocalListBegin).ID();
+      OldToNewRemap[BlockNode->Wrapped(ListBegin).ID()] = LocalBlockIRNode.Node->Wrapped(LocalListBegin).NodeOffset;
       GeneratedCodeBlocks.emplace_back(CodeBlockData{BlockNode, LocalBlockIRNode});
 
       if (PrevCodeBlock) {
@@ -134,7 +135,7 @@ bool IRCompaction::Run(OpDispatchBuilder *Disp) {
         // Set our map remapper to map the new location
         // Even nodes that don't have a destination need to be in this map
         // Need to be able to remap branch targets any other bits
-        OldToNewRemap[CodeOp->ID()] = LocalNodeWrapper.ID();
+        OldToNewRemap[CodeOp->ID()] = LocalNodeWrapper.NodeOffset;
 
         if (i == 0) {
           FirstNode.OldNode = CodeNode;
@@ -172,7 +173,7 @@ bool IRCompaction::Run(OpDispatchBuilder *Disp) {
         OrderedNode *CodeNode = CodeOp->GetNode(ListBegin);
         auto IROp = CodeNode->Op(DataBegin);
 
-        OrderedNodeWrapper LocalNodeWrapper = OrderedNodeWrapper::WrapOffset(OldToNewRemap[CodeOp->ID()] * sizeof(OrderedNode));
+        OrderedNodeWrapper LocalNodeWrapper = OrderedNodeWrapper::WrapOffset(OldToNewRemap[CodeOp->ID()]);
         OrderedNode *LocalNode = LocalNodeWrapper.GetNode(LocalListBegin);
         FEXCore::IR::IROp_Header *LocalIROp = LocalNode->Op(LocalDataBegin);
 
@@ -183,7 +184,7 @@ bool IRCompaction::Run(OpDispatchBuilder *Disp) {
         for (uint8_t i = 0; i < NumArgs; ++i) {
           uint32_t OldArg = IROp->Args[i].ID();
           LogMan::Throw::A(OldToNewRemap[OldArg] != ~0U, "Tried remapping unfound node %%ssa%d", OldArg);
-          LocalIROp->Args[i].NodeOffset = OldToNewRemap[OldArg] * sizeof(OrderedNode);
+          LocalIROp->Args[i].NodeOffset = OldToNewRemap[OldArg];
         }
 
         // CodeLast is inclusive. So we still need to dump the CodeLast op as well
@@ -195,25 +196,15 @@ bool IRCompaction::Run(OpDispatchBuilder *Disp) {
     }
   }
 
-  // uintptr_t OldListSize = CurrentIR.GetListSize();
   // uintptr_t OldDataSize = CurrentIR.GetDataSize();
-
-  // uintptr_t NewListSize = LocalIR.GetListSize();
   // uintptr_t NewDataSize = LocalIR.GetDataSize();
 
-  // if (NewListSize < OldListSize ||
-  //     NewDataSize < OldDataSize) {
-  //   if (NewListSize < OldListSize) {
-  //     LogMan::Msg::D("Shaved %ld bytes off the list size", OldListSize - NewListSize);
-  //   }
-  //   if (NewDataSize < OldDataSize) {
-  //     LogMan::Msg::D("Shaved %ld bytes off the data size", OldDataSize - NewDataSize);
-  //   }
+  // if (NewDataSize < OldDataSize) {
+  //   LogMan::Msg::D("Shaved %ld bytes off the data size", OldDataSize - NewDataSize);
   // }
 
-  // if (NewListSize > OldListSize ||
-  //     NewDataSize > OldDataSize) {
-  //   LogMan::Msg::A("Whoa. Compaction made the IR a different size when it shouldn't have. 0x%lx > 0x%lx or 0x%lx > 0x%lx",NewListSize, OldListSize, NewDataSize, OldDataSize);
+  // if (NewDataSize > OldDataSize) {
+  //   LogMan::Msg::A("Whoa. Compaction made the IR a different size when it shouldn't have. 0x%lx > 0x%lx", NewDataSize, OldDataSize);
   // }
 
   Disp->CopyData(LocalBuilder);
@@ -0,0 +1,484 @@
+#include "Interface/IR/PassManager.h"
+#include "Interface/Core/OpcodeDispatcher.h"
+
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+/**
+ * @brief Finds natural loops in the multiblock CFG and hoists invariant nodes out of them
+ *
+ * A back edge is an edge B -> H where H dominates B.
+ * The natural loop of that edge is H plus every block that can reach B without going through H.
+ * Loops that share a header are merged.
+ *
+ * Pure nodes whose arguments are all defined outside of the loop get moved to a preheader block.
+ * The preheader is created in front of the header and every edge that enters the loop from outside is pointed at it.
+ *
+ * Loops are handled innermost first, so invariants can bubble out through multiple levels of a loop nest.
+ */
+namespace {
+  struct BlockInfo {
+    FEXCore::IR::OrderedNode *BlockNode;
+    FEXCore::IR::OrderedNode *Terminator;
+    bool Reachable;
+    std::vector<uint32_t> Predecessors;
+    std::vector<uint32_t> Successors;
+  };
+
+  struct LoopInfo {
+    uint32_t Header;
+    uint32_t NumBlocks;
+    std::vector<bool> Body;
+  };
+}
+
+namespace FEXCore::IR {
+
+class LoopInvariantCodeMotion final : public FEXCore::IR::Pass {
+public:
+  bool Run(OpDispatchBuilder *Disp) override;
+
+private:
+  OpDispatchBuilder *Disp;
+  uintptr_t ListBegin;
+  uintptr_t DataBegin;
+
+  std::vector<BlockInfo> Blocks;
+  std::vector<std::vector<bool>> Dominators;
+  std::vector<LoopInfo> Loops;
+  std::unordered_map<uint32_t, uint32_t> BlockIDToIndex;
+
+  void GatherBlocks();
+  void CalculateDominators();
+  void FindLoops();
+  bool IsHoistable(IROp_Header const *IROp);
+  bool HoistLoop(LoopInfo const &Loop);
+};
+
+void LoopInvariantCodeMotion::GatherBlocks() {
+  Blocks.clear();
+  BlockIDToIndex.clear();
+
+  auto CurrentIR = Disp->ViewIR();
+  auto HeaderOp = CurrentIR.begin()()->GetNode(ListBegin)->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
+  OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+
+  while (1) {
+    auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+    LogMan::Throw::A(BlockIROp->Header.Op == OP_CODEBLOCK, "IR type failed to be a code block");
+
+    BlockIDToIndex[BlockNode->Wrapped(ListBegin).ID()] = Blocks.size();
+    auto &Block = Blocks.emplace_back(BlockInfo{BlockNode});
+
+    // We grab these nodes this way so we can iterate easily
+    auto CodeBegin = CurrentIR.at(BlockIROp->Begin);
+    auto CodeLast = CurrentIR.at(BlockIROp->Last);
+
+    while (1) {
+      auto CodeOp = CodeBegin();
+      OrderedNode *CodeNode = CodeOp->GetNode(ListBegin);
+      auto IROp = CodeNode->Op(DataBegin);
+
+      if (!Block.Terminator &&
+          (IROp->Op == OP_JUMP ||
+           IROp->Op == OP_CONDJUMP ||
+           IROp->Op == OP_EXITFUNCTION)) {
+        Block.Terminator = CodeNode;
+      }
+
+      // CodeLast is inclusive. So we still need to dump the CodeLast op as well
+      if (CodeBegin == CodeLast) {
+        break;
+      }
+      ++CodeBegin;
+    }
+
+    if (BlockIROp->Next.ID() == 0) {
+      break;
+    } else {
+      BlockNode = BlockIROp->Next.GetNode(ListBegin);
+    }
+  }
+
+  auto AddEdge = [&](uint32_t From, uint32_t To) {
+    Blocks[From].Successors.emplace_back(To);
+    Blocks[To].Predecessors.emplace_back(From);
+  };
+
+  for (uint32_t i = 0; i < Blocks.size(); ++i) {
+    auto &Block = Blocks[i];
+    if (!Block.Terminator) {
+      // Falls through to the next block
+      if (i + 1 < Blocks.size()) {
+        AddEdge(i, i + 1);
+      }
+      continue;
+    }
+
+    auto IROp = Block.Terminator->Op(DataBegin);
+    if (IROp->Op == OP_JUMP) {
+      AddEdge(i, BlockIDToIndex[IROp->Args[0].ID()]);
+    }
+    else if (IROp->Op == OP_CONDJUMP) {
+      AddEdge(i, BlockIDToIndex[IROp->Args[1].ID()]);
+      if (IROp->Args[2].ID() != IROp->Args[1].ID()) {
+        AddEdge(i, BlockIDToIndex[IROp->Args[2].ID()]);
+      }
+    }
+  }
+
+  // Blocks that can't be reached from the entry would break the dominator calculation
+  std::vector<uint32_t> WorkList{0};
+  Blocks[0].Reachable = true;
+  while (!WorkList.empty()) {
+    uint32_t Current = WorkList.back();
+    WorkList.pop_back();
+    for (auto Succ : Blocks[Current].Successors) {
+      if (!Blocks[Succ].Reachable) {
+        Blocks[Succ].Reachable = true;
+        WorkList.emplace_back(Succ);
+      }
+    }
+  }
+}
+
+void LoopInvariantCodeMotion::CalculateDominators() {
+  size_t NumBlocks = Blocks.size();
+  Dominators.assign(NumBlocks, std::vector<bool>(NumBlocks, true));
+  Dominators[0].assign(NumBlocks, false);
+  Dominators[0][0] = true;
+
+  bool Changed = true;
+  while (Changed) {
+    Changed = false;
+    for (uint32_t i = 1; i < NumBlocks; ++i) {
+      if (!Blocks[i].Reachable) {
+        continue;
+      }
+
+      std::vector<bool> NewDom(NumBlocks, true);
+      for (auto Pred : Blocks[i].Predecessors) {
+        if (!Blocks[Pred].Reachable) {
+          continue;
+        }
+
+        for (uint32_t j = 0; j < NumBlocks; ++j) {
+          NewDom[j] = NewDom[j] && Dominators[Pred][j];
+        }
+      }
+      NewDom[i] = true;
+
+      if (NewDom != Dominators[i]) {
+        Dominators[i] = std::move(NewDom);
+        Changed = true;
+      }
+    }
+  }
+}
+
+void LoopInvariantCodeMotion::FindLoops() {
+  Loops.clear();
+
+  for (uint32_t i = 0; i < Blocks.size(); ++i) {
+    if (!Blocks[i].Reachable) {
+      continue;
+    }
+
+    for (auto Header : Blocks[i].Successors) {
+      if (!Dominators[i][Header]) {
+        // Not a back edge
+        continue;
+      }
+
+      LoopInfo *Loop = nullptr;
+      for (auto &It : Loops) {
+        if (It.Header == Header) {
+          Loop = &It;
+          break;
+        }
+      }
+
+      if (!Loop) {
+        Loop = &Loops.emplace_back(LoopInfo{Header, 1, std::vector<bool>(Blocks.size(), false)});
+        Loop->Body[Header] = true;
+      }
+
+      // Walk backwards from the latch until we hit the header
+      std::vector<uint32_t> WorkList{i};
+      while (!WorkList.empty()) {
+        uint32_t Current = WorkList.back();
+        WorkList.pop_back();
+        if (Loop->Body[Current]) {
+          continue;
+        }
+
+        Loop->Body[Current] = true;
+        ++Loop->NumBlocks;
+        for (auto Pred : Blocks[Current].Predecessors) {
+          if (Blocks[Pred].Reachable) {
+            WorkList.emplace_back(Pred);
+          }
+        }
+      }
+    }
+  }
+}
+
+bool LoopInvariantCodeMotion::IsHoistable(IROp_Header const *IROp) {
+  // Only nodes without side effects that can't fault
+  // Div and Rem can trap so they stay where they are
+  // Mov and VBitcast are left alone since they are the copies that the register allocator coalesces Phis through
+  switch (IROp->Op) {
+    case OP_CONSTANT:
+    case OP_ADD:
+    case OP_SUB:
+    case OP_NEG:
+    case OP_MUL:
+    case OP_UMUL:
+    case OP_MULH:
+    case OP_UMULH:
+    case OP_OR:
+    case OP_AND:
+    case OP_XOR:
+    case OP_LSHL:
+    case OP_LSHR:
+    case OP_ASHR:
+    case OP_ROL:
+    case OP_ROR:
+    case OP_ZEXT:
+    case OP_SEXT:
+    case OP_NOT:
+    case OP_POPCOUNT:
+    case OP_FINDLSB:
+    case OP_FINDMSB:
+    case OP_FINDTRAILINGZEROS:
+    case OP_REV:
+    case OP_BFI:
+    case OP_BFE:
+    case OP_SBFE:
+    case OP_SELECT:
+    case OP_CREATEVECTOR2:
+    case OP_CREATEVECTOR3:
+    case OP_CREATEVECTOR4:
+    case OP_SPLATVECTOR2:
+    case OP_SPLATVECTOR3:
+    case OP_SPLATVECTOR4:
+    case OP_VAND:
+    case OP_VOR:
+    case OP_VXOR:
+    case OP_VADD:
+    case OP_VSUB:
+    case OP_VCASTFROMGPR:
+      return true;
+    default:
+      return false;
+  }
+}
+
+bool LoopInvariantCodeMotion::HoistLoop(LoopInfo const &Loop) {
+  auto CurrentIR = Disp->ViewIR();
+  auto &Header = Blocks[Loop.Header];
+
+  // The entry block is entered from outside of the loop as well
+  uint32_t NumOutsideEdges = Loop.Header == 0 ? 1 : 0;
+  std::vector<uint32_t> OutsidePredecessors;
+  for (auto Pred : Header.Predecessors) {
+    if (Loop.Body[Pred]) {
+      if (!Blocks[Pred].Terminator) {
+        // A latch falling through in to the header would fall in to the preheader instead
+        return false;
+      }
+    }
+    else {
+      OutsidePredecessors.emplace_back(Pred);
+      ++NumOutsideEdges;
+    }
+  }
+
+  bool HasPhis = false;
+  std::unordered_set<OrderedNode*> LoopDefs;
+  std::vector<OrderedNode*> Candidates;
+
+  for (uint32_t i = 0; i < Blocks.size(); ++i) {
+    if (!Loop.Body[i]) {
+      continue;
+    }
+
+    auto BlockIROp = Blocks[i].BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+    auto CodeBegin = CurrentIR.at(BlockIROp->Begin);
+    auto CodeLast = CurrentIR.at(BlockIROp->Last);
+
+    while (1) {
+      auto CodeOp = CodeBegin();
+      OrderedNode *CodeNode = CodeOp->GetNode(ListBegin);
+      auto IROp = CodeNode->Op(DataBegin);
+
+      if (IROp->Op == OP_PHI && i == Loop.Header) {
+        HasPhis = true;
+      }
+
+      LoopDefs.insert(CodeNode);
+      if (IsHoistable(IROp) && CodeNode->GetUses() != 0) {
+        Candidates.emplace_back(CodeNode);
+      }
+
+      // CodeLast is inclusive. So we still need to dump the CodeLast op as well
+      if (CodeBegin == CodeLast) {
+        break;
+      }
+      ++CodeBegin;
+    }
+  }
+
+  // Phis can only have their incoming block redirected if there is a single edge to redirect
+  if (HasPhis && (NumOutsideEdges != 1 || OutsidePredecessors.empty())) {
+    return false;
+  }
+
+  // Anything that only depends on values from outside of the loop is invariant
+  // Hoisting one node can make its users invariant, so keep going until nothing changes
+  std::vector<OrderedNode*> Hoisted;
+  bool Progress = true;
+  while (Progress) {
+    Progress = false;
+    for (auto &Node : Candidates) {
+      if (!Node) {
+        continue;
+      }
+
+      auto IROp = Node->Op(DataBegin);
+      uint8_t NumArgs = IR::GetArgs(IROp->Op);
+      bool Invariant = true;
+      for (uint8_t i = 0; i < NumArgs; ++i) {
+        if (LoopDefs.count(IROp->Args[i].GetNode(ListBegin))) {
+          Invariant = false;
+          break;
+        }
+      }
+
+      if (Invariant) {
+        LoopDefs.erase(Node);
+        Hoisted.emplace_back(Node);
+        Node = nullptr;
+        Progress = true;
+      }
+    }
+  }
+
+  if (Hoisted.empty()) {
+    return false;
+  }
+
+  OrderedNode *HeaderNode = Header.BlockNode;
+  auto Preheader = Disp->CreateBlockBefore(HeaderNode);
+
+  // Everything that entered the loop from outside goes through the preheader now
+  // Predecessors that fall through end up in the preheader since it is linked right before the header
+  for (auto Pred : OutsidePredecessors) {
+    auto Terminator = Blocks[Pred].Terminator;
+    if (!Terminator) {
+      continue;
+    }
+
+    auto IROp = Terminator->Op(DataBegin);
+    if (IROp->Op == OP_JUMP) {
+      Disp->SetJumpTarget(IROp->CW<IR::IROp_Jump>(), Preheader);
+    }
+    else if (IROp->Op == OP_CONDJUMP) {
+      auto Op = IROp->CW<IR::IROp_CondJump>();
+      if (Op->Header.Args[1].GetNode(ListBegin) == HeaderNode) {
+        Disp->SetTrueJumpTarget(Op, Preheader);
+      }
+      if (Op->Header.Args[2].GetNode(ListBegin) == HeaderNode) {
+        Disp->SetFalseJumpTarget(Op, Preheader);
+      }
+    }
+  }
+
+  if (HasPhis) {
+    auto BlockIROp = HeaderNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+    auto CodeBegin = CurrentIR.at(BlockIROp->Begin);
+    auto CodeLast = CurrentIR.at(BlockIROp->Last);
+    OrderedNode *OutsideBlock = Blocks[OutsidePredecessors[0]].BlockNode;
+
+    while (1) {
+      auto CodeOp = CodeBegin();
+      OrderedNode *CodeNode = CodeOp->GetNode(ListBegin);
+      auto IROp = CodeNode->Op(DataBegin);
+
+      if (IROp->Op == OP_PHI) {
+        auto Op = IROp->C<IR::IROp_Phi>();
+        auto PhiValueWrapper = Op->PhiBegin;
+        while (PhiValueWrapper.ID() != 0) {
+          auto PhiValueOp = PhiValueWrapper.GetNode(ListBegin)->Op(DataBegin)->CW<IR::IROp_PhiValue>();
+          if (PhiValueOp->Block.GetNode(ListBegin) == OutsideBlock) {
+            PhiValueOp->Block = Preheader.Node->Wrapped(ListBegin);
+          }
+          PhiValueWrapper = PhiValueOp->Next;
+        }
+      }
+
+      // CodeLast is inclusive. So we still need to dump the CodeLast op as well
+      if (CodeBegin == CodeLast) {
+        break;
+      }
+      ++CodeBegin;
+    }
+  }
+
+  // Move the invariant nodes in front of the preheader's jump
+  // Hoisted is in dependency order, so arguments are always moved before their users
+  auto PreheaderLast = Preheader.first->Last.GetNode(ListBegin);
+  OrderedNode *Jump = PreheaderLast->Header.Previous.GetNode(ListBegin);
+  for (auto Node : Hoisted) {
+    Node->Unlink(ListBegin);
+    Jump->prepend(ListBegin, Node);
+  }
+
+  return true;
+}
+
+bool LoopInvariantCodeMotion::Run(OpDispatchBuilder *_Disp) {
+  Disp = _Disp;
+  bool Changed = false;
+  auto CurrentIR = Disp->ViewIR();
+  ListBegin = CurrentIR.GetListData();
+  DataBegin = CurrentIR.GetData();
+
+  // Node pointers survive new blocks being created, block indices don't
+  std::unordered_set<OrderedNode*> VisitedHeaders;
+
+  while (1) {
+    GatherBlocks();
+    CalculateDominators();
+    FindLoops();
+
+    // Innermost first
+    LoopInfo const *Loop = nullptr;
+    for (auto &It : Loops) {
+      if (VisitedHeaders.count(Blocks[It.Header].BlockNode)) {
+        continue;
+      }
+
+      if (!Loop || It.NumBlocks < Loop->NumBlocks) {
+        Loop = &It;
+      }
+    }
+
+    if (!Loop) {
+      break;
+    }
+
+    VisitedHeaders.insert(Blocks[Loop->Header].BlockNode);
+    Changed |= HoistLoop(*Loop);
+  }
+
+  return Changed;
+}
+
+FEXCore::IR::Pass* CreateLoopInvariantCodeMotion() {
+  return new LoopInvariantCodeMotion{};
+}
+
+}
@@ -43,8 +43,9 @@ bool PhiValidation::Run(OpDispatchBuilder *Disp) {
       auto IROp = CodeNode->Op(DataBegin);
 
       switch (IROp->Op) {
-        // DUMMY doesn't matter for us
-        case IR::OP_DUMMY: break;
+        // DUMMY and GUESTOPCODE don't matter for us
+        case IR::OP_DUMMY:
+        case IR::OP_GUESTOPCODE: break;
         case IR::OP_PHIVALUE:
         case IR::OP_PHI: {
           if (FoundNonPhi) {
@@ -3,7 +3,11 @@
 #include "Interface/IR/Passes.h"
 #include "Interface/Core/OpcodeDispatcher.h"
 
+#include <FEXCore/Core/CoreState.h>
+
+#include <functional>
 #include <iterator>
+#include <unordered_map>
 
 namespace {
   constexpr uint32_t INVALID_REG = ~0U;
@@ -30,6 +34,7 @@ namespace {
       uint32_t BlockID;
       uint32_t SpillSlot;
       RegisterNode *PhiPartner;
+      bool PhiMember;
     } Head;
 
     uint32_t InterferenceListSize;
@@ -44,6 +49,7 @@ namespace {
     .BlockID = ~0U,
     .SpillSlot = ~0U,
     .PhiPartner = nullptr,
+    .PhiMember = false,
   };
 
   struct RegisterSet {
@@ -57,6 +63,19 @@ namespace {
     uint32_t RematCost;
   };
 
+  struct BlockLiveInfo {
+    uint32_t Begin;
+    uint32_t Last;
+    uint32_t Visited;
+    std::vector<uint32_t> Predecessors;
+  };
+
+  struct CrossBlockUse {
+    uint32_t Node;
+    uint32_t Block;
+    uint32_t Use;
+  };
+
   struct SpillStackUnit {
     uint32_t Node;
     FEXCore::IR::RegisterClassType Class;
@@ -280,7 +299,7 @@ namespace {
   };
 
   // Walk the IR and set the node classes
-  void FindNodeClasses(RegisterGraph *Graph, FEXCore::IR::IRListView<false> *IR) {
+  void FindNodeClasses(RegisterGraph *Graph, FEXCore::IR::IRListView<false> *IR, std::vector<uint32_t> const &NodeIndex) {
     uintptr_t ListBegin = IR->GetListData();
     uintptr_t DataBegin = IR->GetData();
 
@@ -304,7 +323,7 @@ namespace {
         FEXCore::IR::OrderedNodeWrapper *CodeOp = CodeBegin();
         FEXCore::IR::OrderedNode *CodeNode = CodeOp->GetNode(ListBegin);
         auto IROp = CodeNode->Op(DataBegin);
-        uint32_t Node = CodeOp->ID();
+        uint32_t Node = NodeIndex[CodeOp->ID()];
 
         // If the destination hasn't yet been set then set it now
         if (IROp->HasDest) {
@@ -328,7 +347,85 @@ namespace {
 }
 
 namespace FEXCore::IR {
-  class ConstrainedRAPass final : public RegisterAllocationPass {
+  /**
+   * @brief Live range calculation that is shared between the register allocators
+   *
+   * Nodes are numbered densely in IR order and live ranges are a single span over those numbers, so the IR needs to be compacted first.
+   * SSA IDs come from node offsets and leave gaps for the op data in between, every per node table is indexed by the dense number instead.
+   */
+  class LiveRangeRAPass : public RegisterAllocationPass {
+    public:
+      uint64_t GetNodeRegister(uint32_t Node) override {
+        return GetIndexRegister(IndexOf(Node));
+      }
+
+      bool IsLiveAcross(uint32_t Node, uint32_t Op) const override {
+        // Arguments end at the op and its result begins there, neither needs to survive it
+        LiveRange const &Range = LiveRanges[IndexOf(Node)];
+        uint32_t Position = IndexOf(Op);
+        return Range.Begin < Position && Range.End > Position;
+      }
+
+    protected:
+      std::vector<LiveRange> LiveRanges;
+      std::vector<BlockLiveInfo> BlockLiveness;
+      std::vector<uint32_t> NodeBlocks;
+      std::vector<uint32_t> PhiNodes;
+      // SSA ID -> Dense node index, 0 for anything that isn't a code node
+      std::vector<uint32_t> NodeIndex;
+      // Dense node index -> Offset of its node, indices can't be turned back in to nodes otherwise
+      std::vector<FEXCore::IR::OrderedNodeWrapper::NodeOffsetType> NodeOffsets;
+
+      /**
+       * @brief Returns the register of the node with the dense index Node
+       */
+      virtual uint64_t GetIndexRegister(uint32_t Node) const = 0;
+
+      /**
+       * @brief Returns the dense index of the node with SSA ID Node
+       *
+       * Nodes created after the numbering get index 0, which never has a live range or a register
+       */
+      uint32_t IndexOf(uint32_t Node) const {
+        return Node < NodeIndex.size() ? NodeIndex[Node] : 0;
+      }
+
+      uint32_t IndexOf(FEXCore::IR::OrderedNodeWrapper const &Node) const {
+        return IndexOf(Node.ID());
+      }
+
+      FEXCore::IR::OrderedNodeWrapper WrapNode(uint32_t Node) const {
+        return FEXCore::IR::OrderedNodeWrapper::WrapOffset(NodeOffsets[Node]);
+      }
+
+      /**
+       * @brief Numbers the code nodes densely and sizes the per node tables for them
+       */
+      void NumberNodes(FEXCore::IR::IRListView<false> *IR);
+
+      void CalculateLiveRange(FEXCore::IR::IRListView<false> *IR);
+      void ExtendCrossBlockLiveRanges(std::vector<CrossBlockUse> const &Uses);
+
+      /**
+       * @brief Checks if Node can be recomputed right before Use instead of going through a spill slot
+       *
+       * Constants always can. Context loads can if nothing between Node and Use may have written that part of the context.
+       * A Bfe can if its source is live at Use anyway. Both of those only within a single block.
+       */
+      bool CanRematerialize(FEXCore::IR::IRListView<false> *IR, uint32_t Node, uint32_t Use) const;
+
+      /**
+       * @brief Returns the node's first argument if the node could reuse its register, ~0U otherwise
+       */
+      uint32_t GetTiedSource(FEXCore::IR::IRListView<false> *IR, uint32_t Node) const;
+
+      /**
+       * @brief Recomputes Node at the current write cursor
+       */
+      FEXCore::IR::OrderedNode *Rematerialize(FEXCore::IR::OpDispatchBuilder *Disp, FEXCore::IR::OrderedNode *Node);
+  };
+
+  class ConstrainedRAPass final : public LiveRangeRAPass {
     public:
       ConstrainedRAPass();
       ~ConstrainedRAPass();
@@ -339,29 +436,28 @@ namespace FEXCore::IR {
       void AddRegisterConflict(FEXCore::IR::RegisterClassType ClassConflict, uint32_t RegConflict, FEXCore::IR::RegisterClassType Class, uint32_t Reg) override;
       void AllocateRegisterConflicts(FEXCore::IR::RegisterClassType Class, uint32_t NumConflicts) override;
 
+    private:
       /**
        * @brief Returns the register and class encoded together
        * Top 32bits is the class, lower 32bits is the register
        */
-      uint64_t GetNodeRegister(uint32_t Node) override;
-    private:
+      uint64_t GetIndexRegister(uint32_t Node) const override;
 
       std::vector<uint32_t> PhysicalRegisterCount;
       std::vector<uint32_t> TopRAPressure;
+      std::vector<uint32_t> TiedSources; ///< Node -> Argument to try sharing a register with
 
       RegisterGraph *Graph;
       std::unique_ptr<FEXCore::IR::Pass> LocalCompaction;
 
       void SpillRegisters(FEXCore::IR::OpDispatchBuilder *Disp);
 
-      std::vector<LiveRange> LiveRanges;
-
       using BlockInterferences = std::vector<uint32_t>;
 
       std::unordered_map<uint32_t, BlockInterferences> LocalBlockInterferences;
       BlockInterferences GlobalBlockInterferences;
 
-      void CalculateLiveRange(FEXCore::IR::IRListView<false> *IR);
+      void LinkPhiPartners(FEXCore::IR::IRListView<false> *IR);
       void CalculateBlockInterferences(FEXCore::IR::IRListView<false> *IR);
       void CalculateBlockNodeInterference(FEXCore::IR::IRListView<false> *IR);
       void CalculateNodeInterference(FEXCore::IR::IRListView<false> *IR);
@@ -370,6 +466,7 @@ namespace FEXCore::IR {
       FEXCore::IR::NodeWrapperIterator FindFirstUse(FEXCore::IR::OpDispatchBuilder *Disp, FEXCore::IR::OrderedNode* Node, FEXCore::IR::NodeWrapperIterator Begin, FEXCore::IR::NodeWrapperIterator End);
       uint32_t FindNodeToSpill(RegisterNode *RegisterNode, uint32_t CurrentLocation, LiveRange const *OpLiveRange);
       uint32_t FindSpillSlot(uint32_t Node, FEXCore::IR::RegisterClassType RegisterClass);
+      void ReloadInUseBlocks(FEXCore::IR::OpDispatchBuilder *Disp, FEXCore::IR::OrderedNode *Node, std::function<FEXCore::IR::OrderedNode*()> const &CreateReload);
 
       bool RunAllocateVirtualRegisters(OpDispatchBuilder *Disp);
   };
@@ -404,17 +501,59 @@ namespace FEXCore::IR {
     VirtualAllocateRegisterConflicts(Graph, Class, NumConflicts);
   }
 
-  uint64_t ConstrainedRAPass::GetNodeRegister(uint32_t Node) {
+  uint64_t ConstrainedRAPass::GetIndexRegister(uint32_t Node) const {
     return Graph->Nodes[Node].Head.RegAndClass;
   }
 
-  void ConstrainedRAPass::CalculateLiveRange(FEXCore::IR::IRListView<false> *IR) {
+  void LiveRangeRAPass::NumberNodes(FEXCore::IR::IRListView<false> *IR) {
     using namespace FEXCore;
-    size_t Nodes = IR->GetSSACount();
-    if (Nodes > LiveRanges.size()) {
-      LiveRanges.resize(Nodes);
+    uintptr_t ListBegin = IR->GetListData();
+    uintptr_t DataBegin = IR->GetData();
+
+    NodeIndex.assign(IR->GetSSACount(), 0);
+    // Index 0 stays unused so it can stand in for everything that isn't a code node
+    NodeOffsets.assign(1, 0);
+
+    auto Begin = IR->begin();
+    auto HeaderOp = Begin()->GetNode(ListBegin)->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
+    LogMan::Throw::A(HeaderOp->Header.Op == IR::OP_IRHEADER, "First op wasn't IRHeader");
+
+    IR::OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+
+    while (1) {
+      auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+      LogMan::Throw::A(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
+
+      // We grab these nodes this way so we can iterate easily
+      auto CodeBegin = IR->at(BlockIROp->Begin);
+      auto CodeLast = IR->at(BlockIROp->Last);
+      while (1) {
+        auto CodeOp = CodeBegin();
+        NodeIndex[CodeOp->ID()] = NodeOffsets.size();
+        NodeOffsets.emplace_back(CodeOp->NodeOffset);
+
+        // CodeLast is inclusive. So we still need to dump the CodeLast op as well
+        if (CodeBegin == CodeLast) {
+          break;
+        }
+        ++CodeBegin;
+      }
+
+      if (BlockIROp->Next.ID() == 0) {
+        break;
+      } else {
+        BlockNode = BlockIROp->Next.GetNode(ListBegin);
+      }
     }
-    LiveRanges.assign(Nodes * sizeof(LiveRange), {~0U, ~0U});
+
+    NodeCount = NodeOffsets.size();
+  }
+
+  void LiveRangeRAPass::CalculateLiveRange(FEXCore::IR::IRListView<false> *IR) {
+    using namespace FEXCore;
+    LiveRanges.assign(NodeCount, {~0U, ~0U});
+    PhiNodes.clear();
+    BlockLiveness.clear();
 
     uintptr_t ListBegin = IR->GetListData();
     uintptr_t DataBegin = IR->GetData();
@@ -426,13 +565,44 @@ namespace FEXCore::IR {
     auto HeaderOp = RealNode->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
     LogMan::Throw::A(HeaderOp->Header.Op == IR::OP_IRHEADER, "First op wasn't IRHeader");
 
+    // Give every block an index first so jumps can be resolved while walking
+    std::unordered_map<uint32_t, uint32_t> BlockIDToIndex;
+    {
+      IR::OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+      while (1) {
+        auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+        BlockIDToIndex[BlockNode->Wrapped(ListBegin).ID()] = BlockLiveness.size();
+        BlockLiveness.emplace_back(BlockLiveInfo{IndexOf(BlockIROp->Begin), IndexOf(BlockIROp->Last), 0});
+
+        if (BlockIROp->Next.ID() == 0) {
+          break;
+        } else {
+          BlockNode = BlockIROp->Next.GetNode(ListBegin);
+        }
+      }
+    }
+
+    NodeBlocks.assign(NodeCount, ~0U);
+    // Uses of nodes in a block other than where they are defined
+    std::vector<CrossBlockUse> CrossBlockUses;
+
+    auto AddEdge = [&](uint32_t From, uint32_t To) {
+      auto &Preds = BlockLiveness[To].Predecessors;
+      if (std::find(Preds.begin(), Preds.end(), From) == Preds.end()) {
+        Preds.emplace_back(From);
+      }
+    };
+
     IR::OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
 
     constexpr uint32_t DEFAULT_REMAT_COST = 1000;
+    uint32_t CurrentBlock = 0;
     while (1) {
       auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
       LogMan::Throw::A(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
 
+      bool HasTerminator = false;
+
       // We grab these nodes this way so we can iterate easily
       auto CodeBegin = IR->at(BlockIROp->Begin);
       auto CodeLast = IR->at(BlockIROp->Last);
@@ -440,7 +610,7 @@ namespace FEXCore::IR {
         auto CodeOp = CodeBegin();
         IR::OrderedNode *CodeNode = CodeOp->GetNode(ListBegin);
         auto IROp = CodeNode->Op(DataBegin);
-        uint32_t Node = CodeOp->ID();
+        uint32_t Node = IndexOf(*CodeOp);
 
         // If the destination hasn't yet been set then set it now
         if (IROp->HasDest) {
@@ -453,6 +623,7 @@ namespace FEXCore::IR {
         // Calculate remat cost
         switch (IROp->Op) {
           case IR::OP_CONSTANT: LiveRanges[Node].RematCost = 1; break;
+          case IR::OP_BFE: LiveRanges[Node].RematCost = 5; break;
           case IR::OP_LOADFLAG:
           case IR::OP_LOADCONTEXT: LiveRanges[Node].RematCost = 10; break;
           case IR::OP_LOADMEM: LiveRanges[Node].RematCost = 100; break;
@@ -462,36 +633,52 @@ namespace FEXCore::IR {
           default: LiveRanges[Node].RematCost = DEFAULT_REMAT_COST; break;
         }
 
-        // Set this node's block ID
-        Graph->Nodes[Node].Head.BlockID = BlockNode->Wrapped(ListBegin).ID();
+        NodeBlocks[Node] = CurrentBlock;
 
         uint8_t NumArgs = IR::GetArgs(IROp->Op);
         for (uint8_t i = 0; i < NumArgs; ++i) {
-          if (IROp->Args[i].IsInvalid()) continue;
-          uint32_t ArgNode = IROp->Args[i].ID();
+          uint32_t ArgNode = IndexOf(IROp->Args[i]);
+          // Invalid arguments and jump targets aren't values
+          if (ArgNode == 0) continue;
+          if (NodeBlocks[ArgNode] != CurrentBlock) {
+            // Defined in a different block, needs to stay live through every block in between
+            CrossBlockUses.emplace_back(CrossBlockUse{ArgNode, CurrentBlock, Node});
+            continue;
+          }
           // Set the node end to be at least here
           LiveRanges[ArgNode].End = Node;
-          LogMan::Throw::A(LiveRanges[ArgNode].Begin != ~0U, "%%ssa%d used by %%ssa%d before defined?", ArgNode, Node);
+          LogMan::Throw::A(LiveRanges[ArgNode].Begin != ~0U, "%%ssa%d used by %%ssa%d before defined?", WrapNode(ArgNode).ID(), CodeOp->ID());
         }
 
-        if (IROp->Op == IR::OP_PHI) {
-          // Special case the PHI op, all of the nodes in the argument need to have the same virtual register affinity
-          // Walk through all of them and set affinities for each other
-          auto Op = IROp->C<IR::IROp_Phi>();
-          auto NodeBegin = IR->at(Op->PhiBegin);
-
-          uint32_t CurrentSourcePartner = Node;
-          while (NodeBegin != NodeBegin.Invalid()) {
-            FEXCore::IR::OrderedNodeWrapper *NodeOp = NodeBegin();
-            FEXCore::IR::OrderedNode *NodeNode = NodeOp->GetNode(ListBegin);
-            auto IRNodeOp = NodeNode->Op(DataBegin)->C<IR::IROp_PhiValue>();
-
-            // Set the node partner to the current one
-            // This creates a singly linked list of node partners to follow
-            SetNodePartner(Graph, CurrentSourcePartner, IRNodeOp->Value.ID());
-            CurrentSourcePartner = IRNodeOp->Value.ID();
-            NodeBegin = IR->at(IRNodeOp->Next);
+        switch (IROp->Op) {
+          case IR::OP_PHI:
+            PhiNodes.emplace_back(Node);
+            break;
+          case IR::OP_PHIVALUE: {
+            // The value needs to live until the end of the predecessor block
+            auto Op = IROp->C<IR::IROp_PhiValue>();
+            uint32_t PredBlock = BlockIDToIndex[Op->Block.ID()];
+            CrossBlockUses.emplace_back(CrossBlockUse{IndexOf(Op->Value), PredBlock, BlockLiveness[PredBlock].Last});
+            break;
           }
+          case IR::OP_JUMP:
+            if (!HasTerminator) {
+              AddEdge(CurrentBlock, BlockIDToIndex[IROp->Args[0].ID()]);
+            }
+            HasTerminator = true;
+            break;
+          case IR::OP_CONDJUMP:
+            if (!HasTerminator) {
+              AddEdge(CurrentBlock, BlockIDToIndex[IROp->Args[1].ID()]);
+              AddEdge(CurrentBlock, BlockIDToIndex[IROp->Args[2].ID()]);
+            }
+            HasTerminator = true;
+            break;
+          case IR::OP_EXITFUNCTION:
+          case IR::OP_BREAK:
+            HasTerminator = true;
+            break;
+          default: break;
         }
 
         // CodeLast is inclusive. So we still need to dump the CodeLast op as well
@@ -501,10 +688,204 @@ namespace FEXCore::IR {
         ++CodeBegin;
       }
 
+      // Blocks without a terminator fall through to the next block
+      if (!HasTerminator && CurrentBlock + 1 < BlockLiveness.size()) {
+        AddEdge(CurrentBlock, CurrentBlock + 1);
+      }
+
       if (BlockIROp->Next.ID() == 0) {
         break;
       } else {
         BlockNode = BlockIROp->Next.GetNode(ListBegin);
+        ++CurrentBlock;
+      }
+    }
+
+    ExtendCrossBlockLiveRanges(CrossBlockUses);
+  }
+
+  void LiveRangeRAPass::ExtendCrossBlockLiveRanges(std::vector<CrossBlockUse> const &Uses) {
+    // Live ranges are a single [Begin, End) span over the linear node IDs
+    // A node that is live in to a block is live out of all of its predecessors, up until the defining block
+    // Extend the span to cover every block the node is live through
+    uint32_t VisitStamp = 0;
+    for (auto &Block : BlockLiveness) {
+      Block.Visited = 0;
+    }
+
+    std::vector<uint32_t> Worklist;
+    auto MarkLiveIn = [&](uint32_t Node, uint32_t Block) {
+      LiveRange *Range = &LiveRanges[Node];
+      uint32_t DefBlock = NodeBlocks[Node];
+      ++VisitStamp;
+
+      Worklist.emplace_back(Block);
+      while (!Worklist.empty()) {
+        uint32_t Current = Worklist.back();
+        Worklist.pop_back();
+
+        auto &Info = BlockLiveness[Current];
+        if (Current == DefBlock || Info.Visited == VisitStamp) {
+          continue;
+        }
+        Info.Visited = VisitStamp;
+
+        Range->Begin = std::min(Range->Begin, Info.Begin);
+        for (auto Pred : Info.Predecessors) {
+          Range->End = std::max(Range->End, BlockLiveness[Pred].Last);
+          Worklist.emplace_back(Pred);
+        }
+      }
+    };
+
+    for (auto &Use : Uses) {
+      LogMan::Throw::A(LiveRanges[Use.Node].Begin != ~0U, "%%ssa%d used by %%ssa%d but never defined?", WrapNode(Use.Node).ID(), WrapNode(Use.Use).ID());
+      LiveRanges[Use.Node].End = std::max(LiveRanges[Use.Node].End, Use.Use);
+      if (NodeBlocks[Use.Node] != Use.Block) {
+        MarkLiveIn(Use.Node, Use.Block);
+      }
+    }
+  }
+
+  bool LiveRangeRAPass::CanRematerialize(FEXCore::IR::IRListView<false> *IR, uint32_t Node, uint32_t Use) const {
+    using namespace FEXCore;
+    uintptr_t ListBegin = IR->GetListData();
+    uintptr_t DataBegin = IR->GetData();
+
+    IR::OrderedNodeWrapper NodeWrapper = WrapNode(Node);
+    auto IROp = NodeWrapper.GetNode(ListBegin)->Op(DataBegin);
+
+    if (IROp->Op == IR::OP_CONSTANT) {
+      return true;
+    }
+
+    if (NodeBlocks[Node] != NodeBlocks[Use]) {
+      return false;
+    }
+
+    switch (IROp->Op) {
+      case IR::OP_BFE: {
+        // Recomputing it can't extend the live range of the source
+        uint32_t Source = IndexOf(IROp->Args[0]);
+        return LiveRanges[Source].End >= Use;
+      }
+      case IR::OP_LOADCONTEXT: {
+        auto Op = IROp->C<IR::IROp_LoadContext>();
+        uint32_t Begin = Op->Offset;
+        uint32_t End = Op->Offset + Op->Size;
+        auto Overlaps = [Begin, End](uint32_t Offset, uint32_t Size) {
+          return Offset < End && Begin < Offset + Size;
+        };
+
+        auto CodeBegin = IR->at(NodeWrapper);
+        ++CodeBegin;
+        for (; IndexOf(*CodeBegin()) < Use; ++CodeBegin) {
+          auto CodeIROp = CodeBegin()->GetNode(ListBegin)->Op(DataBegin);
+          switch (CodeIROp->Op) {
+            case IR::OP_STORECONTEXT: {
+              auto StoreOp = CodeIROp->C<IR::IROp_StoreContext>();
+              if (Overlaps(StoreOp->Offset, StoreOp->Size)) {
+                return false;
+              }
+              break;
+            }
+            case IR::OP_STORECONTEXTPAIR: {
+              auto StoreOp = CodeIROp->C<IR::IROp_StoreContextPair>();
+              if (Overlaps(StoreOp->Offset, StoreOp->Size * 2)) {
+                return false;
+              }
+              break;
+            }
+            case IR::OP_STOREFLAG: {
+              auto StoreOp = CodeIROp->C<IR::IROp_StoreFlag>();
+              if (Overlaps(offsetof(FEXCore::Core::CPUState, flags[0]) + StoreOp->Flag, 1)) {
+                return false;
+              }
+              break;
+            }
+            // Anything that can write to the context in ways we don't track
+            case IR::OP_STORECONTEXTINDEXED:
+            case IR::OP_SYSCALL:
+            case IR::OP_BREAK:
+            case IR::OP_GUESTCALLDIRECT:
+            case IR::OP_GUESTCALLINDIRECT:
+            case IR::OP_GUESTRETURN:
+              return false;
+            default: break;
+          }
+        }
+        return true;
+      }
+      default:
+        return false;
+    }
+  }
+
+  uint32_t LiveRangeRAPass::GetTiedSource(FEXCore::IR::IRListView<false> *IR, uint32_t Node) const {
+    using namespace FEXCore;
+    uintptr_t ListBegin = IR->GetListData();
+    uintptr_t DataBegin = IR->GetData();
+
+    IR::OrderedNodeWrapper NodeWrapper = WrapNode(Node);
+    auto IROp = NodeWrapper.GetNode(ListBegin)->Op(DataBegin);
+    if (!IROp->HasDest || IR::GetArgs(IROp->Op) == 0) {
+      return ~0U;
+    }
+
+    // Only free to share if this is the last use of the source
+    uint32_t Source = IndexOf(IROp->Args[0]);
+    if (LiveRanges[Source].End != Node ||
+        GetRegClassFromNode(ListBegin, DataBegin, IROp->Args[0]) != GetRegClassFromNode(ListBegin, DataBegin, NodeWrapper)) {
+      return ~0U;
+    }
+
+    return Source;
+  }
+
+  FEXCore::IR::OrderedNode *LiveRangeRAPass::Rematerialize(FEXCore::IR::OpDispatchBuilder *Disp, FEXCore::IR::OrderedNode *Node) {
+    using namespace FEXCore;
+    uintptr_t DataBegin = Disp->ViewIR().GetData();
+    uintptr_t ListBegin = Disp->ViewIR().GetListData();
+
+    auto IROp = Node->Op(DataBegin);
+    size_t Size = IR::GetSize(IROp->Op);
+    auto NewOp = Disp->AllocateRawOp(Size);
+    memcpy(NewOp.first, IROp, Size);
+
+    uint8_t NumArgs = IR::GetArgs(IROp->Op);
+    for (uint8_t i = 0; i < NumArgs; ++i) {
+      IROp->Args[i].GetNode(ListBegin)->AddUse();
+    }
+
+    return NewOp;
+  }
+
+  void ConstrainedRAPass::LinkPhiPartners(FEXCore::IR::IRListView<false> *IR) {
+    using namespace FEXCore;
+    uintptr_t ListBegin = IR->GetListData();
+    uintptr_t DataBegin = IR->GetData();
+
+    // All of the nodes in a PHI set need to have the same virtual register affinity
+    // Walk through all of them and set affinities for each other
+    for (auto Node : PhiNodes) {
+      IR::OrderedNodeWrapper PhiWrapper = WrapNode(Node);
+      auto Op = PhiWrapper.GetNode(ListBegin)->Op(DataBegin)->C<IR::IROp_Phi>();
+      auto NodeBegin = IR->at(Op->PhiBegin);
+
+      Graph->Nodes[Node].Head.PhiMember = true;
+
+      uint32_t CurrentSourcePartner = Node;
+      while (NodeBegin != NodeBegin.Invalid()) {
+        FEXCore::IR::OrderedNodeWrapper *NodeOp = NodeBegin();
+        FEXCore::IR::OrderedNode *NodeNode = NodeOp->GetNode(ListBegin);
+        auto IRNodeOp = NodeNode->Op(DataBegin)->C<IR::IROp_PhiValue>();
+
+        // Set the node partner to the current one
+        // This creates a singly linked list of node partners to follow
+        SetNodePartner(Graph, CurrentSourcePartner, IndexOf(IRNodeOp->Value));
+        CurrentSourcePartner = IndexOf(IRNodeOp->Value);
+        Graph->Nodes[CurrentSourcePartner].Head.PhiMember = true;
+        NodeBegin = IR->at(IRNodeOp->Next);
       }
     }
   }
@@ -528,18 +909,18 @@ namespace FEXCore::IR {
       LogMan::Throw::A(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
 
       BlockInterferences *BlockInterferenceVector = &LocalBlockInterferences.try_emplace(BlockNode->Wrapped(ListBegin).ID()).first->second;
-      BlockInterferenceVector->reserve(BlockIROp->Last.ID() - BlockIROp->Begin.ID());
+      BlockInterferenceVector->reserve(IndexOf(BlockIROp->Last) - IndexOf(BlockIROp->Begin));
 
       // We grab these nodes this way so we can iterate easily
       auto CodeBegin = IR->at(BlockIROp->Begin);
       auto CodeLast = IR->at(BlockIROp->Last);
       while (1) {
         auto CodeOp = CodeBegin();
-        uint32_t Node = CodeOp->ID();
+        uint32_t Node = IndexOf(*CodeOp);
         LiveRange *NodeLiveRange = &LiveRanges[Node];
 
-        if (NodeLiveRange->Begin >= BlockIROp->Begin.ID() &&
-            NodeLiveRange->End <= BlockIROp->Last.ID()) {
+        if (NodeLiveRange->Begin >= IndexOf(BlockIROp->Begin) &&
+            NodeLiveRange->End <= IndexOf(BlockIROp->Last)) {
           // If the live range of this node is FULLY inside of the block
           // Then add it to the block specific interference list
           BlockInterferenceVector->emplace_back(Node);
@@ -606,7 +987,7 @@ namespace FEXCore::IR {
       auto CodeLast = IR->at(BlockIROp->Last);
       while (1) {
         auto CodeOp = CodeBegin();
-        uint32_t Node = CodeOp->ID();
+        uint32_t Node = IndexOf(*CodeOp);
 
         // Check for every interference with the local block's interference
         for (auto RHSNode : *BlockInterferenceVector) {
@@ -662,8 +1043,6 @@ namespace FEXCore::IR {
       }
     };
 
-    uint32_t NodeCount = IR->GetSSACount();
-
     // Now that we have all the live ranges calculated we need to add them to our interference graph
     for (uint32_t i = 0; i < NodeCount; ++i) {
       for (uint32_t j = i + 1; j < NodeCount; ++j) {
@@ -677,63 +1056,83 @@ namespace FEXCore::IR {
   }
 
   void ConstrainedRAPass::AllocateVirtualRegisters() {
-    for (uint32_t i = 0; i < Graph->NodeCount; ++i) {
-      RegisterNode *CurrentNode = &Graph->Nodes[i];
-      if (CurrentNode->Head.RegAndClass == INVALID_REGCLASS)
-        continue;
+    // Allocate the PHI node sets first
+    // Every node in a set needs the same register, so they need to be allocated together
+    for (auto PhiNode : PhiNodes) {
+      RegisterNode *CurrentNode = &Graph->Nodes[PhiNode];
 
       FEXCore::IR::RegisterClassType RegClass = FEXCore::IR::RegisterClassType{uint32_t(CurrentNode->Head.RegAndClass >> 32)};
       uint64_t RegAndClass = ~0ULL;
       RegisterClass *RAClass = &Graph->Set.Classes[RegClass];
-      if (CurrentNode->Head.PhiPartner) {
-        // In the case that we have a list of nodes that need the same register allocated we need to do something special
-        // We need to gather the data from the forward linked list and make sure they all match the virtual register
-        std::vector<RegisterNode *> Nodes;
-        auto CurrentPartner = CurrentNode;
-        while (CurrentPartner) {
-          Nodes.emplace_back(CurrentPartner);
-          CurrentPartner = CurrentPartner->Head.PhiPartner;
-        }
 
-        for (uint32_t ri = 0; ri < RAClass->Count; ++ri) {
-          uint64_t RegisterToCheck = (static_cast<uint64_t>(RegClass) << 32) + ri;
-          if (!DoesNodeSetInterfereWithRegister(Graph, Nodes, RegisterToCheck)) {
-            RegAndClass = RegisterToCheck;
-            break;
-          }
-        }
+      // We need to gather the data from the forward linked list and make sure they all match the virtual register
+      std::vector<RegisterNode *> Nodes;
+      auto CurrentPartner = CurrentNode;
+      while (CurrentPartner) {
+        Nodes.emplace_back(CurrentPartner);
+        CurrentPartner = CurrentPartner->Head.PhiPartner;
+      }
 
-        // If we failed to find a virtual register then allocate more space for them
-        if (RegAndClass == ~0ULL) {
-          RegAndClass = (static_cast<uint64_t>(RegClass.Val) << 32);
-          RegAndClass |= AllocateMoreRegisters(Graph, RegClass);
+      for (uint32_t ri = 0; ri < RAClass->Count; ++ri) {
+        uint64_t RegisterToCheck = (static_cast<uint64_t>(RegClass) << 32) + ri;
+        if (!DoesNodeSetInterfereWithRegister(Graph, Nodes, RegisterToCheck)) {
+          RegAndClass = RegisterToCheck;
+          break;
         }
+      }
+
+      // If we failed to find a virtual register then allocate more space for them
+      if (RegAndClass == ~0ULL) {
+        RegAndClass = (static_cast<uint64_t>(RegClass.Val) << 32);
+        RegAndClass |= AllocateMoreRegisters(Graph, RegClass);
+      }
 
-        TopRAPressure[RegClass] = std::max((uint32_t)RegAndClass, TopRAPressure[RegClass]);
+      TopRAPressure[RegClass] = std::max((uint32_t)RegAndClass, TopRAPressure[RegClass]);
 
-        // Walk the partners and ensure they are all set to the same register now
-        for (auto Partner : Nodes) {
-          Partner->Head.RegAndClass = RegAndClass;
-        }
+      // Walk the partners and ensure they are all set to the same register now
+      for (auto Partner : Nodes) {
+        Partner->Head.RegAndClass = RegAndClass;
       }
-      else {
-        for (uint32_t ri = 0; ri < RAClass->Count; ++ri) {
-          uint64_t RegisterToCheck = (static_cast<uint64_t>(RegClass) << 32) + ri;
-          if (!DoesNodeInterfereWithRegister(Graph, CurrentNode, RegisterToCheck)) {
-            RegAndClass = RegisterToCheck;
-            break;
-          }
+    }
+
+    for (uint32_t i = 0; i < Graph->NodeCount; ++i) {
+      RegisterNode *CurrentNode = &Graph->Nodes[i];
+      if (CurrentNode->Head.RegAndClass == INVALID_REGCLASS)
+        continue;
+
+      // Already allocated as part of a PHI set
+      if (CurrentNode->Head.PhiMember)
+        continue;
+
+      FEXCore::IR::RegisterClassType RegClass = FEXCore::IR::RegisterClassType{uint32_t(CurrentNode->Head.RegAndClass >> 32)};
+      uint64_t RegAndClass = ~0ULL;
+      RegisterClass *RAClass = &Graph->Set.Classes[RegClass];
+
+      // Sources outside of PHI sets are allocated before their users
+      if (TiedSources[i] != ~0U) {
+        uint64_t RegisterToCheck = Graph->Nodes[TiedSources[i]].Head.RegAndClass;
+        if ((uint32_t)RegisterToCheck != INVALID_REG &&
+            !DoesNodeInterfereWithRegister(Graph, CurrentNode, RegisterToCheck)) {
+          RegAndClass = RegisterToCheck;
         }
+      }
 
-        // If we failed to find a virtual register then allocate more space for them
-        if (RegAndClass == ~0ULL) {
-          RegAndClass = (static_cast<uint64_t>(RegClass.Val) << 32);
-          RegAndClass |= AllocateMoreRegisters(Graph, RegClass);
+      for (uint32_t ri = 0; ri < RAClass->Count && RegAndClass == ~0ULL; ++ri) {
+        uint64_t RegisterToCheck = (static_cast<uint64_t>(RegClass) << 32) + ri;
+        if (!DoesNodeInterfereWithRegister(Graph, CurrentNode, RegisterToCheck)) {
+          RegAndClass = RegisterToCheck;
+          break;
         }
+      }
 
-        TopRAPressure[RegClass] = std::max((uint32_t)RegAndClass, TopRAPressure[RegClass]);
-        CurrentNode->Head.RegAndClass = RegAndClass;
+      // If we failed to find a virtual register then allocate more space for them
+      if (RegAndClass == ~0ULL) {
+        RegAndClass = (static_cast<uint64_t>(RegClass.Val) << 32);
+        RegAndClass |= AllocateMoreRegisters(Graph, RegClass);
       }
+
+      TopRAPressure[RegClass] = std::max((uint32_t)RegAndClass, TopRAPressure[RegClass]);
+      CurrentNode->Head.RegAndClass = RegAndClass;
     }
   }
 
@@ -781,6 +1180,11 @@ namespace FEXCore::IR {
         continue;
       }
 
+      // PHI sets share a single register, we can't spill a single node out of it
+      if (Graph->Nodes[InterferenceNode].Head.PhiMember) {
+        continue;
+      }
+
       // If the interference's live range is past this op's live range then we can dump it
       if (InterferenceLiveRange->End > OpLiveRange->End &&
           InterferenceLiveRange->RematCost != 1) {
@@ -812,6 +1216,10 @@ namespace FEXCore::IR {
           continue;
         }
 
+        if (Graph->Nodes[InterferenceNode].Head.PhiMember) {
+          continue;
+        }
+
         if (InterferenceLiveRange->RematCost != 1) {
           bool Found = false;
           if (OpLiveRange->End != InterferenceLiveRange->End &&
@@ -833,7 +1241,7 @@ namespace FEXCore::IR {
     }
 
     if (InterferenceToSpill == ~0U) {
-      LogMan::Msg::D("node %%ssa%d has %ld interferences, was dumped in to virtual reg %d", CurrentLocation, RegisterNode->Head.InterferenceCount, RegisterNode->Head.RegAndClass);
+      LogMan::Msg::D("node %%ssa%d has %ld interferences, was dumped in to virtual reg %d", WrapNode(CurrentLocation).ID(), RegisterNode->Head.InterferenceCount, RegisterNode->Head.RegAndClass);
       for (uint32_t j = 0; j < RegisterNode->Head.InterferenceCount; ++j) {
         uint32_t InterferenceNode = RegisterNode->InterferenceList[j];
         auto *InterferenceLiveRange = &LiveRanges[InterferenceNode];
@@ -868,6 +1276,49 @@ namespace FEXCore::IR {
     return CurrentNode->Head.SpillSlot;
   }
 
+  void ConstrainedRAPass::ReloadInUseBlocks(FEXCore::IR::OpDispatchBuilder *Disp, FEXCore::IR::OrderedNode *Node, std::function<FEXCore::IR::OrderedNode*()> const &CreateReload) {
+    using namespace FEXCore;
+
+    auto IR = Disp->ViewIR();
+    uintptr_t ListBegin = IR.GetListData();
+    uintptr_t DataBegin = IR.GetData();
+
+    auto Begin = IR.begin();
+    auto Op = Begin();
+
+    IR::OrderedNode *RealNode = Op->GetNode(ListBegin);
+    auto HeaderOp = RealNode->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
+    LogMan::Throw::A(HeaderOp->Header.Op == IR::OP_IRHEADER, "First op wasn't IRHeader");
+
+    IR::OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+
+    while (1) {
+      auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+      LogMan::Throw::A(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
+
+      auto CodeBegin = IR.at(BlockIROp->Begin);
+      auto CodeLast = IR.at(BlockIROp->Last);
+
+      // Reload right before the first use in this block and have the rest of the block use the reloaded value
+      auto FirstUseLocation = FindFirstUse(Disp, Node, CodeBegin, CodeLast);
+      if (FirstUseLocation != IR::NodeWrapperIterator::Invalid()) {
+        --FirstUseLocation;
+        IR::OrderedNodeWrapper *FirstUseOp = FirstUseLocation();
+        IR::OrderedNode *FirstUseOrderedNode = FirstUseOp->GetNode(ListBegin);
+
+        Disp->SetWriteCursor(FirstUseOrderedNode);
+        auto Reload = CreateReload();
+        Disp->ReplaceAllUsesWithInclusive(Node, Reload, FirstUseLocation, CodeLast);
+      }
+
+      if (BlockIROp->Next.ID() == 0) {
+        break;
+      } else {
+        BlockNode = BlockIROp->Next.GetNode(ListBegin);
+      }
+    }
+  }
+
   void ConstrainedRAPass::SpillRegisters(FEXCore::IR::OpDispatchBuilder *Disp) {
     using namespace FEXCore;
 
@@ -899,7 +1350,7 @@ namespace FEXCore::IR {
         auto IROp = CodeNode->Op(DataBegin);
 
         if (IROp->HasDest) {
-          uint32_t Node = CodeOp->ID();
+          uint32_t Node = IndexOf(*CodeOp);
           RegisterNode *CurrentNode = &Graph->Nodes[Node];
           LiveRange *OpLiveRange = &LiveRanges[Node];
 
@@ -911,54 +1362,115 @@ namespace FEXCore::IR {
           if (NeedsToSpill) {
             bool Spilled = false;
 
-            // First let's just check for constants that we can just rematerialize instead of spilling
+            // First let's check for values that are cheap enough to recompute at their next use instead of spilling
+            uint32_t RematInterference = ~0U;
+            bool RematAcrossBlocks = false;
+            auto RematLocation = IR::NodeWrapperIterator::Invalid();
+
             for (uint32_t j = 0; j < CurrentNode->Head.InterferenceCount; ++j) {
               uint32_t InterferenceNode = CurrentNode->InterferenceList[j];
-              if (LiveRanges[InterferenceNode].End > OpLiveRange->End &&
-                  LiveRanges[InterferenceNode].RematCost == 1) { // CONSTANT
-                // We want to end the live range of this value here and continue it on first use
-                IR::OrderedNodeWrapper ConstantOp = IR::OrderedNodeWrapper::WrapOffset(InterferenceNode * sizeof(IR::OrderedNode));
-                IR::OrderedNode *ConstantNode = ConstantOp.GetNode(ListBegin);
-                FEXCore::IR::IROp_Constant const *ConstantIROp = ConstantNode->Op(DataBegin)->C<IR::IROp_Constant>();
-                LogMan::Throw::A(ConstantIROp->Header.Op == IR::OP_CONSTANT, "This needs to be const");
-                // First op post Spill
-                auto NextIter = CodeBegin;
-                auto FirstUseLocation = FindFirstUse(Disp, ConstantNode, NextIter, CodeLast);
-                LogMan::Throw::A(FirstUseLocation != IR::NodeWrapperIterator::Invalid(), "At %%ssa%d Spilling Op %%ssa%d but Failure to find op use", CodeOp->ID(), InterferenceNode);
-                if (FirstUseLocation != IR::NodeWrapperIterator::Invalid()) {
-                  --FirstUseLocation;
-                  IR::OrderedNodeWrapper *FirstUseOp = FirstUseLocation();
-                  IR::OrderedNode *FirstUseOrderedNode = FirstUseOp->GetNode(ListBegin);
-                  Disp->SetWriteCursor(FirstUseOrderedNode);
-                  auto FilledConstant = Disp->_Constant(ConstantIROp->Constant);
-                  Disp->ReplaceAllUsesWithInclusive(ConstantNode, FilledConstant, FirstUseLocation, CodeLast);
-                  Spilled = true;
+              auto *InterferenceLiveRange = &LiveRanges[InterferenceNode];
+              if (InterferenceLiveRange->End <= OpLiveRange->End ||
+                  InterferenceLiveRange->Begin > Node ||
+                  Graph->Nodes[InterferenceNode].Head.PhiMember) {
+                continue;
+              }
+
+              if (RematInterference != ~0U &&
+                  LiveRanges[RematInterference].RematCost <= InterferenceLiveRange->RematCost) {
+                continue;
+              }
+
+              IR::OrderedNodeWrapper InterferenceOp = WrapNode(InterferenceNode);
+              IR::OrderedNode *InterferenceOrderedNode = InterferenceOp.GetNode(ListBegin);
+
+              if (InterferenceLiveRange->Begin < IndexOf(BlockIROp->Begin) ||
+                  InterferenceLiveRange->End > IndexOf(BlockIROp->Last)) {
+                // Only constants can be recomputed in every block that uses them
+                if (InterferenceOrderedNode->Op(DataBegin)->Op == IR::OP_CONSTANT) {
+                  RematInterference = InterferenceNode;
+                  RematAcrossBlocks = true;
                 }
-                break;
+                continue;
+              }
+
+              // First use after this op, recomputing it for a use by this op wouldn't free anything up here
+              auto NextIter = CodeBegin;
+              ++NextIter;
+              auto FirstUseLocation = FindFirstUse(Disp, InterferenceOrderedNode, NextIter, CodeLast);
+              LogMan::Throw::A(FirstUseLocation != IR::NodeWrapperIterator::Invalid(), "At %%ssa%d Spilling Op %%ssa%d but Failure to find op use", CodeOp->ID(), WrapNode(InterferenceNode).ID());
+              if (CanRematerialize(&IR, InterferenceNode, IndexOf(*FirstUseLocation()))) {
+                RematInterference = InterferenceNode;
+                RematAcrossBlocks = false;
+                RematLocation = FirstUseLocation;
               }
             }
 
-            // If we didn't remat a constant then we need to do some real spilling
-            if (!Spilled) {
-              uint32_t InterferenceNode = FindNodeToSpill(CurrentNode, Node, OpLiveRange);
-              if (InterferenceNode != ~0U) {
+            if (RematInterference != ~0U) {
+              // We want to end the live range of this value here and continue it on first use
+              IR::OrderedNodeWrapper RematOp = WrapNode(RematInterference);
+              IR::OrderedNode *RematNode = RematOp.GetNode(ListBegin);
+
+              if (RematAcrossBlocks) {
+                ReloadInUseBlocks(Disp, RematNode, [&]() -> IR::OrderedNode* {
+                  return Rematerialize(Disp, RematNode);
+                });
+              }
+              else {
+                // The op in front of the use can be this op, which may use the value itself and has to keep the original
+                auto InsertLocation = RematLocation;
+                --InsertLocation;
+                Disp->SetWriteCursor(InsertLocation()->GetNode(ListBegin));
+                auto RematerializedNode = Rematerialize(Disp, RematNode);
+                Disp->ReplaceAllUsesWithInclusive(RematNode, RematerializedNode, RematLocation, CodeLast);
+              }
+
+              // Once every use has its own copy the original is dead, but its empty live range would still interfere with everything live across it
+              if (RematNode->GetUses() == 0) {
+                Disp->Remove(RematNode);
+              }
+              Spilled = true;
+            }
+
+            // If we couldn't remat anything then we need to do some real spilling
+            if (!Spilled) {
+              uint32_t InterferenceNode = FindNodeToSpill(CurrentNode, Node, OpLiveRange);
+              if (InterferenceNode != ~0U) {
                 FEXCore::IR::RegisterClassType InterferenceRegClass = FEXCore::IR::RegisterClassType{uint32_t(Graph->Nodes[InterferenceNode].Head.RegAndClass >> 32)};
                 uint32_t SpillSlot = FindSpillSlot(InterferenceNode, InterferenceRegClass);
                 RegisterNode *InterferenceRegisterNode = &Graph->Nodes[InterferenceNode];
                 LogMan::Throw::A(SpillSlot != ~0U, "Interference Node doesn't have a spill slot!");
                 LogMan::Throw::A((InterferenceRegisterNode->Head.RegAndClass & ~0U) != ~0U, "Interference node never assigned a register?");
                 LogMan::Throw::A(InterferenceRegClass != ~0U, "Interference node never assigned a register class?");
-                LogMan::Throw::A(InterferenceRegisterNode->Head.PhiPartner == nullptr, "We don't support spilling PHI nodes currently");
+                LogMan::Throw::A(!InterferenceRegisterNode->Head.PhiMember, "We don't support spilling PHI nodes currently");
 
                 // If the interference's live range is past this op's live range then we can dump it
-                FEXCore::IR::OrderedNodeWrapper InterferenceOp = IR::OrderedNodeWrapper::WrapOffset(InterferenceNode * sizeof(IR::OrderedNode));
+                FEXCore::IR::OrderedNodeWrapper InterferenceOp = WrapNode(InterferenceNode);
                 FEXCore::IR::OrderedNode *InterferenceOrderedNode = InterferenceOp.GetNode(ListBegin);
                 FEXCore::IR::IROp_Header *InterferenceIROp = InterferenceOrderedNode->Op(DataBegin);
 
-                auto PrevIter = CodeBegin;
-                --PrevIter;
-                --PrevIter;
-                Disp->SetWriteCursor(PrevIter()->GetNode(ListBegin));
+                if (LiveRanges[InterferenceNode].Begin < IndexOf(BlockIROp->Begin) ||
+                    LiveRanges[InterferenceNode].End > IndexOf(BlockIROp->Last)) {
+                  // Live across blocks
+                  // Fill in every block that uses it, then spill right after the definition
+                  ReloadInUseBlocks(Disp, InterferenceOrderedNode, [&]() -> IR::OrderedNode* {
+                    auto FilledInterference = Disp->_FillRegister(SpillSlot, {InterferenceRegClass});
+                    FilledInterference.first->Header.Size = InterferenceIROp->Size;
+                    FilledInterference.first->Header.Elements = InterferenceIROp->Elements;
+                    return FilledInterference;
+                  });
+
+                  Disp->SetWriteCursor(InterferenceOrderedNode);
+                  auto SpillOp = Disp->_SpillRegister(InterferenceOrderedNode, SpillSlot, {InterferenceRegClass});
+                  SpillOp.first->Header.Size = InterferenceIROp->Size;
+                  SpillOp.first->Header.Elements = InterferenceIROp->Elements;
+
+                  Disp->SetWriteCursor(LastCursor);
+                  return;
+                }
+
+                // Store it right after the definition, the op before this one can be the definition itself
+                Disp->SetWriteCursor(InterferenceOrderedNode);
 
                 auto SpillOp = Disp->_SpillRegister(InterferenceOrderedNode, SpillSlot, {InterferenceRegClass});
                 SpillOp.first->Header.Size = InterferenceIROp->Size;
@@ -970,13 +1482,12 @@ namespace FEXCore::IR {
                   ++NextIter;
                   auto FirstUseLocation = FindFirstUse(Disp, InterferenceOrderedNode, NextIter, CodeLast);
 
-                  LogMan::Throw::A(FirstUseLocation != NodeWrapperIterator::Invalid(), "At %%ssa%d Spilling Op %%ssa%d but Failure to find op use", CodeOp->ID(), InterferenceNode);
+                  LogMan::Throw::A(FirstUseLocation != NodeWrapperIterator::Invalid(), "At %%ssa%d Spilling Op %%ssa%d but Failure to find op use", CodeOp->ID(), WrapNode(InterferenceNode).ID());
                   if (FirstUseLocation != IR::NodeWrapperIterator::Invalid()) {
-                    --FirstUseLocation;
-                    IR::OrderedNodeWrapper *FirstUseOp = FirstUseLocation();
-                    IR::OrderedNode *FirstUseOrderedNode = FirstUseOp->GetNode(ListBegin);
-
-                    Disp->SetWriteCursor(FirstUseOrderedNode);
+                    // Same as above, only uses from the first one on get the filled value
+                    auto InsertLocation = FirstUseLocation;
+                    --InsertLocation;
+                    Disp->SetWriteCursor(InsertLocation()->GetNode(ListBegin));
 
                     auto FilledInterference = Disp->_FillRegister(SpillSlot, {InterferenceRegClass});
                     FilledInterference.first->Header.Size = InterferenceIROp->Size;
@@ -1024,21 +1535,31 @@ namespace FEXCore::IR {
     Changed |= LocalCompaction->Run(Disp);
     auto IR = Disp->ViewIR();
 
-    uint32_t SSACount = IR.GetSSACount();
-
-    ResetRegisterGraph(Graph, SSACount);
-    FindNodeClasses(Graph, &IR);
+    NumberNodes(&IR);
+    ResetRegisterGraph(Graph, NodeCount);
+    FindNodeClasses(Graph, &IR, NodeIndex);
     CalculateLiveRange(&IR);
+    LinkPhiPartners(&IR);
 
     // Linear foward scan based interference calculation is faster for smaller blocks
     // Smarter block based interference calculation is faster for larger blocks
-    if (SSACount >= 2048) {
+    if (NodeCount >= 2048) {
       CalculateBlockInterferences(&IR);
       CalculateBlockNodeInterference(&IR);
     }
     else {
       CalculateNodeInterference(&IR);
     }
+
+    TiedSources.assign(NodeCount, ~0U);
+    if (TiedSourceHint) {
+      for (uint32_t i = 0; i < NodeCount; ++i) {
+        if (Graph->Nodes[i].Head.RegAndClass != INVALID_REGCLASS) {
+          TiedSources[i] = GetTiedSource(&IR, i);
+        }
+      }
+    }
+
     AllocateVirtualRegisters();
 
     return Changed;
@@ -1074,7 +1595,556 @@ namespace FEXCore::IR {
     return Changed;
   }
 
+  /**
+   * @brief Linear scan allocator for when compile latency matters more than the quality of the allocation
+   *
+   * Walks the live ranges once in order of their start and hands out the first free register.
+   * When a class runs out of registers the range that ends the farthest away is spilled in its entirety.
+   * Spilled values get stored right after their definition and filled right before every use, constants are rematerialized instead.
+   * A spilled PHI set keeps all of its members in one slot.
+   * Then allocation starts over, the fills have short ranges so this converges quickly.
+   */
+  class LinearScanRAPass final : public LiveRangeRAPass {
+    public:
+      LinearScanRAPass();
+      bool Run(OpDispatchBuilder *Disp) override;
+
+      void AllocateRegisterSet(uint32_t RegisterCount, uint32_t ClassCount) override;
+      void AddRegisters(FEXCore::IR::RegisterClassType Class, uint32_t RegisterCount) override;
+      void AddRegisterConflict(FEXCore::IR::RegisterClassType ClassConflict, uint32_t RegConflict, FEXCore::IR::RegisterClassType Class, uint32_t Reg) override;
+      void AllocateRegisterConflicts(FEXCore::IR::RegisterClassType Class, uint32_t NumConflicts) override;
+
+    private:
+      /**
+       * @brief Returns the register and class encoded together
+       * Top 32bits is the class, lower 32bits is the register
+       */
+      uint64_t GetIndexRegister(uint32_t Node) const override;
+
+      struct Interval {
+        uint32_t Begin;
+        uint32_t End;
+        uint32_t Node; ///< Defining node, the first member for PHI sets
+        FEXCore::IR::RegisterClassType Class;
+        uint32_t Reg;
+        bool Rematerializable; ///< Can be recomputed at every use instead of needing a spill slot
+        bool Spillable;
+        bool PhiSet; ///< Spilling it moves every member to the same slot
+        uint32_t Tied; ///< Interval whose register to try first, ~0U for none
+      };
+
+      std::vector<uint32_t> PhysicalRegisterCount;
+      // Class -> Register -> Registers of other classes that share the same hardware
+      std::vector<std::vector<std::vector<uint64_t>>> Conflicts;
+      // Class -> Register -> Number of active intervals that block the register
+      std::vector<std::vector<uint32_t>> InUse;
+
+      std::vector<uint64_t> NodeRegisters;
+      std::vector<Interval> Intervals;
+      std::vector<uint32_t> NodeIntervals; ///< Node -> Interval that it is allocated with
+      std::unique_ptr<FEXCore::IR::Pass> LocalCompaction;
+
+      bool ClassesShareRegisters(FEXCore::IR::RegisterClassType Class1, FEXCore::IR::RegisterClassType Class2) const;
+      bool TryAllocate(Interval *Range);
+      void Release(Interval const *Range);
+
+      void BuildIntervals(FEXCore::IR::IRListView<false> *IR);
+      bool AllocateIntervals(std::vector<uint32_t> *Spills);
+      void SpillNodes(FEXCore::IR::OpDispatchBuilder *Disp, std::vector<uint32_t> const &Spills);
+  };
+
+  LinearScanRAPass::LinearScanRAPass() {
+    LocalCompaction.reset(FEXCore::IR::CreateIRCompaction());
+  }
+
+  void LinearScanRAPass::AllocateRegisterSet(uint32_t RegisterCount, uint32_t ClassCount) {
+    PhysicalRegisterCount.resize(ClassCount);
+    Conflicts.resize(ClassCount);
+    InUse.resize(ClassCount);
+  }
+
+  void LinearScanRAPass::AddRegisters(FEXCore::IR::RegisterClassType Class, uint32_t RegisterCount) {
+    PhysicalRegisterCount[Class] = RegisterCount;
+    InUse[Class].resize(RegisterCount);
+    Conflicts[Class].resize(std::max<size_t>(Conflicts[Class].size(), RegisterCount));
+  }
+
+  void LinearScanRAPass::AddRegisterConflict(FEXCore::IR::RegisterClassType ClassConflict, uint32_t RegConflict, FEXCore::IR::RegisterClassType Class, uint32_t Reg) {
+    LogMan::Throw::A(Reg < Conflicts[Class].size(), "Tried adding reg %d to conflict list only %d in size", Reg, Conflicts[Class].size());
+    LogMan::Throw::A(RegConflict < Conflicts[ClassConflict].size(), "Tried adding reg %d to conflict list only %d in size", RegConflict, Conflicts[ClassConflict].size());
+
+    // Conflict must go both ways
+    // A register can conflict with more than one register of another class, GPR pairs cover two GPRs
+    Conflicts[Class][Reg].emplace_back((static_cast<uint64_t>(ClassConflict.Val) << 32) | RegConflict);
+    Conflicts[ClassConflict][RegConflict].emplace_back((static_cast<uint64_t>(Class.Val) << 32) | Reg);
+  }
+
+  void LinearScanRAPass::AllocateRegisterConflicts(FEXCore::IR::RegisterClassType Class, uint32_t NumConflicts) {
+    Conflicts[Class].resize(std::max<size_t>(Conflicts[Class].size(), NumConflicts));
+  }
+
+  uint64_t LinearScanRAPass::GetIndexRegister(uint32_t Node) const {
+    return NodeRegisters[Node];
+  }
+
+  bool LinearScanRAPass::ClassesShareRegisters(FEXCore::IR::RegisterClassType Class1, FEXCore::IR::RegisterClassType Class2) const {
+    if (Class1 == Class2) {
+      return true;
+    }
+
+    for (auto &RegConflicts : Conflicts[Class1]) {
+      for (auto Conflict : RegConflicts) {
+        if ((Conflict >> 32) == Class2.Val) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  bool LinearScanRAPass::TryAllocate(Interval *Range) {
+    auto &Registers = InUse[Range->Class];
+    auto Take = [&](uint32_t Reg) {
+      Range->Reg = Reg;
+      ++Registers[Reg];
+      for (auto Conflict : Conflicts[Range->Class][Reg]) {
+        ++InUse[Conflict >> 32][Conflict & ~0U];
+      }
+    };
+
+    // The tied source ended right where this begins, so its register was just released
+    if (Range->Tied != ~0U) {
+      uint32_t Reg = Intervals[Range->Tied].Reg;
+      if (Reg < PhysicalRegisterCount[Range->Class] && !Registers[Reg]) {
+        Take(Reg);
+        return true;
+      }
+    }
+
+    for (uint32_t Reg = 0; Reg < PhysicalRegisterCount[Range->Class]; ++Reg) {
+      if (Registers[Reg]) {
+        continue;
+      }
+
+      Take(Reg);
+      return true;
+    }
+    return false;
+  }
+
+  void LinearScanRAPass::Release(Interval const *Range) {
+    --InUse[Range->Class.Val][Range->Reg];
+    for (auto Conflict : Conflicts[Range->Class.Val][Range->Reg]) {
+      --InUse[Conflict >> 32][Conflict & ~0U];
+    }
+  }
+
+  void LinearScanRAPass::BuildIntervals(FEXCore::IR::IRListView<false> *IR) {
+    using namespace FEXCore;
+    uintptr_t ListBegin = IR->GetListData();
+    uintptr_t DataBegin = IR->GetData();
+
+    // Every node in a PHI set needs the same register, so the whole set is allocated as a single interval
+    std::vector<uint32_t> PhiSets(NodeCount);
+    std::vector<bool> PhiMembers(NodeCount);
+    for (uint32_t i = 0; i < NodeCount; ++i) {
+      PhiSets[i] = i;
+    }
+
+    auto FindPhiSet = [&PhiSets](uint32_t Node) {
+      while (PhiSets[Node] != Node) {
+        PhiSets[Node] = PhiSets[PhiSets[Node]];
+        Node = PhiSets[Node];
+      }
+      return Node;
+    };
+
+    for (auto Node : PhiNodes) {
+      IR::OrderedNodeWrapper PhiWrapper = WrapNode(Node);
+      auto Op = PhiWrapper.GetNode(ListBegin)->Op(DataBegin)->C<IR::IROp_Phi>();
+      auto NodeBegin = IR->at(Op->PhiBegin);
+
+      PhiMembers[Node] = true;
+      while (NodeBegin != NodeBegin.Invalid()) {
+        auto IRNodeOp = NodeBegin()->GetNode(ListBegin)->Op(DataBegin)->C<IR::IROp_PhiValue>();
+        PhiMembers[IndexOf(IRNodeOp->Value)] = true;
+        PhiSets[FindPhiSet(IndexOf(IRNodeOp->Value))] = FindPhiSet(Node);
+        NodeBegin = IR->at(IRNodeOp->Next);
+      }
+    }
+
+    Intervals.clear();
+    NodeIntervals.assign(NodeCount, ~0U);
+    std::vector<uint32_t> SetIntervals(NodeCount, ~0U);
+    // Fills and rematerialized values since the last op that isn't one
+    std::vector<uint32_t> Reloads;
+
+    auto Begin = IR->begin();
+    auto HeaderOp = Begin()->GetNode(ListBegin)->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
+    LogMan::Throw::A(HeaderOp->Header.Op == IR::OP_IRHEADER, "First op wasn't IRHeader");
+
+    IR::OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+
+    while (1) {
+      auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+      LogMan::Throw::A(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
+
+      // We grab these nodes this way so we can iterate easily
+      auto CodeBegin = IR->at(BlockIROp->Begin);
+      auto CodeLast = IR->at(BlockIROp->Last);
+      while (1) {
+        auto CodeOp = CodeBegin();
+        auto IROp = CodeOp->GetNode(ListBegin)->Op(DataBegin);
+        uint32_t Node = IndexOf(*CodeOp);
+
+        if (IROp->HasDest) {
+          uint32_t Set = FindPhiSet(Node);
+          LiveRange const &Range = LiveRanges[Node];
+
+          if (SetIntervals[Set] == ~0U) {
+            SetIntervals[Set] = Intervals.size();
+            Intervals.emplace_back(Interval{Range.Begin, Range.End, Node, GetRegClassFromNode(ListBegin, DataBegin, *CodeOp), INVALID_REG, false, true, false, ~0U});
+            Intervals.back().Rematerializable = CanRematerialize(IR, Node, Range.End);
+          }
+          else {
+            auto &SetInterval = Intervals[SetIntervals[Set]];
+            SetInterval.Begin = std::min(SetInterval.Begin, Range.Begin);
+            SetInterval.End = std::max(SetInterval.End, Range.End);
+          }
+
+          // PHI sets can't be split up, they get spilled as a whole
+          if (PhiMembers[Node]) {
+            Intervals[SetIntervals[Set]].PhiSet = true;
+            Intervals[SetIntervals[Set]].Rematerializable = false;
+          }
+
+          // Spilling a fill wouldn't shorten anything
+          if (IROp->Op == IR::OP_FILLREGISTER) {
+            Intervals[SetIntervals[Set]].Spillable = false;
+            Intervals[SetIntervals[Set]].Rematerializable = false;
+          }
+
+          NodeIntervals[Node] = SetIntervals[Set];
+
+          if (TiedSourceHint && !PhiMembers[Node]) {
+            uint32_t Source = GetTiedSource(IR, Node);
+            if (Source != ~0U && NodeIntervals[Source] != ~0U) {
+              Intervals[NodeIntervals[Node]].Tied = NodeIntervals[Source];
+            }
+          }
+        }
+
+        // A value with nothing but other reloads between it and its use wouldn't get any shorter from spilling it again
+        if (IROp->HasDest && (IROp->Op == IR::OP_FILLREGISTER || Intervals[NodeIntervals[Node]].Rematerializable)) {
+          Reloads.emplace_back(Node);
+        }
+        else {
+          for (auto Reload : Reloads) {
+            if (LiveRanges[Reload].End <= Node) {
+              Intervals[NodeIntervals[Reload]].Spillable = false;
+            }
+          }
+          Reloads.clear();
+        }
+
+        // CodeLast is inclusive. So we still need to dump the CodeLast op as well
+        if (CodeBegin == CodeLast) {
+          break;
+        }
+        ++CodeBegin;
+      }
+
+      if (BlockIROp->Next.ID() == 0) {
+        break;
+      } else {
+        BlockNode = BlockIROp->Next.GetNode(ListBegin);
+      }
+    }
+  }
+
+  bool LinearScanRAPass::AllocateIntervals(std::vector<uint32_t> *Spills) {
+    std::vector<uint32_t> Order(Intervals.size());
+    for (uint32_t i = 0; i < Order.size(); ++i) {
+      Order[i] = i;
+    }
+    std::stable_sort(Order.begin(), Order.end(), [this](uint32_t LHS, uint32_t RHS) {
+      return Intervals[LHS].Begin < Intervals[RHS].Begin;
+    });
+
+    for (auto &Registers : InUse) {
+      Registers.assign(Registers.size(), 0);
+    }
+
+    std::vector<uint32_t> Active;
+    for (auto Current : Order) {
+      Interval *Range = &Intervals[Current];
+
+      // Live ranges are [Begin, End), anything that ended by now gives its register back
+      for (size_t i = 0; i < Active.size();) {
+        if (Intervals[Active[i]].End <= Range->Begin) {
+          Release(&Intervals[Active[i]]);
+          Active[i] = Active.back();
+          Active.pop_back();
+        }
+        else {
+          ++i;
+        }
+      }
+
+      bool Allocated = TryAllocate(Range);
+      while (!Allocated) {
+        // Spill whatever lives the longest, only ranges that block registers of this class would help
+        // Anything that can be rematerialized doesn't need a spill slot so it goes first, as long as it outlives the current range.
+        // A value that was already rematerialized right in front of its use wouldn't get any shorter
+        uint32_t Victim = ~0U;
+        size_t VictimIndex = 0;
+        auto IsBetterVictim = [&](Interval const *Candidate) {
+          if (!Candidate->Spillable || Candidate->End <= Range->Begin) {
+            return false;
+          }
+          if (Victim == ~0U) {
+            return true;
+          }
+
+          Interval const *Best = &Intervals[Victim];
+
+          // A PHI set takes a store at every member, so it only goes when nothing else can
+          if (Candidate->PhiSet != Best->PhiSet) {
+            return !Candidate->PhiSet;
+          }
+
+          bool CandidateRemat = Candidate->Rematerializable && Candidate->End > Range->End;
+          bool BestRemat = Best->Rematerializable && Best->End > Range->End;
+          if (CandidateRemat != BestRemat) {
+            return CandidateRemat;
+          }
+          return Candidate->End > Best->End;
+        };
+
+        for (size_t i = 0; i < Active.size(); ++i) {
+          Interval const *Candidate = &Intervals[Active[i]];
+          if (ClassesShareRegisters(Candidate->Class, Range->Class) && IsBetterVictim(Candidate)) {
+            Victim = Active[i];
+            VictimIndex = i;
+          }
+        }
+
+        if (IsBetterVictim(Range)) {
+          Spills->emplace_back(Range->Node);
+          break;
+        }
+
+        LogMan::Throw::A(Victim != ~0U, "Couldn't find Node to spill for %%ssa%d", WrapNode(Range->Node).ID());
+        Spills->emplace_back(Intervals[Victim].Node);
+        Release(&Intervals[Victim]);
+        Active[VictimIndex] = Active.back();
+        Active.pop_back();
+
+        Allocated = TryAllocate(Range);
+      }
+
+      if (Allocated) {
+        Active.emplace_back(Current);
+      }
+    }
+
+    if (!Spills->empty()) {
+      return false;
+    }
+
+    NodeRegisters.assign(NodeIntervals.size(), INVALID_REGCLASS);
+    for (uint32_t Node = 0; Node < NodeIntervals.size(); ++Node) {
+      if (NodeIntervals[Node] != ~0U) {
+        Interval const *Range = &Intervals[NodeIntervals[Node]];
+        NodeRegisters[Node] = (static_cast<uint64_t>(Range->Class.Val) << 32) | Range->Reg;
+      }
+    }
+    return true;
+  }
+
+  void LinearScanRAPass::SpillNodes(FEXCore::IR::OpDispatchBuilder *Disp, std::vector<uint32_t> const &Spills) {
+    using namespace FEXCore;
+
+    auto IR = Disp->ViewIR();
+    uintptr_t ListBegin = IR.GetListData();
+    uintptr_t DataBegin = IR.GetData();
+    auto LastCursor = Disp->GetWriteCursor();
+
+    // Spilled node -> Spill slot, rematerialized nodes don't need one
+    constexpr uint32_t REMAT_SLOT = ~0U - 1;
+    std::unordered_map<uint32_t, uint32_t> SpillSlots;
+    for (auto Node : Spills) {
+      uint32_t SpilledInterval = NodeIntervals[Node];
+      if (Intervals[SpilledInterval].Rematerializable) {
+        SpillSlots[Node] = REMAT_SLOT;
+      }
+      else if (Intervals[SpilledInterval].PhiSet) {
+        // Members of a set never interfere, so they can share a slot the same way they share a register
+        uint32_t Slot = SpillSlotCount++;
+        for (uint32_t Member = 0; Member < NodeIntervals.size(); ++Member) {
+          if (NodeIntervals[Member] == SpilledInterval) {
+            SpillSlots[Member] = Slot;
+          }
+        }
+      }
+      else {
+        SpillSlots[Node] = SpillSlotCount++;
+      }
+    }
+
+    // Inserts the reload at the write cursor
+    // The source of a rematerialized Bfe can be spilled itself, that gets reloaded first
+    std::function<IR::OrderedNode*(IR::OrderedNode*, uint32_t)> Reload = [&](IR::OrderedNode *SpilledNode, uint32_t Slot) -> IR::OrderedNode* {
+      auto SpilledIROp = SpilledNode->Op(DataBegin);
+      if (Slot != REMAT_SLOT) {
+        auto Fill = Disp->_FillRegister(Slot, {GetRegClassFromNode(ListBegin, DataBegin, SpilledNode->Wrapped(ListBegin))});
+        Fill.first->Header.Size = SpilledIROp->Size;
+        Fill.first->Header.Elements = SpilledIROp->Elements;
+        return Fill;
+      }
+
+      uint8_t NumArgs = IR::GetArgs(SpilledIROp->Op);
+      std::vector<IR::OrderedNode*> Args(NumArgs);
+      for (uint8_t i = 0; i < NumArgs; ++i) {
+        auto ArgSlot = SpillSlots.find(IndexOf(SpilledIROp->Args[i]));
+        if (ArgSlot != SpillSlots.end()) {
+          Args[i] = Reload(SpilledIROp->Args[i].GetNode(ListBegin), ArgSlot->second);
+        }
+      }
+
+      auto Remat = Rematerialize(Disp, SpilledNode);
+      for (uint8_t i = 0; i < NumArgs; ++i) {
+        if (Args[i]) {
+          Disp->ReplaceNodeArgument(Remat, i, Args[i]);
+        }
+      }
+      return Remat;
+    };
+
+    auto Begin = IR.begin();
+    auto HeaderOp = Begin()->GetNode(ListBegin)->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
+    LogMan::Throw::A(HeaderOp->Header.Op == IR::OP_IRHEADER, "First op wasn't IRHeader");
+
+    IR::OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+
+    while (1) {
+      auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+      LogMan::Throw::A(BlockIROp->Header.Op == IR::OP_CODEBLOCK, "IR type failed to be a code block");
+
+      // We grab these nodes this way so we can iterate easily
+      auto CodeBegin = IR.at(BlockIROp->Begin);
+      auto CodeLast = IR.at(BlockIROp->Last);
+      IR::OrderedNode *PrevNode = CodeBegin()->GetNode(ListBegin);
+      while (1) {
+        auto CodeOp = CodeBegin();
+        IR::OrderedNode *CodeNode = CodeOp->GetNode(ListBegin);
+        auto IROp = CodeNode->Op(DataBegin);
+
+        // Reload every spilled argument right before the use
+        // PHI ops only tie a set together, a spilled set drops them below
+        uint8_t NumArgs = IROp->Op == IR::OP_PHI || IROp->Op == IR::OP_PHIVALUE ? 0 : IR::GetArgs(IROp->Op);
+        for (uint8_t i = 0; i < NumArgs; ++i) {
+          auto Slot = SpillSlots.find(IndexOf(IROp->Args[i]));
+          if (Slot == SpillSlots.end()) {
+            continue;
+          }
+
+          IR::OrderedNode *SpilledNode = IROp->Args[i].GetNode(ListBegin);
+
+          Disp->SetWriteCursor(PrevNode);
+          IR::OrderedNode *ReloadNode = Reload(SpilledNode, Slot->second);
+
+          // Catches the node being used more than once by this op as well
+          for (uint8_t j = i; j < NumArgs; ++j) {
+            if (IROp->Args[j].ID() == SpilledNode->Wrapped(ListBegin).ID()) {
+              Disp->ReplaceNodeArgument(CodeNode, j, ReloadNode);
+            }
+          }
+        }
+
+        PrevNode = CodeNode;
+
+        // CodeLast is inclusive. So we still need to dump the CodeLast op as well
+        if (CodeBegin == CodeLast) {
+          break;
+        }
+        ++CodeBegin;
+      }
+
+      if (BlockIROp->Next.ID() == 0) {
+        break;
+      } else {
+        BlockNode = BlockIROp->Next.GetNode(ListBegin);
+      }
+    }
+
+    // Store the value right after it is defined, once the uses no longer refer to it
+    for (auto &Slot : SpillSlots) {
+      IR::OrderedNodeWrapper SpillWrapper = WrapNode(Slot.first);
+      IR::OrderedNode *SpilledNode = SpillWrapper.GetNode(ListBegin);
+      auto SpilledIROp = SpilledNode->Op(DataBegin);
+
+      // Every use got its own copy
+      if (Slot.second == REMAT_SLOT) {
+        Disp->Remove(SpilledNode);
+        continue;
+      }
+
+      // Every incoming value stored to the slot already
+      if (SpilledIROp->Op == IR::OP_PHI) {
+        auto PhiValue = IR.at(SpilledIROp->C<IR::IROp_Phi>()->PhiBegin);
+        while (PhiValue != PhiValue.Invalid()) {
+          IR::OrderedNode *PhiValueNode = PhiValue()->GetNode(ListBegin);
+          auto Next = PhiValueNode->Op(DataBegin)->C<IR::IROp_PhiValue>()->Next;
+          Disp->Remove(PhiValueNode);
+          PhiValue = IR.at(Next);
+        }
+        Disp->Remove(SpilledNode);
+        continue;
+      }
+
+      Disp->SetWriteCursor(SpilledNode);
+      auto SpillOp = Disp->_SpillRegister(SpilledNode, Slot.second, {GetRegClassFromNode(ListBegin, DataBegin, SpillWrapper)});
+      SpillOp.first->Header.Size = SpilledIROp->Size;
+      SpillOp.first->Header.Elements = SpilledIROp->Elements;
+    }
+
+    Disp->SetWriteCursor(LastCursor);
+  }
+
+  bool LinearScanRAPass::Run(OpDispatchBuilder *Disp) {
+    bool Changed = false;
+
+    SpillSlotCount = 0;
+    std::vector<uint32_t> Spills;
+
+    while (1) {
+      // Node IDs need to be linear for the live ranges
+      Changed |= LocalCompaction->Run(Disp);
+      auto IR = Disp->ViewIR();
+
+      NumberNodes(&IR);
+      CalculateLiveRange(&IR);
+      BuildIntervals(&IR);
+
+      Spills.clear();
+      if (AllocateIntervals(&Spills)) {
+        break;
+      }
+
+      SpillNodes(Disp, Spills);
+      Changed = true;
+    }
+
+    HadFullRA = true;
+    return Changed;
+  }
+
   FEXCore::IR::RegisterAllocationPass* CreateRegisterAllocationPass() {
     return new ConstrainedRAPass{};
   }
+
+  FEXCore::IR::RegisterAllocationPass* CreateLinearScanRegisterAllocationPass() {
+    return new LinearScanRAPass{};
+  }
 }
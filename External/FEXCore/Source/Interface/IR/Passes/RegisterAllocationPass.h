@@ -9,6 +9,10 @@ class RegisterAllocationPass : public FEXCore::IR::Pass {
   public:
     bool HasFullRA() const { return HadFullRA; }
     uint32_t SpillSlots() const { return SpillSlotCount; }
+    /**
+     * @brief Number of code nodes the registers were allocated for, plus one for the unused index 0
+     */
+    uint32_t GetNodeCount() const { return NodeCount; }
 
     virtual void AllocateRegisterSet(uint32_t RegisterCount, uint32_t ClassCount) = 0;
     virtual void AddRegisters(FEXCore::IR::RegisterClassType Class, uint32_t RegisterCount) = 0;
@@ -37,11 +41,27 @@ class RegisterAllocationPass : public FEXCore::IR::Pass {
      * Top 32bits is the class, lower 32bits is the register
      */
     virtual uint64_t GetNodeRegister(uint32_t Node) = 0;
+
+    /**
+     * @brief Returns true if the value of Node is still needed after the op with ID Op
+     *
+     * Lets the backends preserve only the registers that are live across a call
+     */
+    virtual bool IsLiveAcross(uint32_t Node, uint32_t Op) const = 0;
     /**  @} */
 
+    /**
+     * @brief Prefer giving a node the register of its first argument when that argument dies at the node
+     *
+     * For backends that lower ops to destructive two operand instructions, the copy in to the destination becomes a no-op
+     */
+    void SetTiedSourceHint(bool Enable) { TiedSourceHint = Enable; }
+
   protected:
+    bool TiedSourceHint {};
     bool HasSpills {};
     uint32_t SpillSlotCount {};
+    uint32_t NodeCount {};
     bool HadFullRA {};
 };
 
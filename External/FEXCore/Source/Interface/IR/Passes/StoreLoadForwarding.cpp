@@ -0,0 +1,363 @@
+#include "Interface/IR/PassManager.h"
+#include "Interface/Core/OpcodeDispatcher.h"
+
+#include <unordered_map>
+#include <vector>
+
+/**
+ * @brief Forwards guest memory stores to later loads and removes redundant loads
+ *
+ * Guest code constantly spills to the stack and reloads, push/pop pairs being the most common.
+ * This walks every LoadMem and StoreMem and tracks which value is known to live at each address.
+ *
+ * Addresses are split in to a base SSA node and a constant displacement.
+ * - Same base and displacement: Must alias
+ * - Same base and non-overlapping displacement: Can't alias
+ * - Anything else: May alias
+ *
+ * Known values carry over from a block in to a successor if that successor only has the one predecessor.
+ * Atomics, syscalls and guest calls are full barriers.
+ */
+namespace {
+  struct MemoryAddress {
+    FEXCore::IR::OrderedNode *Base;
+    int64_t Offset;
+  };
+
+  struct MemoryValue {
+    MemoryAddress Address;
+    uint8_t Size;
+    FEXCore::IR::RegisterClassType Class;
+    FEXCore::IR::OrderedNode *Value;
+  };
+
+  using MemoryState = std::vector<MemoryValue>;
+
+  struct BlockInfo {
+    FEXCore::IR::OrderedNode *BlockNode;
+    uint32_t NumPredecessors;
+    uint32_t Predecessor;
+    bool Visited;
+    MemoryState ExitState;
+  };
+}
+
+namespace FEXCore::IR {
+
+class StoreLoadForwarding final : public FEXCore::IR::Pass {
+public:
+  bool Run(OpDispatchBuilder *Disp) override;
+
+private:
+  OpDispatchBuilder *Disp;
+  uintptr_t ListBegin;
+  uintptr_t DataBegin;
+
+  // Offset of the forwarded load -> Value that replaces it
+  std::unordered_map<OrderedNodeWrapper::NodeOffsetType, OrderedNode*> Remap;
+
+  MemoryAddress DecomposeAddress(OrderedNode *Node);
+  bool MustAlias(MemoryValue const &Access, MemoryAddress const &Address, uint8_t Size);
+  bool MayAlias(MemoryValue const &Access, MemoryAddress const &Address, uint8_t Size);
+  OrderedNode *Resolve(OrderedNode *Node);
+  bool HandleBlock(BlockInfo *Block, MemoryState *State);
+};
+
+MemoryAddress StoreLoadForwarding::DecomposeAddress(OrderedNode *Node) {
+  MemoryAddress Address{Node, 0};
+
+  // Walk through adds and subtracts of constants to find the base of the address
+  while (1) {
+    auto IROp = Address.Base->Op(DataBegin);
+    uint64_t Constant;
+
+    if (IROp->Op == OP_CONSTANT) {
+      // Absolute address, no base
+      Address.Offset += IROp->C<IR::IROp_Constant>()->Constant;
+      Address.Base = nullptr;
+      break;
+    }
+    else if (IROp->Op == OP_ADD && Disp->IsValueConstant(IROp->Args[1], &Constant)) {
+      Address.Offset += Constant;
+      Address.Base = Resolve(IROp->Args[0].GetNode(ListBegin));
+    }
+    else if (IROp->Op == OP_ADD && Disp->IsValueConstant(IROp->Args[0], &Constant)) {
+      Address.Offset += Constant;
+      Address.Base = Resolve(IROp->Args[1].GetNode(ListBegin));
+    }
+    else if (IROp->Op == OP_SUB && Disp->IsValueConstant(IROp->Args[1], &Constant)) {
+      Address.Offset -= Constant;
+      Address.Base = Resolve(IROp->Args[0].GetNode(ListBegin));
+    }
+    else {
+      break;
+    }
+  }
+
+  return Address;
+}
+
+bool StoreLoadForwarding::MustAlias(MemoryValue const &Access, MemoryAddress const &Address, uint8_t Size) {
+  return Access.Address.Base == Address.Base &&
+         Access.Address.Offset == Address.Offset &&
+         Access.Size == Size;
+}
+
+bool StoreLoadForwarding::MayAlias(MemoryValue const &Access, MemoryAddress const &Address, uint8_t Size) {
+  if (Access.Address.Base != Address.Base) {
+    // Different bases could point anywhere
+    return true;
+  }
+
+  return Access.Address.Offset < (Address.Offset + Size) &&
+         Address.Offset < (Access.Address.Offset + Access.Size);
+}
+
+OrderedNode *StoreLoadForwarding::Resolve(OrderedNode *Node) {
+  auto It = Remap.find(Node->Wrapped(ListBegin).NodeOffset);
+  if (It != Remap.end()) {
+    return It->second;
+  }
+  return Node;
+}
+
+bool StoreLoadForwarding::HandleBlock(BlockInfo *Block, MemoryState *State) {
+  bool Changed = false;
+  auto CurrentIR = Disp->ViewIR();
+  auto BlockIROp = Block->BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+
+  // We grab these nodes this way so we can iterate easily
+  auto CodeBegin = CurrentIR.at(BlockIROp->Begin);
+  auto CodeLast = CurrentIR.at(BlockIROp->Last);
+
+  while (1) {
+    auto CodeOp = CodeBegin();
+    OrderedNode *CodeNode = CodeOp->GetNode(ListBegin);
+    auto IROp = CodeNode->Op(DataBegin);
+
+    switch (IROp->Op) {
+      case OP_LOADMEM: {
+        auto Op = IROp->CW<IR::IROp_LoadMem>();
+        MemoryAddress Address = DecomposeAddress(Resolve(Op->Header.Args[0].GetNode(ListBegin)));
+
+        OrderedNode *Forward{};
+        for (auto &Value : *State) {
+          if (!MustAlias(Value, Address, Op->Size) ||
+              Value.Class.Val != Op->Class.Val) {
+            continue;
+          }
+
+          uint8_t ValueSize = Disp->GetOpSize(Value.Value);
+          if (ValueSize == Op->Size) {
+            Forward = Value.Value;
+          }
+          else if (Op->Class.Val == GPRClass.Val && ValueSize > Op->Size) {
+            // The store only wrote the bottom of the value, loads zero extend
+            Disp->SetWriteCursor(CodeNode);
+            auto Extract = Disp->_Bfe(Op->Size * 8, 0, Value.Value);
+            Extract.first->Header.Size = Op->Size;
+            Forward = Extract;
+          }
+          break;
+        }
+
+        if (Forward) {
+          Remap[CodeOp->NodeOffset] = Forward;
+          Changed = true;
+        }
+        else {
+          State->emplace_back(MemoryValue{Address, Op->Size, Op->Class, CodeNode});
+        }
+        break;
+      }
+      case OP_STOREMEM: {
+        auto Op = IROp->CW<IR::IROp_StoreMem>();
+        MemoryAddress Address = DecomposeAddress(Resolve(Op->Header.Args[0].GetNode(ListBegin)));
+
+        // Anything this store may overwrite isn't known any more
+        for (size_t i = 0; i < State->size();) {
+          if (MayAlias(State->at(i), Address, Op->Size)) {
+            State->at(i) = State->back();
+            State->pop_back();
+          }
+          else {
+            ++i;
+          }
+        }
+
+        State->emplace_back(MemoryValue{Address, Op->Size, Op->Class, Resolve(Op->Header.Args[1].GetNode(ListBegin))});
+        break;
+      }
+      // Anything that can touch memory that we don't track
+      case OP_CAS:
+      case OP_CASPAIR:
+      case OP_ATOMICADD:
+      case OP_ATOMICSUB:
+      case OP_ATOMICAND:
+      case OP_ATOMICOR:
+      case OP_ATOMICXOR:
+      case OP_ATOMICSWAP:
+      case OP_ATOMICFETCHADD:
+      case OP_ATOMICFETCHSUB:
+      case OP_ATOMICFETCHAND:
+      case OP_ATOMICFETCHOR:
+      case OP_ATOMICFETCHXOR:
+      case OP_MEMCPY:
+      case OP_MEMSET:
+      case OP_SYSCALL:
+      case OP_BREAK:
+      case OP_GUESTCALLDIRECT:
+      case OP_GUESTCALLINDIRECT:
+      case OP_GUESTRETURN:
+        State->clear();
+        break;
+      default: break;
+    }
+
+    // CodeLast is inclusive. So we still need to dump the CodeLast op as well
+    if (CodeBegin == CodeLast) {
+      break;
+    }
+    ++CodeBegin;
+  }
+
+  return Changed;
+}
+
+bool StoreLoadForwarding::Run(OpDispatchBuilder *_Disp) {
+  Disp = _Disp;
+  bool Changed = false;
+  auto CurrentIR = Disp->ViewIR();
+  ListBegin = CurrentIR.GetListData();
+  DataBegin = CurrentIR.GetData();
+  Remap.clear();
+
+  auto Begin = CurrentIR.begin();
+  auto Op = Begin();
+
+  OrderedNode *RealNode = Op->GetNode(ListBegin);
+  auto HeaderOp = RealNode->Op(DataBegin)->CW<FEXCore::IR::IROp_IRHeader>();
+  LogMan::Throw::A(HeaderOp->Header.Op == OP_IRHEADER, "First op wasn't IRHeader");
+
+  auto OriginalCursor = Disp->GetWriteCursor();
+
+  // Gather the blocks and their predecessors
+  std::vector<BlockInfo> Blocks;
+  std::unordered_map<uint32_t, uint32_t> BlockIDToIndex;
+  {
+    OrderedNode *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+    while (1) {
+      auto BlockIROp = BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+      LogMan::Throw::A(BlockIROp->Header.Op == OP_CODEBLOCK, "IR type failed to be a code block");
+
+      BlockIDToIndex[BlockNode->Wrapped(ListBegin).ID()] = Blocks.size();
+      Blocks.emplace_back(BlockInfo{BlockNode, 0, ~0U});
+
+      if (BlockIROp->Next.ID() == 0) {
+        break;
+      } else {
+        BlockNode = BlockIROp->Next.GetNode(ListBegin);
+      }
+    }
+  }
+
+  auto AddEdge = [&](uint32_t From, uint32_t To) {
+    Blocks[To].NumPredecessors++;
+    Blocks[To].Predecessor = From;
+  };
+
+  for (uint32_t i = 0; i < Blocks.size(); ++i) {
+    auto BlockIROp = Blocks[i].BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+    auto CodeBegin = CurrentIR.at(BlockIROp->Begin);
+    auto CodeLast = CurrentIR.at(BlockIROp->Last);
+
+    bool HasTerminator = false;
+    while (!HasTerminator) {
+      auto IROp = CodeBegin()->GetNode(ListBegin)->Op(DataBegin);
+      switch (IROp->Op) {
+        case OP_JUMP:
+          AddEdge(i, BlockIDToIndex[IROp->Args[0].ID()]);
+          HasTerminator = true;
+          break;
+        case OP_CONDJUMP:
+          AddEdge(i, BlockIDToIndex[IROp->Args[1].ID()]);
+          // Both targets being the same block still only gives it a single predecessor
+          if (IROp->Args[1].ID() != IROp->Args[2].ID()) {
+            AddEdge(i, BlockIDToIndex[IROp->Args[2].ID()]);
+          }
+          HasTerminator = true;
+          break;
+        case OP_EXITFUNCTION:
+        case OP_BREAK:
+          HasTerminator = true;
+          break;
+        default: break;
+      }
+
+      if (CodeBegin == CodeLast) {
+        break;
+      }
+      ++CodeBegin;
+    }
+
+    if (!HasTerminator && i + 1 < Blocks.size()) {
+      AddEdge(i, i + 1);
+    }
+  }
+
+  // Blocks are laid out with predecessors first in most cases
+  // If a block's only predecessor was already visited then the memory state carries over
+  for (auto &Block : Blocks) {
+    MemoryState State;
+    if (Block.NumPredecessors == 1 &&
+        Blocks[Block.Predecessor].Visited &&
+        &Blocks[Block.Predecessor] != &Block) {
+      State = Blocks[Block.Predecessor].ExitState;
+    }
+
+    Changed |= HandleBlock(&Block, &State);
+    Block.ExitState = std::move(State);
+    Block.Visited = true;
+  }
+
+  if (!Remap.empty()) {
+    // Rewrite all uses of the forwarded loads, these can be in any block
+    for (auto &Block : Blocks) {
+      auto BlockIROp = Block.BlockNode->Op(DataBegin)->CW<FEXCore::IR::IROp_CodeBlock>();
+      auto CodeBegin = CurrentIR.at(BlockIROp->Begin);
+      auto CodeLast = CurrentIR.at(BlockIROp->Last);
+      while (1) {
+        auto CodeOp = CodeBegin();
+        OrderedNode *CodeNode = CodeOp->GetNode(ListBegin);
+        auto IROp = CodeNode->Op(DataBegin);
+
+        uint8_t NumArgs = IR::GetArgs(IROp->Op);
+        for (uint8_t i = 0; i < NumArgs; ++i) {
+          auto It = Remap.find(IROp->Args[i].NodeOffset);
+          if (It != Remap.end()) {
+            Disp->ReplaceNodeArgument(CodeNode, i, It->second);
+          }
+        }
+
+        if (CodeBegin == CodeLast) {
+          break;
+        }
+        ++CodeBegin;
+      }
+    }
+
+    for (auto &Load : Remap) {
+      Disp->Remove(IR::OrderedNodeWrapper::WrapOffset(Load.first).GetNode(ListBegin));
+    }
+  }
+
+  Disp->SetWriteCursor(OriginalCursor);
+
+  return Changed;
+}
+
+FEXCore::IR::Pass* CreateStoreLoadForwarding() {
+  return new StoreLoadForwarding{};
+}
+
+}
@@ -13,6 +13,18 @@ namespace FEXCore::Config {
     CONFIG_GDBSERVER,
     CONFIG_ROOTFSPATH,
     CONFIG_UNIFIED_MEMORY,
+    CONFIG_OPTIMIZATION_LEVEL,
+    CONFIG_PASS_PIPELINE,
+    CONFIG_PASS_FIXEDPOINT_ITERATIONS,
+    CONFIG_PASS_STATISTICS,
+    CONFIG_IR_SERIALIZE_PATH,
+    CONFIG_IR_CACHE_RETAIN,
+    CONFIG_IR_CACHE_SIZE,
+    CONFIG_REGISTER_ALLOCATOR,
+    CONFIG_HOST_FEATURES,
+    CONFIG_JIT_WX,
+    CONFIG_X87_REDUCED_PRECISION,
+    CONFIG_JIT_SYMBOLS,
   };
 
   enum ConfigCore {
@@ -22,6 +34,23 @@ namespace FEXCore::Config {
     CONFIG_CUSTOM,
   };
 
+  enum ConfigOptimizationLevel {
+    CONFIG_O0, ///< No optimization passes
+    CONFIG_O1, ///< Cheap block local passes
+    CONFIG_O2, ///< Everything, including the multiblock passes
+  };
+
+  enum ConfigRegisterAllocator {
+    CONFIG_RA_AUTO,       ///< Linear scan below CONFIG_O2, graph coloring otherwise
+    CONFIG_RA_GRAPH,      ///< Interference graph, slower to run but spills less
+    CONFIG_RA_LINEARSCAN, ///< Single pass over the live intervals
+  };
+
+  enum ConfigHostFeatures {
+    CONFIG_HOSTFEATURES_AUTO,     ///< Use every instruction set extension the host supports
+    CONFIG_HOSTFEATURES_BASELINE, ///< Only emit the baseline instruction set, for testing the fallback paths
+  };
+
   void SetConfig(FEXCore::Context::Context *CTX, ConfigOption Option, uint64_t Config);
   void SetConfig(FEXCore::Context::Context *CTX, ConfigOption Option, std::string const &Config);
   uint64_t GetConfig(FEXCore::Context::Context *CTX, ConfigOption Option);
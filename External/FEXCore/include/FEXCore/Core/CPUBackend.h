@@ -70,6 +70,22 @@ class LLVMCore;
      */
     virtual bool NeedsOpDispatch() = 0;
 
+    /**
+     * @brief Lets FEXCore know if this CPUBackend still reads the IR and DebugData of a block after CompileCode returns
+     *
+     * The IR of a block is only kept around after compilation if this returns true or retention is forced through the config
+     *
+     * @return true if the IR needs to be retained
+     */
+    virtual bool NeedsRetainedIR() { return false; }
+
+    /**
+     * @brief Called once every block got unmapped from the block cache, the backend may reuse the memory of its code
+     *
+     * The code of the block that is currently being mapped has to stay where it is
+     */
+    virtual void ClearCache() {}
+
     virtual bool HasCustomDispatch() const { return false; }
 
     virtual void ExecuteCustomDispatch(FEXCore::Core::ThreadState *Thread) {}
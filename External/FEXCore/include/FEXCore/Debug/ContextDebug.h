@@ -2,6 +2,8 @@
 #include <FEXCore/Core/CoreState.h>
 #include <FEXCore/Memory/MemMapper.h>
 #include <FEXCore/Debug/InternalThreadState.h>
+#include <FEXCore/IR/IntrusiveIRList.h>
+#include <FEXCore/IR/PassStatistics.h>
 
 #include <stdint.h>
 #include <vector>
@@ -29,6 +31,35 @@ namespace Debug {
   // bool FindIRForRIP(FEXCore::Context::Context *CTX, uint64_t RIP, FEXCore::IR::IntrusiveIRList **ir);
   // void SetIRForRIP(FEXCore::Context::Context *CTX, uint64_t RIP, FEXCore::IR::IntrusiveIRList *const ir);
   FEXCore::Core::ThreadState *GetThreadState(FEXCore::Context::Context *CTX);
+
+  /**
+   * @brief Gets the IR pass counters aggregated over every block compiled so far
+   *
+   * Only collected while CONFIG_PASS_STATISTICS is enabled
+   */
+  void GetPassStatistics(FEXCore::Context::Context *CTX, std::vector<FEXCore::IR::PassStatistics> *Stats);
+  void ResetPassStatistics(FEXCore::Context::Context *CTX);
+
+  struct IRCompileResult {
+    FEXCore::IR::IRListView<true> *IR; ///< The optimized IR, owned by the caller
+    uint64_t PassTimeNS;               ///< Time spent in the pass pipeline
+    uint64_t CompileTimeNS;            ///< Time spent in the CPU backend
+    uint64_t HostCodeSize;             ///< Size of the generated host code
+    uint32_t SpillSlots;               ///< Spill slots the register allocator needed, 0 for backends without one
+  };
+
+  /**
+   * @brief Runs the configured pass pipeline over a copy of IR, without needing a guest to be loaded
+   *
+   * Only InitializeContext needs to have been called.
+   *
+   * @param IR The IR to optimize, left untouched
+   * @param Compile Also compile the optimized IR with the configured CPU backend
+   * @param Result The optimized IR and timings
+   *
+   * @return false if the backend failed to compile the IR
+   */
+  bool OptimizeIR(FEXCore::Context::Context *CTX, FEXCore::IR::IRListView<true> const *IR, bool Compile, IRCompileResult *Result);
 }
 }
 
@@ -4,8 +4,10 @@
 #include <FEXCore/Core/CPUBackend.h>
 #include <FEXCore/IR/IntrusiveIRList.h>
 #include <FEXCore/Utils/Event.h>
-#include <map>
+#include <memory>
 #include <thread>
+#include <unordered_map>
+#include <vector>
 
 namespace FEXCore {
   class BlockCache;
@@ -23,6 +25,18 @@ namespace FEXCore::Core {
   struct RuntimeStats {
     std::atomic_uint64_t InstructionsExecuted;
     std::atomic_uint64_t BlocksCompiled;
+    std::atomic_uint64_t CodeChunks;         ///< Chunks of executable memory the JIT mapped
+    std::atomic_uint64_t CodeHugePageChunks; ///< Chunks of those backed by 2MB pages
+    std::atomic_uint64_t CodeBytesAllocated;
+    std::atomic_uint64_t CodeBytesUsed;
+  };
+
+  /**
+   * @brief Where the host code of a guest instruction starts
+   */
+  struct DebugDataGuestOpcode {
+    uint32_t HostEntryOffset; ///< Offset from the start of the block's host code
+    uint64_t GuestRIP;
   };
 
   /**
@@ -36,6 +50,17 @@ namespace FEXCore::Core {
     uint64_t GuestInstructionCount; ///< Number of guest instructions
     uint64_t TimeSpentInCode; ///< How long this code has spent time running
     uint64_t RunCount; ///< Number of times this block of code has been run
+    uint64_t LastUsed; ///< IR cache stamp of the last time the IR of this block was used
+    std::vector<DebugDataGuestOpcode> GuestOpcodes; ///< Sorted by host offset, only filled while JIT symbols are enabled
+  };
+
+  /**
+   * @brief A block in the IR cache of a thread
+   */
+  struct IRCacheEntry {
+    std::unique_ptr<FEXCore::IR::IRListView<true>> IR;
+    FEXCore::Core::DebugData DebugData;
+    std::shared_ptr<void> BackendData; ///< Backend specific form of the IR, dropped along with the IR
   };
 
   struct InternalThreadState {
@@ -54,8 +79,13 @@ namespace FEXCore::Core {
 
     std::unique_ptr<FEXCore::BlockCache> BlockCache;
 
-    std::map<uint64_t, std::unique_ptr<FEXCore::IR::IRListView<true>>> IRLists;
-    std::map<uint64_t, FEXCore::Core::DebugData> DebugData;
+    // Backs every IR copy in IRLists, freed in bulk when the code cache is cleared or compacted
+    FEXCore::IR::SlabAllocator IRListAllocator;
+    // Only filled in when IR is retained, see Context::ShouldRetainIR
+    // Hashed so the interpreter gets to the IR and DebugData of a block with a single lookup
+    std::unordered_map<uint64_t, IRCacheEntry> IRLists;
+    uint64_t IRCacheBytes{}; ///< Size of the IR in IRLists
+    uint64_t IRCacheStamp{}; ///< Bumped every time retained IR is used, for the LRU
     RuntimeStats Stats{};
 
     FEXCore::Context::ExitReason ExitReason {FEXCore::Context::ExitReason::EXIT_WAITING};
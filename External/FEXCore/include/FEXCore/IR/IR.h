@@ -150,16 +150,15 @@ private:
 /**
  * @brief This is a node in our IR representation
  * Is a doubly linked list node that lives in a representation of a linearly allocated node list
- * The links in the nodes can live in a list independent of the data IR data
+ * A node and the op it points to are allocated together, the op directly follows the node
  *
  * ex.
- *  Region1 : ... <-> <OrderedNode> <-> <OrderedNode> <-> ...
- *                    | *<Value>        |
- *                    v                 v
- *  Region2 : <IROp>..<IROp>..<IROp>..<IROp>
+ *  ... <-> <OrderedNode><IROp> <-> <OrderedNode><IROp......> <-> ...
  *
- *  In this example the OrderedNodes are allocated in one linear memory region (Not necessarily contiguous with one another linking)
- *  The second region is contiguous but they don't have any relationship with one another directly
+ *  The nodes are allocated in one linear memory region (Not necessarily contiguous with one another linking)
+ *  Ops are variable sized, so nodes are only 4 byte aligned
+ *  Walking the list touches the node and its op in the same cache line
+ *  A node's Value can still point at an op somewhere else in the list once the op is replaced
  */
 class OrderedNode final {
   friend class NodeWrapperIterator;
@@ -284,7 +283,7 @@ class OrderedNode final {
     void AddUse() { ++NumUses; }
     void RemoveUse() { --NumUses; }
 
-    value_type Wrapped(uintptr_t Base) {
+    value_type Wrapped(uintptr_t Base) const {
       value_type Tmp;
       Tmp.SetOffset(Base, reinterpret_cast<uintptr_t>(this));
       return Tmp;
@@ -317,6 +316,13 @@ static_assert(std::is_trivially_copyable<OrderedNode>::value);
 static_assert(offsetof(OrderedNode, Header) == 0);
 static_assert(sizeof(OrderedNode) == (sizeof(OrderedNodeHeader) + sizeof(uint32_t)));
 
+/**
+ * @brief Nodes and their ops are packed back to back, without any padding
+ * The ID of a node is its offset in units of this size. Every node takes up at least this much, so IDs are unique
+ * IDs keep the order of the list but have gaps in them, so an ID can't be turned back in to an offset
+ */
+constexpr size_t NODE_ID_STRIDE = sizeof(OrderedNode);
+
 struct RegisterClassType final {
   uint32_t Val;
   operator uint32_t() {
@@ -341,7 +347,30 @@ class IRListView;
 
 void Dump(std::stringstream *out, IRListView<false> const* IR);
 
+/**
+ * @brief Parses IR in the text form that Dump writes out
+ *
+ * SSA IDs in the text don't need to match up with where the nodes end up, the parsed IR is laid out like compacted IR
+ *
+ * @return The parsed IR, owned by the caller. nullptr if the text wasn't valid IR
+ */
+IRListView<true> *Parse(std::istream *in);
+
+/**
+ * @brief Writes out IR in a compact binary form that Deserialize can load back
+ *
+ * Only ops that are part of a block are written out
+ */
+void Serialize(std::ostream *out, IRListView<false> const* IR);
+
+/**
+ * @brief Loads IR that was written with Serialize
+ *
+ * @return The loaded IR, owned by the caller. nullptr if the input wasn't valid serialized IR
+ */
+IRListView<true> *Deserialize(std::istream *in);
+
 template<typename Type>
-inline uint32_t NodeWrapperBase<Type>::ID() const { return NodeOffset / sizeof(IR::OrderedNode); }
+inline uint32_t NodeWrapperBase<Type>::ID() const { return NodeOffset / IR::NODE_ID_STRIDE; }
 
 };
@@ -2,9 +2,11 @@
 
 #include "FEXCore/IR/IR.h"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstring>
+#include <sys/mman.h>
 #include <tuple>
 #include <vector>
 
@@ -14,19 +16,32 @@ namespace FEXCore::IR {
  * This doesn't support any form of ordering at all
  * Just provides a chunk of memory for allocating IR nodes from
  *
- * Can potentially support reallocation if we are smart and make sure to invalidate anything holding a true pointer
+ * IR nodes refer to each other by offset from the base, so the memory needs to stay contiguous.
+ * A large range of address space is reserved up front and committed in chunks as the allocator grows.
+ * Growing never moves the data, so pointers in to the allocator stay valid.
  */
 class IntrusiveAllocator final {
   public:
+    // Address space reserved per allocator, only what gets committed takes up memory
+    constexpr static size_t DEFAULT_RESERVE = 256 * 1024 * 1024;
+    constexpr static size_t COMMIT_CHUNK_SIZE = 1024 * 1024;
+
     IntrusiveAllocator() = delete;
     IntrusiveAllocator(IntrusiveAllocator &&) = delete;
-    IntrusiveAllocator(size_t Size)
-      : MemorySize {Size} {
-      Data = reinterpret_cast<uintptr_t>(malloc(Size));
+    /**
+     * @param InitialSize How much memory is committed up front
+     * @param ReserveSize The largest size the allocator can grow to
+     */
+    IntrusiveAllocator(size_t InitialSize, size_t ReserveSize = DEFAULT_RESERVE)
+      : MemorySize {AlignUp(std::max(InitialSize, ReserveSize))} {
+      void *Ptr = mmap(nullptr, MemorySize, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+      assert(Ptr != MAP_FAILED && "Couldn't reserve memory for IntrusiveAllocator");
+      Data = reinterpret_cast<uintptr_t>(Ptr);
+      Commit(InitialSize);
     }
 
     ~IntrusiveAllocator() {
-      free(reinterpret_cast<void*>(Data));
+      munmap(reinterpret_cast<void*>(Data), MemorySize);
     }
 
     bool CheckSize(size_t Size) {
@@ -38,6 +53,9 @@ class IntrusiveAllocator final {
       assert(CheckSize(Size) &&
         "Ran out of space in IntrusiveAllocator during allocation");
       size_t NewOffset = CurrentOffset + Size;
+      if (NewOffset > CommittedSize) {
+        Commit(NewOffset);
+      }
       uintptr_t NewPointer = Data + CurrentOffset;
       CurrentOffset = NewOffset;
       return reinterpret_cast<void*>(NewPointer);
@@ -45,20 +63,114 @@ class IntrusiveAllocator final {
 
     size_t Size() const { return CurrentOffset; }
     size_t BackingSize() const { return MemorySize; }
+    size_t CommitSize() const { return CommittedSize; }
 
     uintptr_t const Begin() const { return Data; }
 
+    // Committed memory is kept around, the allocator is reused for every block
     void Reset() { CurrentOffset = 0; }
 
     void CopyData(IntrusiveAllocator const &rhs) {
+      if (rhs.CurrentOffset > CommittedSize) {
+        Commit(rhs.CurrentOffset);
+      }
       CurrentOffset = rhs.CurrentOffset;
       memcpy(reinterpret_cast<void*>(Data), reinterpret_cast<void*>(rhs.Data), CurrentOffset);
     }
 
   private:
     size_t CurrentOffset {0};
+    size_t CommittedSize {0};
     size_t MemorySize;
     uintptr_t Data;
+
+    static size_t AlignUp(size_t Size) {
+      return (Size + COMMIT_CHUNK_SIZE - 1) & ~(COMMIT_CHUNK_SIZE - 1);
+    }
+
+    void Commit(size_t Size) {
+      size_t NewCommittedSize = std::min(AlignUp(Size), MemorySize);
+      if (NewCommittedSize <= CommittedSize) {
+        return;
+      }
+
+      [[maybe_unused]] int Result = mprotect(reinterpret_cast<void*>(Data + CommittedSize), NewCommittedSize - CommittedSize, PROT_READ | PROT_WRITE);
+      assert(Result == 0 && "Couldn't commit memory for IntrusiveAllocator");
+      CommittedSize = NewCommittedSize;
+    }
+};
+
+/**
+ * @brief Arena for IR copies that stay around for as long as the code that was compiled from them
+ *
+ * Copies are bump allocated out of large slabs instead of every compiled block doing its own malloc.
+ * Nothing is freed individually, everything is released at once when the code cache is cleared.
+ */
+class SlabAllocator final {
+  public:
+    constexpr static size_t SLAB_SIZE = 2 * 1024 * 1024;
+
+    SlabAllocator() = default;
+    SlabAllocator(SlabAllocator const &) = delete;
+    SlabAllocator &operator=(SlabAllocator const &) = delete;
+
+    ~SlabAllocator() {
+      for (auto &Slab : Slabs) {
+        munmap(Slab.Ptr, Slab.Size);
+      }
+    }
+
+    void *Allocate(size_t Size) {
+      // Keep every allocation 16 byte aligned
+      Size = (Size + 15) & ~15ULL;
+
+      if (Slabs.empty() || CurrentOffset + Size > Slabs.back().Size) {
+        // Allocations larger than a slab get a slab to themselves
+        size_t NewSize = std::max(SLAB_SIZE, (Size + SLAB_SIZE - 1) & ~(SLAB_SIZE - 1));
+        void *Ptr = mmap(nullptr, NewSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+        assert(Ptr != MAP_FAILED && "Couldn't allocate IR slab");
+        Slabs.emplace_back(SlabRange{Ptr, NewSize});
+        CurrentOffset = 0;
+        TotalSize += NewSize;
+      }
+
+      void *Ptr = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(Slabs.back().Ptr) + CurrentOffset);
+      CurrentOffset += Size;
+      AllocatedSize += Size;
+      return Ptr;
+    }
+
+    /**
+     * @brief Frees every allocation at once
+     *
+     * The first slab is kept for reuse
+     */
+    void Reset() {
+      for (size_t i = 1; i < Slabs.size(); ++i) {
+        munmap(Slabs[i].Ptr, Slabs[i].Size);
+      }
+
+      if (!Slabs.empty()) {
+        Slabs.resize(1);
+        TotalSize = Slabs.front().Size;
+      }
+      CurrentOffset = 0;
+      AllocatedSize = 0;
+    }
+
+    size_t GetAllocatedSize() const { return AllocatedSize; }
+    size_t GetTotalSize() const { return TotalSize; }
+
+  private:
+    struct SlabRange {
+      void *Ptr;
+      size_t Size;
+    };
+
+    std::vector<SlabRange> Slabs;
+    size_t CurrentOffset {0};
+    size_t AllocatedSize {0};
+    size_t TotalSize {0};
 };
 
 template<bool Copy>
@@ -67,44 +179,53 @@ public:
   IRListView() = delete;
   IRListView(IRListView<Copy> &&) = delete;
 
-  IRListView(IntrusiveAllocator *Data, IntrusiveAllocator *List) {
-    DataSize = Data->Size();
-    ListSize = List->Size();
-
+  IRListView(IntrusiveAllocator *Data, SlabAllocator *Slab = nullptr)
+    : DataSize {Data->Size()} {
     if (Copy) {
-      IRData = malloc(DataSize + ListSize);
-      ListData = reinterpret_cast<void*>(reinterpret_cast<uintptr_t>(IRData) + DataSize);
-      memcpy(IRData, reinterpret_cast<void*>(Data->Begin()), DataSize);
-      memcpy(ListData, reinterpret_cast<void*>(List->Begin()), ListSize);
+      CopyFrom(reinterpret_cast<void*>(Data->Begin()), Slab);
     }
     else {
       // We are just pointing to the data
       IRData = reinterpret_cast<void*>(Data->Begin());
-      ListData = reinterpret_cast<void*>(List->Begin());
     }
   }
 
-  ~IRListView() {
+  /**
+   * @brief Views IR that lives in a raw buffer, for IR that was loaded from somewhere other than the OpDispatcher
+   */
+  IRListView(void *Data, size_t _DataSize, SlabAllocator *Slab = nullptr)
+    : DataSize {_DataSize} {
     if (Copy) {
+      CopyFrom(Data, Slab);
+    }
+    else {
+      IRData = Data;
+    }
+  }
+
+  ~IRListView() {
+    if (Copy && !InSlab) {
       free (IRData);
-      // ListData is just offset from IRData
     }
   }
 
+  // Nodes and their ops live in the same list
+  // Both bases are kept so node and op accesses stay explicit about what they are looking up
   uintptr_t const GetData() const { return reinterpret_cast<uintptr_t>(IRData); }
-  uintptr_t const GetListData() const { return reinterpret_cast<uintptr_t>(ListData); }
+  uintptr_t const GetListData() const { return reinterpret_cast<uintptr_t>(IRData); }
 
   size_t GetDataSize() const { return DataSize; }
-  size_t GetListSize() const { return ListSize; }
-  size_t GetSSACount() const { return ListSize / sizeof(OrderedNode); }
+  // IDs have gaps in them, this is one past the largest ID for sizing arrays that are indexed by ID
+  size_t GetSSACount() const { return DataSize / NODE_ID_STRIDE; }
 
   using iterator = NodeWrapperIterator;
 
   iterator begin() const noexcept
   {
     OrderedNodeWrapper Wrapped;
+    // The header directly follows the invalid node
     Wrapped.NodeOffset = sizeof(OrderedNode);
-    return iterator(reinterpret_cast<uintptr_t>(ListData), Wrapped);
+    return iterator(reinterpret_cast<uintptr_t>(IRData), Wrapped);
   }
 
   /**
@@ -116,7 +237,7 @@ public:
   {
     OrderedNodeWrapper Wrapped;
     Wrapped.NodeOffset = 0;
-    return iterator(reinterpret_cast<uintptr_t>(ListData), Wrapped);
+    return iterator(reinterpret_cast<uintptr_t>(IRData), Wrapped);
   }
 
   /**
@@ -124,14 +245,25 @@ public:
    * @return Iterator for this op
    */
   iterator at(OrderedNodeWrapper Node) const noexcept {
-    return iterator(reinterpret_cast<uintptr_t>(ListData), Node);
+    return iterator(reinterpret_cast<uintptr_t>(IRData), Node);
   }
 
 private:
   void *IRData;
-  void *ListData;
   size_t DataSize;
-  size_t ListSize;
+  // Slab memory is only freed when the whole slab is
+  bool InSlab {false};
+
+  void CopyFrom(void const *Data, SlabAllocator *Slab) {
+    if (Slab) {
+      IRData = Slab->Allocate(DataSize);
+      InSlab = true;
+    }
+    else {
+      IRData = malloc(DataSize);
+    }
+    memcpy(IRData, Data, DataSize);
+  }
 };
 }
 
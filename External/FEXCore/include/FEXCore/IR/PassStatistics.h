@@ -0,0 +1,19 @@
+#pragma once
+#include <stdint.h>
+#include <string>
+
+namespace FEXCore::IR {
+  /**
+   * @brief Counters for a single pass in the pass pipeline
+   *
+   * Aggregated over every block compiled since the statistics were last reset
+   */
+  struct PassStatistics {
+    std::string Name;
+    uint64_t Runs;          ///< Number of times the pass was run
+    uint64_t TimesChanged;  ///< Number of runs that reported changing the IR
+    uint64_t TimeNS;        ///< Wall time spent inside the pass
+    int64_t NodesRemoved;   ///< Number of nodes removed, negative if the pass added nodes
+    uint64_t BlocksChanged; ///< Number of code blocks that were modified, added or removed
+  };
+}
@@ -12,6 +12,7 @@ namespace FEX::ArgLoader {
     optparse::OptionGroup CPUGroup(Parser, "CPU Core options");
     optparse::OptionGroup EmulationGroup(Parser, "Emulation options");
     optparse::OptionGroup TestGroup(Parser, "Test Harness options");
+    optparse::OptionGroup OptGroup(Parser, "IR optimizer options");
 
     {
       CPUGroup.add_option("-c", "--core")
@@ -55,6 +56,44 @@ namespace FEX::ArgLoader {
         .dest("GdbServer")
         .action("store_true")
         .help("Enables the GDB server");
+      CPUGroup.add_option("-O", "--opt-level")
+        .dest("OptLevel")
+        .help("IR optimization level")
+        .choices({"0", "1", "2"})
+        .set_default("2");
+      CPUGroup.add_option("--passes")
+        .dest("PassPipeline")
+        .help("Comma separated list of IR passes to run. Overrides the optimization level");
+      CPUGroup.add_option("--pass-iterations")
+        .dest("PassIterations")
+        .help("Maximum number of times to run the cleanup passes")
+        .set_default(1);
+      CPUGroup.add_option("--pass-stats")
+        .dest("PassStats")
+        .action("store_true")
+        .help("Print IR pass statistics on exit");
+      CPUGroup.add_option("--register-allocator")
+        .dest("RegisterAllocator")
+        .help("Register allocator for the JITs. auto uses linear scan below -O2")
+        .choices({"auto", "graph", "linear"})
+        .set_default("auto");
+      CPUGroup.add_option("--host-features")
+        .dest("HostFeatures")
+        .help("Host instruction set extensions the JITs may use. baseline disables the optional code paths")
+        .choices({"auto", "baseline"})
+        .set_default("auto");
+      CPUGroup.add_option("--jit-wx")
+        .dest("JITWX")
+        .action("store_true")
+        .help("Map JIT code memory twice so it is never writable and executable at the same address");
+      CPUGroup.add_option("--x87-reduced-precision")
+        .dest("X87ReducedPrecision")
+        .action("store_true")
+        .help("Run x87 math on host doubles. Faster, but results lose the 80bit precision");
+      CPUGroup.add_option("--jit-symbols")
+        .dest("JITSymbols")
+        .action("store_true")
+        .help("Write /tmp/jit-<pid>.dump for perf inject --jit, maps JIT code back to guest symbols and instructions");
 
       Parser.add_option_group(CPUGroup);
     }
@@ -70,6 +109,20 @@ namespace FEX::ArgLoader {
         .action("store_true")
         .help("Enable unified memory for the emulator");
 
+      EmulationGroup.add_option("--serialize-ir")
+        .dest("IRSerializePath")
+        .help("Directory to write the unoptimized IR of every compiled block to");
+
+      EmulationGroup.add_option("--retain-ir")
+        .dest("RetainIR")
+        .action("store_true")
+        .help("Keep the IR of compiled blocks around even if the core doesn't need it");
+
+      EmulationGroup.add_option("--ir-cache-size")
+        .dest("IRCacheSize")
+        .help("Megabytes of retained IR per thread before the least recently used blocks are evicted. 0 is unlimited")
+        .set_default(64);
+
       Parser.add_option_group(EmulationGroup);
     }
     {
@@ -98,6 +151,32 @@ namespace FEX::ArgLoader {
 
       Parser.add_option_group(TestGroup);
     }
+    {
+      OptGroup.add_option("--print-before")
+        .dest("PrintBefore")
+        .action("store_true")
+        .help("Print the IR before running the passes")
+        .set_default(false);
+
+      OptGroup.add_option("--print-after")
+        .dest("PrintAfter")
+        .action("store_true")
+        .help("Print the IR after running the passes")
+        .set_default(false);
+
+      OptGroup.add_option("--compile")
+        .dest("Compile")
+        .action("store_true")
+        .help("Compile the optimized IR with the selected core")
+        .set_default(false);
+
+      OptGroup.add_option("--repeat")
+        .dest("Repeat")
+        .help("Number of times to run the passes over each block, for benchmarking")
+        .set_default(1);
+
+      Parser.add_option_group(OptGroup);
+    }
     optparse::Values Options = Parser.parse_args(argc, argv);
 
     {
@@ -143,6 +222,24 @@ namespace FEX::ArgLoader {
         bool GdbServer = Options.get("GdbServer");
         Config::Add("GdbServer", std::to_string(GdbServer));
       }
+
+      if (Options.is_set_by_user("RegisterAllocator")) {
+        auto RegisterAllocator = Options["RegisterAllocator"];
+        if (RegisterAllocator == "auto")
+          Config::Add("RegisterAllocator", "0");
+        else if (RegisterAllocator == "graph")
+          Config::Add("RegisterAllocator", "1");
+        else if (RegisterAllocator == "linear")
+          Config::Add("RegisterAllocator", "2");
+      }
+
+      if (Options.is_set_by_user("HostFeatures")) {
+        auto HostFeatures = Options["HostFeatures"];
+        if (HostFeatures == "auto")
+          Config::Add("HostFeatures", "0");
+        else if (HostFeatures == "baseline")
+          Config::Add("HostFeatures", "1");
+      }
     }
 
     {
@@ -177,6 +274,23 @@ namespace FEX::ArgLoader {
         Config::Add("IPCID", Value);
       }
     }
+
+    {
+      // Options that go in to the config exactly as they were passed
+      // store_true options come through as "1"
+      const char *PassThroughOptions[] = {
+        "OptLevel", "PassPipeline", "PassIterations", "PassStats",
+        "JITWX", "X87ReducedPrecision", "JITSymbols",
+        "IRSerializePath", "RetainIR", "IRCacheSize",
+        "PrintBefore", "PrintAfter", "Compile", "Repeat",
+      };
+
+      for (auto Option : PassThroughOptions) {
+        if (Options.is_set_by_user(Option)) {
+          Config::Add(Option, Options[Option]);
+        }
+      }
+    }
     RemainingArgs = Parser.args();
     ProgramArguments = Parser.parsed_args();
   }
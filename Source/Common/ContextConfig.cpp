@@ -0,0 +1,36 @@
+#include "Common/Config.h"
+#include "Common/ContextConfig.h"
+
+#include <FEXCore/Config/Config.h>
+
+#include <string>
+
+namespace FEX::Config {
+  void SetContextOptions(FEXCore::Context::Context *CTX) {
+    Value<uint8_t> OptLevelConfig{"OptLevel", 2};
+    Value<std::string> PassPipelineConfig{"PassPipeline", ""};
+    Value<uint32_t> PassIterationsConfig{"PassIterations", 1};
+    Value<bool> PassStatsConfig{"PassStats", false};
+    Value<uint8_t> RegisterAllocatorConfig{"RegisterAllocator", 0};
+    Value<uint8_t> HostFeaturesConfig{"HostFeatures", 0};
+    Value<bool> JITWXConfig{"JITWX", false};
+    Value<bool> X87ReducedPrecisionConfig{"X87ReducedPrecision", false};
+    Value<bool> JITSymbolsConfig{"JITSymbols", false};
+    Value<std::string> IRSerializePathConfig{"IRSerializePath", ""};
+    Value<bool> RetainIRConfig{"RetainIR", false};
+    Value<uint64_t> IRCacheSizeConfig{"IRCacheSize", 64};
+
+    FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_OPTIMIZATION_LEVEL, OptLevelConfig());
+    FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_PASS_PIPELINE, PassPipelineConfig());
+    FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_PASS_FIXEDPOINT_ITERATIONS, PassIterationsConfig());
+    FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_PASS_STATISTICS, PassStatsConfig());
+    FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_REGISTER_ALLOCATOR, RegisterAllocatorConfig());
+    FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_HOST_FEATURES, HostFeaturesConfig());
+    FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_JIT_WX, JITWXConfig());
+    FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_X87_REDUCED_PRECISION, X87ReducedPrecisionConfig());
+    FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_JIT_SYMBOLS, JITSymbolsConfig());
+    FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_IR_SERIALIZE_PATH, IRSerializePathConfig());
+    FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_IR_CACHE_RETAIN, RetainIRConfig());
+    FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_IR_CACHE_SIZE, IRCacheSizeConfig() * 1024 * 1024);
+  }
+}
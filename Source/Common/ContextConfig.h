@@ -0,0 +1,15 @@
+#pragma once
+
+namespace FEXCore::Context {
+  struct Context;
+}
+
+namespace FEX::Config {
+  /**
+   * @brief Hands the options every frontend shares over to a context
+   *
+   * These are the IR pass, register allocation, code generation and IR cache options.
+   * Options that depend on how the guest gets loaded stay with the frontend.
+   */
+  void SetContextOptions(FEXCore::Context::Context *CTX);
+}
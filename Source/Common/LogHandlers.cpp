@@ -0,0 +1,41 @@
+#include "Common/LogHandlers.h"
+#include "LogManager.h"
+
+#include <cstdio>
+
+namespace FEX::LogHandlers {
+  void MsgHandler(LogMan::DebugLevels Level, char const *Message) {
+    const char *CharLevel{nullptr};
+
+    switch (Level) {
+    case LogMan::NONE:
+      CharLevel = "NONE";
+      break;
+    case LogMan::ASSERT:
+      CharLevel = "ASSERT";
+      break;
+    case LogMan::ERROR:
+      CharLevel = "ERROR";
+      break;
+    case LogMan::DEBUG:
+      CharLevel = "DEBUG";
+      break;
+    case LogMan::INFO:
+      CharLevel = "Info";
+      break;
+    default:
+      CharLevel = "???";
+      break;
+    }
+    printf("[%s] %s\n", CharLevel, Message);
+  }
+
+  void AssertHandler(char const *Message) {
+    printf("[ASSERT] %s\n", Message);
+  }
+
+  void Install() {
+    LogMan::Throw::InstallHandler(AssertHandler);
+    LogMan::Msg::InstallHandler(MsgHandler);
+  }
+}
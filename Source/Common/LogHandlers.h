@@ -0,0 +1,8 @@
+#pragma once
+
+namespace FEX::LogHandlers {
+  /**
+   * @brief Installs the message and assert handlers that print to stdout
+   */
+  void Install();
+}
@@ -1,6 +1,7 @@
 #include "Common/ArgumentLoader.h"
 #include "CommonCore/VMFactory.h"
 #include "Common/Config.h"
+#include "Common/ContextConfig.h"
 #include "ELFLoader.h"
 #include "HarnessHelpers.h"
 #include "LogManager.h"
@@ -8,6 +9,7 @@
 #include <FEXCore/Config/Config.h>
 #include <FEXCore/Core/CodeLoader.h>
 #include <FEXCore/Core/Context.h>
+#include <FEXCore/Debug/ContextDebug.h>
 #include <FEXCore/Memory/SharedMem.h>
 
 #include <cstdint>
@@ -92,6 +94,7 @@ int main(int argc, char **argv, char **const envp) {
   FEX::Config::Value<bool> GdbServerConfig{"GdbServer", false};
   FEX::Config::Value<bool> UnifiedMemory{"UnifiedMemory", false};
   FEX::Config::Value<std::string> LDPath{"RootFS", ""};
+  FEX::Config::Value<bool> PassStatsConfig{"PassStats", false};
 
   auto Args = FEX::ArgLoader::Get();
   auto ParsedArgs = FEX::ArgLoader::GetParsedArgs();
@@ -113,6 +116,7 @@ int main(int argc, char **argv, char **const envp) {
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_GDBSERVER, GdbServerConfig());
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_ROOTFSPATH, LDPath());
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_UNIFIED_MEMORY, UnifiedMemory());
+  FEX::Config::SetContextOptions(CTX);
   FEXCore::Context::SetCustomCPUBackendFactory(CTX, VMFactory::CPUCreationFactory);
   // FEXCore::Context::SetFallbackCPUBackendFactory(CTX, VMFactory::CPUCreationFactoryFallback);
 
@@ -137,6 +141,15 @@ int main(int argc, char **argv, char **const envp) {
   LogMan::Msg::D("Reason we left VM: %d", ShutdownReason);
   bool Result = ShutdownReason == 0;
 
+  if (PassStatsConfig()) {
+    std::vector<FEXCore::IR::PassStatistics> Stats;
+    FEXCore::Context::Debug::GetPassStatistics(CTX, &Stats);
+    printf("%-32s %10s %10s %14s %14s %14s\n", "Pass", "Runs", "Changed", "Time(us)", "NodesRemoved", "BlocksChanged");
+    for (auto &Stat : Stats) {
+      printf("%-32s %10ld %10ld %14ld %14ld %14ld\n", Stat.Name.c_str(), Stat.Runs, Stat.TimesChanged, Stat.TimeNS / 1000, Stat.NodesRemoved, Stat.BlocksChanged);
+    }
+  }
+
   FEXCore::Context::DestroyContext(CTX);
   FEXCore::SHM::DestroyRegion(SHM);
 
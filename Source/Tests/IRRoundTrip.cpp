@@ -0,0 +1,84 @@
+#include "Common/LogHandlers.h"
+#include "LogManager.h"
+
+#include <FEXCore/IR/IR.h>
+#include <FEXCore/IR/IntrusiveIRList.h>
+
+#include <fstream>
+#include <memory>
+#include <sstream>
+#include <string>
+
+/**
+ * @brief Checks that IR text and serialized IR load back to the same IR
+ *
+ * The IR text file gets parsed and dumped, then that dump gets parsed and dumped again. Both dumps need to match.
+ * The parsed IR also goes through Serialize and Deserialize, dumping that needs to match as well.
+ */
+namespace {
+  std::string DumpIR(FEXCore::IR::IRListView<true> const *IR) {
+    std::stringstream out;
+    FEXCore::IR::IRListView<false> View(reinterpret_cast<void*>(IR->GetData()), IR->GetDataSize());
+    FEXCore::IR::Dump(&out, &View);
+    return out.str();
+  }
+
+  bool Compare(char const *What, std::string const &Expected, std::string const &Result) {
+    if (Expected == Result) {
+      return true;
+    }
+
+    LogMan::Msg::E("%s doesn't match", What);
+    LogMan::Msg::E("Expected:\n%s", Expected.c_str());
+    LogMan::Msg::E("Got:\n%s", Result.c_str());
+    return false;
+  }
+}
+
+int main(int argc, char **argv) {
+  FEX::LogHandlers::Install();
+
+  if (argc != 2) {
+    LogMan::Msg::E("Usage: %s <IR text file>", argv[0]);
+    return -1;
+  }
+
+  std::ifstream Input(argv[1], std::ios::in);
+  if (!Input.is_open()) {
+    LogMan::Msg::E("Couldn't open '%s'", argv[1]);
+    return -1;
+  }
+
+  std::unique_ptr<FEXCore::IR::IRListView<true>> Parsed {FEXCore::IR::Parse(&Input)};
+  if (!Parsed) {
+    LogMan::Msg::E("Couldn't parse '%s'", argv[1]);
+    return -1;
+  }
+
+  std::string Text = DumpIR(Parsed.get());
+
+  // Dump -> Parse -> Dump
+  std::istringstream TextInput(Text);
+  std::unique_ptr<FEXCore::IR::IRListView<true>> Reparsed {FEXCore::IR::Parse(&TextInput)};
+  if (!Reparsed) {
+    LogMan::Msg::E("Couldn't parse the dump of '%s':\n%s", argv[1], Text.c_str());
+    return -1;
+  }
+
+  // Serialize -> Deserialize -> Dump
+  std::stringstream Binary;
+  FEXCore::IR::IRListView<false> View(reinterpret_cast<void*>(Parsed->GetData()), Parsed->GetDataSize());
+  FEXCore::IR::Serialize(&Binary, &View);
+  std::unique_ptr<FEXCore::IR::IRListView<true>> Deserialized {FEXCore::IR::Deserialize(&Binary)};
+  if (!Deserialized) {
+    LogMan::Msg::E("Couldn't deserialize '%s'", argv[1]);
+    return -1;
+  }
+
+  bool Result = true;
+  Result &= Compare("Text round trip", Text, DumpIR(Reparsed.get()));
+  Result &= Compare("Binary round trip", Text, DumpIR(Deserialized.get()));
+
+  LogMan::Msg::I("Passed? %s", Result ? "Yes" : "No");
+  return Result ? 0 : -1;
+}
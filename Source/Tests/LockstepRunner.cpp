@@ -1,5 +1,6 @@
 #include "Common/ArgumentLoader.h"
 #include "Common/Config.h"
+#include "Common/LogHandlers.h"
 #include "CommonCore/VMFactory.h"
 #include "HarnessHelpers.h"
 #include "LogManager.h"
@@ -24,36 +25,6 @@
 #include <boost/interprocess/ipc/message_queue.hpp>
 #include <boost/thread/thread_time.hpp>
 
-void MsgHandler(LogMan::DebugLevels Level, char const *Message) {
-  const char *CharLevel{nullptr};
-
-  switch (Level) {
-  case LogMan::NONE:
-    CharLevel = "NONE";
-    break;
-  case LogMan::ASSERT:
-    CharLevel = "ASSERT";
-    break;
-  case LogMan::ERROR:
-    CharLevel = "ERROR";
-    break;
-  case LogMan::DEBUG:
-    CharLevel = "DEBUG";
-    break;
-  case LogMan::INFO:
-    CharLevel = "Info";
-    break;
-  default:
-    CharLevel = "???";
-    break;
-  }
-  printf("[%s] %s\n", CharLevel, Message);
-}
-
-void AssertHandler(char const *Message) {
-  printf("[ASSERT] %s\n", Message);
-}
-
 class Flag final {
 public:
   bool TestAndSet(bool SetValue = true) {
@@ -507,8 +478,7 @@ private:
 };
 
 int main(int argc, char **argv) {
-  LogMan::Throw::InstallHandler(AssertHandler);
-  LogMan::Msg::InstallHandler(MsgHandler);
+  FEX::LogHandlers::Install();
   FEX::Config::Init();
   FEX::ArgLoader::Load(argc, argv);
 
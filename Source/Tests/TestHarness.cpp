@@ -1,4 +1,5 @@
 #include "Common/ArgumentLoader.h"
+#include "Common/LogHandlers.h"
 #include "CommonCore/VMFactory.h"
 #include "HarnessHelpers.h"
 #include "LogManager.h"
@@ -18,39 +19,8 @@
 #include <string>
 #include <vector>
 
-void MsgHandler(LogMan::DebugLevels Level, char const *Message) {
-  const char *CharLevel{nullptr};
-
-  switch (Level) {
-  case LogMan::NONE:
-    CharLevel = "NONE";
-    break;
-  case LogMan::ASSERT:
-    CharLevel = "ASSERT";
-    break;
-  case LogMan::ERROR:
-    CharLevel = "ERROR";
-    break;
-  case LogMan::DEBUG:
-    CharLevel = "DEBUG";
-    break;
-  case LogMan::INFO:
-    CharLevel = "Info";
-    break;
-  default:
-    CharLevel = "???";
-    break;
-  }
-  printf("[%s] %s\n", CharLevel, Message);
-}
-
-void AssertHandler(char const *Message) {
-  printf("[ASSERT] %s\n", Message);
-}
-
 int main(int argc, char **argv) {
-  LogMan::Throw::InstallHandler(AssertHandler);
-  LogMan::Msg::InstallHandler(MsgHandler);
+  FEX::LogHandlers::Install();
 
   FEX::ArgLoader::Load(argc, argv);
 
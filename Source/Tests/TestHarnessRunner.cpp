@@ -1,4 +1,6 @@
 #include "Common/ArgumentLoader.h"
+#include "Common/ContextConfig.h"
+#include "Common/LogHandlers.h"
 #include "CommonCore/VMFactory.h"
 #include "HarnessHelpers.h"
 #include "LogManager.h"
@@ -18,39 +20,8 @@
 #include <string>
 #include <vector>
 
-void MsgHandler(LogMan::DebugLevels Level, char const *Message) {
-  const char *CharLevel{nullptr};
-
-  switch (Level) {
-  case LogMan::NONE:
-    CharLevel = "NONE";
-    break;
-  case LogMan::ASSERT:
-    CharLevel = "ASSERT";
-    break;
-  case LogMan::ERROR:
-    CharLevel = "ERROR";
-    break;
-  case LogMan::DEBUG:
-    CharLevel = "DEBUG";
-    break;
-  case LogMan::INFO:
-    CharLevel = "Info";
-    break;
-  default:
-    CharLevel = "???";
-    break;
-  }
-  printf("[%s] %s\n", CharLevel, Message);
-}
-
-void AssertHandler(char const *Message) {
-  printf("[ASSERT] %s\n", Message);
-}
-
 int main(int argc, char **argv) {
-  LogMan::Throw::InstallHandler(AssertHandler);
-  LogMan::Msg::InstallHandler(MsgHandler);
+  FEX::LogHandlers::Install();
   FEX::Config::Init();
   FEX::ArgLoader::Load(argc, argv);
 
@@ -72,6 +43,7 @@ int main(int argc, char **argv) {
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_MULTIBLOCK, MultiblockConfig());
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_SINGLESTEP, SingleStepConfig());
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_MAXBLOCKINST, BlockSizeConfig());
+  FEX::Config::SetContextOptions(CTX);
   FEXCore::Context::SetCustomCPUBackendFactory(CTX, VMFactory::CPUCreationFactory);
 
   FEXCore::Context::AddGuestMemoryRegion(CTX, SHM);
@@ -1,5 +1,6 @@
 #include "Common/ArgumentLoader.h"
 #include "Common/Config.h"
+#include "Common/LogHandlers.h"
 #include "ELFLoader.h"
 #include "HarnessHelpers.h"
 #include "LogManager.h"
@@ -61,39 +62,8 @@ uint8_t data[] = {
   };
 }
 
-void MsgHandler(LogMan::DebugLevels Level, char const *Message) {
-  const char *CharLevel{nullptr};
-
-  switch (Level) {
-  case LogMan::NONE:
-    CharLevel = "NONE";
-    break;
-  case LogMan::ASSERT:
-    CharLevel = "ASSERT";
-    break;
-  case LogMan::ERROR:
-    CharLevel = "ERROR";
-    break;
-  case LogMan::DEBUG:
-    CharLevel = "DEBUG";
-    break;
-  case LogMan::INFO:
-    CharLevel = "Info";
-    break;
-  default:
-    CharLevel = "???";
-    break;
-  }
-  printf("[%s] %s\n", CharLevel, Message);
-}
-
-void AssertHandler(char const *Message) {
-  printf("[ASSERT] %s\n", Message);
-}
-
 int main(int argc, char **argv) {
-  LogMan::Throw::InstallHandler(AssertHandler);
-  LogMan::Msg::InstallHandler(MsgHandler);
+  FEX::LogHandlers::Install();
   FEX::Config::Init();
   FEX::ArgLoader::Load(argc, argv);
 
@@ -1,5 +1,6 @@
 #include "Common/ArgumentLoader.h"
 #include "Common/Config.h"
+#include "Common/LogHandlers.h"
 
 #include "LogManager.h"
 #include <cstdio>
@@ -20,36 +21,6 @@ constexpr std::array<std::pair<int64_t, int64_t>, 1> Disp32Ranges = {{
 
 int DumpThreshhold = (1 << 15);
 
-void MsgHandler(LogMan::DebugLevels Level, char const *Message) {
-  const char *CharLevel{nullptr};
-
-  switch (Level) {
-  case LogMan::NONE:
-    CharLevel = "NONE";
-    break;
-  case LogMan::ASSERT:
-    CharLevel = "ASSERT";
-    break;
-  case LogMan::ERROR:
-    CharLevel = "ERROR";
-    break;
-  case LogMan::DEBUG:
-    CharLevel = "DEBUG";
-    break;
-  case LogMan::INFO:
-    CharLevel = "Info";
-    break;
-  default:
-    CharLevel = "???";
-    break;
-  }
-  printf("[%s] %s\n", CharLevel, Message);
-}
-
-void AssertHandler(char const *Message) {
-  printf("[ASSERT] %s\n", Message);
-}
-
 uint32_t GetModRMMapping(uint32_t Register) {
   switch (Register) {
   case FEXCore::X86State::REG_RCX: Register = 0b001; break;
@@ -2386,8 +2357,7 @@ void GenerateSSEInstructions() {
 }
 
 int main(int argc, char **argv) {
-  LogMan::Throw::InstallHandler(AssertHandler);
-  LogMan::Msg::InstallHandler(MsgHandler);
+  FEX::LogHandlers::Install();
 
   FEX::Config::Init();
   FEX::ArgLoader::Load(argc, argv);
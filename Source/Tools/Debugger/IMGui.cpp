@@ -677,20 +677,24 @@ namespace IR {
     FEXCore::Core::InternalThreadState *TS = reinterpret_cast<FEXCore::Core::InternalThreadState*>(State);
 
     auto &IRList = TS->IRLists;
-    auto &DebugData = TS->DebugData;
 
     for (auto &IR : IRList) {
        std::ostringstream out;
        out << "0x" << std::hex << IR.first;
-       auto Data = DebugData.find(IR.first);
+       auto &Data = IR.second.DebugData;
        IRDebugData DebugData;
-       DebugData.Debug = &Data->second;
+       DebugData.Debug = &Data;
        DebugData.RIP = IR.first;
        DebugData.RIPString = out.str();
-       DebugData.GuestCodeSize = std::to_string(Data->second.GuestCodeSize);
-       DebugData.GuestInstructionCount = std::to_string(Data->second.GuestInstructionCount);
+       DebugData.GuestCodeSize = std::to_string(Data.GuestCodeSize);
+       DebugData.GuestInstructionCount = std::to_string(Data.GuestInstructionCount);
        IRListTexts.emplace_back(DebugData);
     }
+
+    // The IR cache is unordered
+    std::sort(IRListTexts.begin(), IRListTexts.end(), [](IRDebugData const &a, IRDebugData const &b) {
+      return a.RIP < b.RIP;
+    });
   }
 }
 
@@ -3,6 +3,11 @@
 namespace FEX::Debugger::IR {
 class Lexer {
 public:
+  /**
+   * @brief Checks that IR text can be parsed back in to IR
+   *
+   * @return true if the text was valid IR
+   */
   bool Lex(char const *IR);
 
 private:
@@ -48,6 +48,8 @@ void CreateCoreCallback(char const *Filename, bool ELF) {
   FEXCore::Context::AddGuestMemoryRegion(CTX, SHM);
 
   FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_DEFAULTCORE, FEX::DebuggerState::GetCoreType());
+  // The IR list window shows the IR of every compiled block
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_IR_CACHE_RETAIN, 1);
   FEXCore::Context::SetFallbackCPUBackendFactory(CTX, VMFactory::CPUCreationFactoryFallback);
 
   FEXCore::Context::InitializeContext(CTX);
@@ -1,11 +1,195 @@
 #include "Common/ArgumentLoader.h"
 #include "Common/Config.h"
+#include "Common/ContextConfig.h"
+#include "Common/LogHandlers.h"
+#include "LogManager.h"
 
+#include <FEXCore/Config/Config.h>
+#include <FEXCore/Core/Context.h>
+#include <FEXCore/Debug/ContextDebug.h>
+#include <FEXCore/IR/IR.h>
 #include <FEXCore/IR/IntrusiveIRList.h>
+#include <FEXCore/Memory/SharedMem.h>
+
+#include <algorithm>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Runs the IR pass pipeline over serialized IR without a guest
+ *
+ * .fexir files are written by running a guest with --serialize-ir, every file can contain more than one block.
+ * Any other file is parsed as IR text in the form that the IR dumps use, one block per file.
+ */
+namespace {
+  struct LoadedBlock {
+    std::string Source;
+    std::unique_ptr<FEXCore::IR::IRListView<true>> IR;
+  };
+
+  FEXCore::IR::IRListView<false> View(FEXCore::IR::IRListView<true> const *IR) {
+    return FEXCore::IR::IRListView<false>(reinterpret_cast<void*>(IR->GetData()), IR->GetDataSize());
+  }
+
+  // Nodes that are still linked in to a block, removed nodes still take up space in the list
+  uint64_t CountNodes(FEXCore::IR::IRListView<true> const *IR) {
+    using namespace FEXCore::IR;
+    uintptr_t ListBegin = IR->GetListData();
+    uintptr_t DataBegin = IR->GetData();
+    uint64_t Count = 0;
+
+    auto HeaderOp = IR->begin()()->GetNode(ListBegin)->Op(DataBegin)->C<IROp_IRHeader>();
+    OrderedNode const *BlockNode = HeaderOp->Blocks.GetNode(ListBegin);
+
+    while (1) {
+      auto BlockIROp = BlockNode->Op(DataBegin)->C<IROp_CodeBlock>();
+      auto CodeBegin = IR->at(BlockIROp->Begin);
+      auto CodeLast = IR->at(BlockIROp->Last);
+
+      while (1) {
+        ++Count;
+        // CodeLast is inclusive. So we still need to count the CodeLast op as well
+        if (CodeBegin == CodeLast) {
+          break;
+        }
+        ++CodeBegin;
+      }
+
+      if (BlockIROp->Next.ID() == 0) {
+        break;
+      } else {
+        BlockNode = BlockIROp->Next.GetNode(ListBegin);
+      }
+    }
+
+    return Count;
+  }
+
+  void PrintIR(char const *Title, std::string const &Source, FEXCore::IR::IRListView<true> const *IR) {
+    std::stringstream out;
+    auto IRView = View(IR);
+    FEXCore::IR::Dump(&out, &IRView);
+    printf("%s %s:\n%s\n@@@@@\n", Title, Source.c_str(), out.str().c_str());
+  }
+}
 
 int main(int argc, char **argv) {
+  FEX::LogHandlers::Install();
+
   FEX::Config::Init();
   FEX::ArgLoader::Load(argc, argv);
 
+  FEX::Config::Value<uint8_t> CoreConfig{"Core", 0};
+  FEX::Config::Value<bool> PassStatsConfig{"PassStats", false};
+  FEX::Config::Value<bool> PrintBeforeConfig{"PrintBefore", false};
+  FEX::Config::Value<bool> PrintAfterConfig{"PrintAfter", false};
+  FEX::Config::Value<bool> CompileConfig{"Compile", false};
+  FEX::Config::Value<uint32_t> RepeatConfig{"Repeat", 1};
+
+  auto Args = FEX::ArgLoader::Get();
+  LogMan::Throw::A(!Args.empty(), "Not enough arguments");
+  LogMan::Throw::A(CoreConfig() <= FEXCore::Config::CONFIG_LLVMJIT, "Only the interpreter, IR JIT and LLVM JIT cores can compile offline");
+
+  std::vector<LoadedBlock> Blocks;
+  for (auto &Filename : Args) {
+    std::ifstream Input(Filename, std::ios::in | std::ios::binary);
+    if (!Input.is_open()) {
+      LogMan::Msg::E("Couldn't open '%s'", Filename.c_str());
+      return -1;
+    }
+
+    if (Filename.size() < 6 || Filename.compare(Filename.size() - 6, 6, ".fexir") != 0) {
+      auto IR = FEXCore::IR::Parse(&Input);
+      if (!IR) {
+        LogMan::Msg::E("Couldn't parse '%s'", Filename.c_str());
+        return -1;
+      }
+
+      Blocks.emplace_back(LoadedBlock{Filename, std::unique_ptr<FEXCore::IR::IRListView<true>>(IR)});
+      continue;
+    }
+
+    size_t Index = 0;
+    while (Input.peek() != std::char_traits<char>::eof()) {
+      auto IR = FEXCore::IR::Deserialize(&Input);
+      if (!IR) {
+        LogMan::Msg::E("Couldn't load block %ld of '%s'", Index, Filename.c_str());
+        return -1;
+      }
+
+      Blocks.emplace_back(LoadedBlock{Filename + "[" + std::to_string(Index) + "]", std::unique_ptr<FEXCore::IR::IRListView<true>>(IR)});
+      ++Index;
+    }
+  }
+
+  FEXCore::Context::InitializeStaticTables();
+  auto SHM = FEXCore::SHM::AllocateSHMRegion(1ULL << 36);
+  auto CTX = FEXCore::Context::CreateNewContext();
+  FEXCore::Context::InitializeContext(CTX);
+
+  FEXCore::Config::SetConfig(CTX, FEXCore::Config::CONFIG_DEFAULTCORE, CoreConfig());
+  FEX::Config::SetContextOptions(CTX);
+  FEXCore::Context::AddGuestMemoryRegion(CTX, SHM);
+
+  uint64_t TotalNodesBefore{}, TotalNodesAfter{};
+  uint64_t TotalPassTime{}, TotalCompileTime{}, TotalCodeSize{}, TotalSpills{};
+  bool Result = true;
+
+  printf("%-40s %10s %10s %14s %14s %12s %8s\n", "Block", "Nodes", "Optimized", "Passes(us)", "Compile(us)", "HostSize", "Spills");
+  for (auto &Block : Blocks) {
+    if (PrintBeforeConfig()) {
+      PrintIR("Before", Block.Source, Block.IR.get());
+    }
+
+    uint64_t PassTime{}, CompileTime{};
+    FEXCore::Context::Debug::IRCompileResult Compiled{};
+    for (uint32_t i = 0; i < std::max(RepeatConfig(), 1U); ++i) {
+      delete Compiled.IR;
+      if (!FEXCore::Context::Debug::OptimizeIR(CTX, Block.IR.get(), CompileConfig(), &Compiled)) {
+        LogMan::Msg::E("Backend failed to compile %s", Block.Source.c_str());
+        Result = false;
+      }
+      PassTime += Compiled.PassTimeNS;
+      CompileTime += Compiled.CompileTimeNS;
+    }
+
+    std::unique_ptr<FEXCore::IR::IRListView<true>> Optimized {Compiled.IR};
+
+    uint64_t NodesBefore = CountNodes(Block.IR.get());
+    uint64_t NodesAfter = CountNodes(Optimized.get());
+    PassTime /= std::max(RepeatConfig(), 1U);
+    CompileTime /= std::max(RepeatConfig(), 1U);
+
+    printf("%-40s %10ld %10ld %14ld %14ld %12ld %8d\n", Block.Source.c_str(), NodesBefore, NodesAfter, PassTime / 1000, CompileTime / 1000, Compiled.HostCodeSize, Compiled.SpillSlots);
+
+    TotalNodesBefore += NodesBefore;
+    TotalNodesAfter += NodesAfter;
+    TotalPassTime += PassTime;
+    TotalCompileTime += CompileTime;
+    TotalCodeSize += Compiled.HostCodeSize;
+    TotalSpills += Compiled.SpillSlots;
+
+    if (PrintAfterConfig()) {
+      PrintIR("After", Block.Source, Optimized.get());
+    }
+  }
+
+  printf("%-40s %10ld %10ld %14ld %14ld %12ld %8ld\n", "Total", TotalNodesBefore, TotalNodesAfter, TotalPassTime / 1000, TotalCompileTime / 1000, TotalCodeSize, TotalSpills);
+
+  if (PassStatsConfig()) {
+    std::vector<FEXCore::IR::PassStatistics> Stats;
+    FEXCore::Context::Debug::GetPassStatistics(CTX, &Stats);
+    printf("%-32s %10s %10s %14s %14s %14s\n", "Pass", "Runs", "Changed", "Time(us)", "NodesRemoved", "BlocksChanged");
+    for (auto &Stat : Stats) {
+      printf("%-32s %10ld %10ld %14ld %14ld %14ld\n", Stat.Name.c_str(), Stat.Runs, Stat.TimesChanged, Stat.TimeNS / 1000, Stat.NodesRemoved, Stat.BlocksChanged);
+    }
+  }
+
+  FEXCore::Context::DestroyContext(CTX);
+  FEXCore::SHM::DestroyRegion(SHM);
+
   FEX::Config::Shutdown();
+  return Result ? 0 : -1;
 }
@@ -0,0 +1,85 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "R8":  "0x7090B1C0D1E4720",
+    "R9":  "0x131517191B1D1F30",
+    "R10": "0x27292B3C2D3E6740",
+    "R11": "0x333537393B3D3F50",
+    "R12": "0x17030713",
+    "R13": "0x86868686"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov r15, 0xe0000000
+
+mov rax, 0x4142434445464748
+mov [r15 + 8 * 0], rax
+mov rax, 0x5152535455565758
+mov [r15 + 8 * 1], rax
+mov rax, 0x6162636465666768
+mov [r15 + 8 * 2], rax
+mov rax, 0x7172737475767778
+mov [r15 + 8 * 3], rax
+mov qword [r15 + 8 * 4], 0
+mov qword [r15 + 8 * 5], 0
+
+mov rbx, 0xC1C2C3C4C5C6C7D8
+
+; Flags of the locked op are read, the previous value stays live
+lock add byte [r15 + 8 * 0], bl
+lahf
+movzx ecx, ah
+mov [r15 + 8 * 4 + 0], cl
+
+lock add word [r15 + 8 * 0 + 2], bx
+lahf
+movzx ecx, ah
+mov [r15 + 8 * 4 + 1], cl
+
+lock add dword [r15 + 8 * 0 + 4], ebx
+lahf
+movzx ecx, ah
+mov [r15 + 8 * 4 + 2], cl
+
+lock add qword [r15 + 8 * 1], rbx
+lahf
+movzx ecx, ah
+mov [r15 + 8 * 4 + 3], cl
+
+; Every flag is overwritten before anything reads it, the previous value is dead
+lock add byte [r15 + 8 * 2], bl
+test rbx, rbx
+lahf
+movzx ecx, ah
+mov [r15 + 8 * 5 + 0], cl
+
+lock add word [r15 + 8 * 2 + 2], bx
+test rbx, rbx
+lahf
+movzx ecx, ah
+mov [r15 + 8 * 5 + 1], cl
+
+lock add dword [r15 + 8 * 2 + 4], ebx
+test rbx, rbx
+lahf
+movzx ecx, ah
+mov [r15 + 8 * 5 + 2], cl
+
+lock add qword [r15 + 8 * 3], rbx
+test rbx, rbx
+lahf
+movzx ecx, ah
+mov [r15 + 8 * 5 + 3], cl
+
+mov r8, [r15 + 8 * 0]
+mov r9, [r15 + 8 * 1]
+mov r10, [r15 + 8 * 2]
+mov r11, [r15 + 8 * 3]
+mov r12, [r15 + 8 * 4]
+mov r13, [r15 + 8 * 5]
+
+hlt
@@ -0,0 +1,89 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "R8":  "0xC5C6C7DCC7DE47D8",
+    "R9":  "0xD1D2D3D4D5D6D7D8",
+    "R10": "0xE5E6E7FCE7FE67F8",
+    "R11": "0xF1F2F3F4F5F6F7F8",
+    "R12": "0x86828686",
+    "R13": "0x86868686"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov r15, 0xe0000000
+
+mov rax, 0x4142434445464748
+mov [r15 + 8 * 0], rax
+mov rax, 0x5152535455565758
+mov [r15 + 8 * 1], rax
+mov rax, 0x6162636465666768
+mov [r15 + 8 * 2], rax
+mov rax, 0x7172737475767778
+mov [r15 + 8 * 3], rax
+mov qword [r15 + 8 * 4], 0
+mov qword [r15 + 8 * 5], 0
+
+mov rbx, 0xC1C2C3C4C5C6C7D8
+
+; Flags of the locked op are read, the previous value stays live
+lock or byte [r15 + 8 * 0], bl
+lahf
+movzx ecx, ah
+and cl, 0xEF
+mov [r15 + 8 * 4 + 0], cl
+
+lock or word [r15 + 8 * 0 + 2], bx
+lahf
+movzx ecx, ah
+and cl, 0xEF
+mov [r15 + 8 * 4 + 1], cl
+
+lock or dword [r15 + 8 * 0 + 4], ebx
+lahf
+movzx ecx, ah
+and cl, 0xEF
+mov [r15 + 8 * 4 + 2], cl
+
+lock or qword [r15 + 8 * 1], rbx
+lahf
+movzx ecx, ah
+and cl, 0xEF
+mov [r15 + 8 * 4 + 3], cl
+
+; Every flag is overwritten before anything reads it, the previous value is dead
+lock or byte [r15 + 8 * 2], bl
+test rbx, rbx
+lahf
+movzx ecx, ah
+mov [r15 + 8 * 5 + 0], cl
+
+lock or word [r15 + 8 * 2 + 2], bx
+test rbx, rbx
+lahf
+movzx ecx, ah
+mov [r15 + 8 * 5 + 1], cl
+
+lock or dword [r15 + 8 * 2 + 4], ebx
+test rbx, rbx
+lahf
+movzx ecx, ah
+mov [r15 + 8 * 5 + 2], cl
+
+lock or qword [r15 + 8 * 3], rbx
+test rbx, rbx
+lahf
+movzx ecx, ah
+mov [r15 + 8 * 5 + 3], cl
+
+mov r8, [r15 + 8 * 0]
+mov r9, [r15 + 8 * 1]
+mov r10, [r15 + 8 * 2]
+mov r11, [r15 + 8 * 3]
+mov r12, [r15 + 8 * 4]
+mov r13, [r15 + 8 * 5]
+
+hlt
@@ -0,0 +1,89 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "R8":  "0x8484849C829E4790",
+    "R9":  "0x9090909090909080",
+    "R10": "0xA4A4A4BCA2BE67B0",
+    "R11": "0xB0B0B0B0B0B0B0A0",
+    "R12": "0x82868286",
+    "R13": "0x86868686"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov r15, 0xe0000000
+
+mov rax, 0x4142434445464748
+mov [r15 + 8 * 0], rax
+mov rax, 0x5152535455565758
+mov [r15 + 8 * 1], rax
+mov rax, 0x6162636465666768
+mov [r15 + 8 * 2], rax
+mov rax, 0x7172737475767778
+mov [r15 + 8 * 3], rax
+mov qword [r15 + 8 * 4], 0
+mov qword [r15 + 8 * 5], 0
+
+mov rbx, 0xC1C2C3C4C5C6C7D8
+
+; Flags of the locked op are read, the previous value stays live
+lock xor byte [r15 + 8 * 0], bl
+lahf
+movzx ecx, ah
+and cl, 0xEF
+mov [r15 + 8 * 4 + 0], cl
+
+lock xor word [r15 + 8 * 0 + 2], bx
+lahf
+movzx ecx, ah
+and cl, 0xEF
+mov [r15 + 8 * 4 + 1], cl
+
+lock xor dword [r15 + 8 * 0 + 4], ebx
+lahf
+movzx ecx, ah
+and cl, 0xEF
+mov [r15 + 8 * 4 + 2], cl
+
+lock xor qword [r15 + 8 * 1], rbx
+lahf
+movzx ecx, ah
+and cl, 0xEF
+mov [r15 + 8 * 4 + 3], cl
+
+; Every flag is overwritten before anything reads it, the previous value is dead
+lock xor byte [r15 + 8 * 2], bl
+test rbx, rbx
+lahf
+movzx ecx, ah
+mov [r15 + 8 * 5 + 0], cl
+
+lock xor word [r15 + 8 * 2 + 2], bx
+test rbx, rbx
+lahf
+movzx ecx, ah
+mov [r15 + 8 * 5 + 1], cl
+
+lock xor dword [r15 + 8 * 2 + 4], ebx
+test rbx, rbx
+lahf
+movzx ecx, ah
+mov [r15 + 8 * 5 + 2], cl
+
+lock xor qword [r15 + 8 * 3], rbx
+test rbx, rbx
+lahf
+movzx ecx, ah
+mov [r15 + 8 * 5 + 3], cl
+
+mov r8, [r15 + 8 * 0]
+mov r9, [r15 + 8 * 1]
+mov r10, [r15 + 8 * 2]
+mov r11, [r15 + 8 * 3]
+mov r12, [r15 + 8 * 4]
+mov r13, [r15 + 8 * 5]
+
+hlt
@@ -0,0 +1,43 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x0403020104030201",
+    "RBX": "0x0403020104030201",
+    "RDX": "0x0",
+    "RCX": "0x0",
+    "RDI": "0xE0000048",
+    "RSI": "0xE0000044"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+mov rax, 0x0807060504030201
+mov [rdx + 8 * 0], rax
+mov rax, 0x0
+mov [rdx + 8 * 1], rax
+mov [rdx + 8 * 2], rax
+mov [rdx + 8 * 3], rax
+mov [rdx + 8 * 4], rax
+mov [rdx + 8 * 5], rax
+mov [rdx + 8 * 6], rax
+mov [rdx + 8 * 7], rax
+mov [rdx + 8 * 8], rax
+mov [rdx + 8 * 9], rax
+
+lea rdi, [rdx + 4]
+lea rsi, [rdx + 0]
+
+; Each byte copied forward reads one stored four bytes earlier
+cld
+mov rcx, 68
+rep movsb ; rdi <- rsi
+
+mov rax, [rdx + 8 * 0]
+mov rbx, [rdx + 8 * 8]
+mov rdx, [rdx + 8 * 9]
+hlt
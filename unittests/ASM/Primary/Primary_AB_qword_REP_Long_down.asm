@@ -0,0 +1,45 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0xF1F2F3F4F5F6F7F8",
+    "RBX": "0xF1F2F3F4F5F6F7F8",
+    "RDX": "0x0",
+    "RSI": "0x0",
+    "RCX": "0x0",
+    "RDI": "0xE0000008"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+mov rax, 0x0
+mov [rdx + 8 * 0], rax
+mov [rdx + 8 * 1], rax
+mov [rdx + 8 * 2], rax
+mov [rdx + 8 * 3], rax
+mov [rdx + 8 * 4], rax
+mov [rdx + 8 * 5], rax
+mov [rdx + 8 * 6], rax
+mov [rdx + 8 * 7], rax
+mov [rdx + 8 * 8], rax
+mov [rdx + 8 * 9], rax
+mov [rdx + 8 * 10], rax
+mov [rdx + 8 * 11], rax
+
+lea rdi, [rdx + 8 * 10]
+
+std
+mov rax, 0xF1F2F3F4F5F6F7F8
+mov rcx, 9
+rep stosq ; rdi <- rax
+cld
+
+mov rsi, [rdx + 8 * 1]
+mov rbx, [rdx + 8 * 10]
+mov rax, [rdx + 8 * 2]
+mov rdx, [rdx + 8 * 11]
+hlt
@@ -0,0 +1,67 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RBX": "0x2222222222222222",
+    "RCX": "0x4444444444444444",
+    "RBP": "0x5555555555555555",
+    "R8":  "0x7777777777777777",
+    "R9":  "0x8888888888888888",
+    "R10": "0x9999999999999999",
+    "R11": "0xAAAAAAAAAAAAAAAA"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+; Same address through a copy of the base register
+mov rsi, rdx
+mov rax, 0x1111111111111111
+mov [rdx + 8 * 0], rax
+mov rax, 0x2222222222222222
+mov [rsi + 8 * 0], rax
+mov rbx, [rdx + 8 * 0]
+
+; Same address through a base that isn't the same node
+mov rcx, -1
+mov rdi, rdx
+and rdi, rcx
+mov rax, 0x3333333333333333
+mov [rdx + 8 * 1], rax
+mov rax, 0x4444444444444444
+mov [rdi + 8 * 1], rax
+mov rcx, [rdx + 8 * 1]
+
+; Base register moved between the store and the load
+mov rax, 0x5555555555555555
+mov [rdx + 8 * 2], rax
+add rdx, 8
+mov rbp, [rdx + 8 * 1]
+sub rdx, 8
+
+; Base pointer that was read back from memory
+mov [rdx + 8 * 3], rdx
+mov rdi, [rdx + 8 * 3]
+mov rax, 0x6666666666666666
+mov [rdx + 8 * 4], rax
+mov rax, 0x7777777777777777
+mov [rdi + 8 * 4], rax
+mov r8, [rdx + 8 * 4]
+
+; Neighbouring store leaves the value alone
+mov rax, 0x8888888888888888
+mov [rdx + 8 * 5], rax
+mov rax, 0x9999999999999999
+mov [rdx + 8 * 6], rax
+mov r9, [rdx + 8 * 5]
+
+; Repeated load with an aliasing store in between
+mov r10, [rdx + 8 * 6]
+mov rax, 0xAAAAAAAAAAAAAAAA
+mov [rsi + 8 * 6], rax
+mov r11, [rdx + 8 * 6]
+
+hlt
@@ -0,0 +1,76 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RBX": "0x0",
+    "RBP": "0x5",
+    "R8":  "0x8",
+    "R9":  "0x5",
+    "R10": "0x7",
+    "R11": "0xA",
+    "R12": "0x7F7F7F7F7F7F7F7F",
+    "R13": "0x7F7F7F7F7F7F7F7F",
+    "R15": "0x2"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+lea rsp, [rdx + 0x1000]
+
+; Syscall writing through its argument
+mov qword [rdx + 8 * 0], 0
+mov rdi, rdx
+mov rax, 201 ; Time
+syscall
+mov rbx, [rdx + 8 * 0]
+sub rbx, rax
+
+; Call writing through another register
+mov qword [rdx + 8 * 1], 1
+mov r8, rdx
+call function
+mov r15, [rdx + 8 * 1]
+
+; Atomics through another register
+mov rdi, rdx
+mov qword [rdx + 8 * 2], 5
+mov rbp, 3
+lock xadd [rdi + 8 * 2], rbp
+mov r8, [rdx + 8 * 2]
+
+mov qword [rdx + 8 * 3], 5
+mov r9, 7
+xchg [rdi + 8 * 3], r9
+mov r10, [rdx + 8 * 3]
+
+mov qword [rdx + 8 * 4], 9
+mov rax, 9
+mov r11, 0xA
+lock cmpxchg [rdi + 8 * 4], r11
+mov r11, [rdx + 8 * 4]
+
+; String ops
+mov qword [rdx + 8 * 5], 1
+mov qword [rdx + 8 * 6], 1
+mov r12, [rdx + 8 * 5]
+mov r13, [rdx + 8 * 6]
+cld
+lea rdi, [rdx + 8 * 5]
+mov ecx, 8
+mov eax, 0x7F
+rep stosb
+lea rsi, [rdx + 8 * 5]
+lea rdi, [rdx + 8 * 6]
+mov ecx, 8
+rep movsb
+mov r12, [rdx + 8 * 5]
+mov r13, [rdx + 8 * 6]
+
+hlt
+
+function:
+mov qword [r8 + 8 * 1], 2
+ret
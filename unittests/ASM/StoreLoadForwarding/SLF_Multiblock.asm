@@ -0,0 +1,53 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RBX": "0x1",
+    "RBP": "0x4",
+    "RDI": "0x6",
+    "R8":  "0xA"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+mov rsi, rdx
+
+; Aliasing store on the path that isn't taken
+mov qword [rdx + 8 * 0], 1
+mov rcx, 1
+cmp rcx, 0
+jne skip1
+mov qword [rsi + 8 * 0], 2
+skip1:
+mov rbx, [rdx + 8 * 0]
+
+; Aliasing store on the path that is taken
+mov qword [rdx + 8 * 1], 3
+cmp rcx, 1
+jne skip2
+mov qword [rsi + 8 * 1], 4
+skip2:
+mov rbp, [rdx + 8 * 1]
+
+; Aliasing store in the only successor
+mov qword [rdx + 8 * 2], 5
+jmp next
+next:
+mov qword [rsi + 8 * 2], 6
+mov rdi, [rdx + 8 * 2]
+
+; Value stored on every iteration
+mov qword [rdx + 8 * 3], 0
+mov rcx, 4
+loop_top:
+mov rax, [rdx + 8 * 3]
+add rax, rcx
+mov [rsi + 8 * 3], rax
+dec rcx
+jnz loop_top
+mov r8, [rdx + 8 * 3]
+
+hlt
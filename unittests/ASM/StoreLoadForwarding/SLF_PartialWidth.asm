@@ -0,0 +1,66 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RBX": "0x414243444546FF48",
+    "RCX": "0x5152535445464748",
+    "RBP": "0x45464748",
+    "RSI": "0x4748",
+    "RDI": "0x47",
+    "R8":  "0x41424344",
+    "R9":  "0xFFFFFFFF65666768",
+    "R10": "0x65666768",
+    "R11": "0x1",
+    "R12": "0x101",
+    "R13": "0xFFFFFFFFFFFF8001",
+    "R15": "0x3FF0000000000000"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+; Narrower store inside a wider one
+mov rax, 0x4142434445464748
+mov [rdx + 8 * 0], rax
+mov byte [rdx + 8 * 0 + 1], 0xFF
+mov rbx, [rdx + 8 * 0]
+
+; Narrower store over the top half
+mov [rdx + 8 * 1], rax
+mov dword [rdx + 8 * 1 + 4], 0x51525354
+mov rcx, [rdx + 8 * 1]
+
+; Narrower loads of a wider store
+mov [rdx + 8 * 2], rax
+mov ebp, [rdx + 8 * 2]
+movzx esi, word [rdx + 8 * 2]
+movzx edi, byte [rdx + 8 * 2 + 1]
+mov r8d, [rdx + 8 * 2 + 4]
+
+; Narrower store of a wider register
+mov qword [rdx + 8 * 3], -1
+mov rax, 0x6162636465666768
+mov [rdx + 8 * 3], eax
+mov r9, [rdx + 8 * 3]
+mov r10d, [rdx + 8 * 3]
+
+; Byte and word results stored and loaded back
+mov rax, 0x1FF
+add al, 2
+mov [rdx + 8 * 4], al
+movzx r11d, byte [rdx + 8 * 4]
+mov [rdx + 8 * 5], ax
+movzx r12d, word [rdx + 8 * 5]
+mov word [rdx + 8 * 6], 0x8001
+movsx r13, word [rdx + 8 * 6]
+
+; Vector store, GPR load
+mov rax, 0x3FF0000000000000
+movq xmm0, rax
+movsd [rdx + 8 * 7], xmm0
+mov r15, [rdx + 8 * 7]
+
+hlt
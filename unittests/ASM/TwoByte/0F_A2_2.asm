@@ -0,0 +1,120 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0x0",
+    "RBX": "0x1"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; Runs every CPUID twice, once with a constant function that ConstProp folds
+; and once with the function added to a load that it can't see through.
+; Both have to return the same registers.
+mov r15, 0xe0000000
+
+; Never written, so this reads as zero
+mov r12d, dword [r15 + 8 * 0]
+
+; Collects the difference of every register
+mov r13, 0
+
+; CPUID function zero
+mov eax, 0x0
+mov ecx, 0
+cpuid
+mov rsi, rax
+mov r8, rax
+mov r9, rbx
+mov r10, rcx
+mov r11, rdx
+
+mov eax, r12d
+add eax, 0x0
+mov ecx, 0
+cpuid
+xor r8, rax
+xor r9, rbx
+xor r10, rcx
+xor r11, rdx
+or r13, r8
+or r13, r9
+or r13, r10
+or r13, r11
+
+; CPUID function one
+mov eax, 0x1
+mov ecx, 0
+cpuid
+mov r8, rax
+mov r9, rbx
+mov r10, rcx
+mov r11, rdx
+
+mov eax, r12d
+add eax, 0x1
+mov ecx, 0
+cpuid
+xor r8, rax
+xor r9, rbx
+xor r10, rcx
+xor r11, rdx
+or r13, r8
+or r13, r9
+or r13, r10
+or r13, r11
+
+; CPUID function seven, subleaf zero
+mov eax, 0x7
+mov ecx, 0
+cpuid
+mov r8, rax
+mov r9, rbx
+mov r10, rcx
+mov r11, rdx
+
+mov eax, r12d
+add eax, 0x7
+mov ecx, 0
+cpuid
+xor r8, rax
+xor r9, rbx
+xor r10, rcx
+xor r11, rdx
+or r13, r8
+or r13, r9
+or r13, r10
+or r13, r11
+
+; CPUID extended function one
+mov eax, 0x80000001
+mov ecx, 0
+cpuid
+mov r8, rax
+mov r9, rbx
+mov r10, rcx
+mov r11, rdx
+
+mov eax, r12d
+add eax, 0x80000001
+mov ecx, 0
+cpuid
+xor r8, rax
+xor r9, rbx
+xor r10, rcx
+xor r11, rdx
+or r13, r8
+or r13, r9
+or r13, r10
+or r13, r11
+
+; CPUID function zero always returns >0 in EAX, make sure the folded results aren't just empty
+cmp esi, 0
+mov rbx, 0
+setnz bl
+
+mov rax, r13
+
+hlt
@@ -0,0 +1,86 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0xC90FDAA22168C000",
+    "RBX": "0xC000",
+    "RCX": "0x8000000000000000",
+    "RSI": "0x3BE5",
+    "RDI": "0x8000000000000000",
+    "RBP": "0x7FFF",
+    "R8":  "0x8000000000000000",
+    "R9":  "0x7FFF",
+    "R10": "0x0000000000000000",
+    "R11": "0x8000",
+    "R12": "0xC90FDAA22168C000",
+    "R13": "0x4000",
+    "R14": "0xC000000000000000",
+    "R15": "0x7FFF"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; m80 values go through a host double and back
+mov rdx, 0xe0000000
+
+mov rax, 0xC90FDAA22168C000 ; -pi, fits in a double
+mov [rdx + 16 * 0], rax
+mov word [rdx + 16 * 0 + 8], 0xC000
+
+mov rax, 0x8000000000000000 ; 2^-1050, a double denormal
+mov [rdx + 16 * 1], rax
+mov word [rdx + 16 * 1 + 8], 0x3BE5
+
+mov rax, 0x8000000000000000 ; Infinity
+mov [rdx + 16 * 2], rax
+mov word [rdx + 16 * 2 + 8], 0x7FFF
+
+mov rax, 0x8000000000000000 ; 2^4097, overflows to infinity
+mov [rdx + 16 * 3], rax
+mov word [rdx + 16 * 3 + 8], 0x5000
+
+mov rax, 0x8000000000000000 ; -2^-8191, underflows to -0
+mov [rdx + 16 * 4], rax
+mov word [rdx + 16 * 4 + 8], 0xA000
+
+mov rax, 0xC90FDAA22168C235 ; pi, loses the low mantissa bits
+mov [rdx + 16 * 5], rax
+mov word [rdx + 16 * 5 + 8], 0x4000
+
+mov rax, 0xC000000000000000 ; QNaN
+mov [rdx + 16 * 6], rax
+mov word [rdx + 16 * 6 + 8], 0x7FFF
+
+fld tword [rdx + 16 * 0]
+fstp tword [rdx + 16 * 0 + 256]
+fld tword [rdx + 16 * 1]
+fstp tword [rdx + 16 * 1 + 256]
+fld tword [rdx + 16 * 2]
+fstp tword [rdx + 16 * 2 + 256]
+fld tword [rdx + 16 * 3]
+fstp tword [rdx + 16 * 3 + 256]
+fld tword [rdx + 16 * 4]
+fstp tword [rdx + 16 * 4 + 256]
+fld tword [rdx + 16 * 5]
+fstp tword [rdx + 16 * 5 + 256]
+fld tword [rdx + 16 * 6]
+fstp tword [rdx + 16 * 6 + 256]
+
+mov rax, [rdx + 16 * 0 + 256]
+movzx rbx, word [rdx + 16 * 0 + 256 + 8]
+mov rcx, [rdx + 16 * 1 + 256]
+movzx rsi, word [rdx + 16 * 1 + 256 + 8]
+mov rdi, [rdx + 16 * 2 + 256]
+movzx rbp, word [rdx + 16 * 2 + 256 + 8]
+mov r8, [rdx + 16 * 3 + 256]
+movzx r9, word [rdx + 16 * 3 + 256 + 8]
+mov r10, [rdx + 16 * 4 + 256]
+movzx r11, word [rdx + 16 * 4 + 256 + 8]
+mov r12, [rdx + 16 * 5 + 256]
+movzx r13, word [rdx + 16 * 5 + 256 + 8]
+mov r14, [rdx + 16 * 6 + 256]
+movzx r15, word [rdx + 16 * 6 + 256 + 8]
+
+hlt
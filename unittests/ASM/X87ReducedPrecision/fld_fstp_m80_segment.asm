@@ -0,0 +1,37 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0xC90FDAA22168C000",
+    "RBX": "0xC000",
+    "RCX": "0x0",
+    "R12": "0x0"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; m80 loads and stores with a GS override, without it they would hit the other slots
+mov rdx, 0xe0000000
+
+mov rax, 0xC90FDAA22168C000 ; -pi, fits in a double
+mov [rdx + 0x100], rax
+mov word [rdx + 0x100 + 8], 0xC000
+mov qword [rdx], 0
+mov word [rdx + 8], 0
+
+mov rax, 158 ; arch_prctl
+mov rdi, 0x1001 ; ARCH_SET_GS
+mov rsi, 0x100
+syscall
+mov r12, rax
+
+fld tword [gs:rdx]
+fstp tword [gs:rdx + 16]
+
+mov rax, [rdx + 16 + 0x100]
+movzx rbx, word [rdx + 16 + 0x100 + 8]
+mov rcx, [rdx + 16]
+
+hlt
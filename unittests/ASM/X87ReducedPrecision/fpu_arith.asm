@@ -0,0 +1,90 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0xBFE0D79435E50D79",
+    "RBX": "0xBFD5555555555555",
+    "RCX": "0xC070D00000000001",
+    "RSI": "0x3FAAAAAB",
+    "RDI": "0xC024000000000000",
+    "RBP": "0x4014000000000000",
+    "R8":  "0x4018000000000000"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+mov rdx, 0xe0000000
+
+mov rax, 0x4000000000000000 ; 2.0
+mov [rdx + 8 * 0], rax
+mov rax, 0x4008000000000000 ; 3.0
+mov [rdx + 8 * 1], rax
+mov rax, 0x4024000000000000 ; 10.0
+mov [rdx + 8 * 2], rax
+mov dword [rdx + 8 * 3], 0x3F000000 ; 0.5
+mov dword [rdx + 8 * 3 + 4], 0x40800000 ; 4.0
+
+; Memory sources
+fld qword [rdx + 8 * 0]
+fadd qword [rdx + 8 * 1]
+fmul dword [rdx + 8 * 3 + 4]
+fsub qword [rdx + 8 * 2]
+fsubr dword [rdx + 8 * 3]
+fdiv dword [rdx + 8 * 3]
+fdivr qword [rdx + 8 * 2]
+fstp qword [rdx + 256]
+
+; Register sources
+fld qword [rdx + 8 * 2]
+fld qword [rdx + 8 * 1]
+fld qword [rdx + 8 * 0]
+fadd st0, st2
+fsubr st0, st1
+fmul st2, st0
+fdiv st1, st0
+fsubr st2, st0
+fxch st2
+fld st1
+fst qword [rdx + 256 + 8]
+faddp st1, st0
+fsubrp st2, st0
+fdivp st1, st0
+fstp qword [rdx + 256 + 16]
+
+; 32bit store
+fld dword [rdx + 8 * 3 + 4]
+fld qword [rdx + 8 * 1]
+fdivp st1, st0
+fstp dword [rdx + 256 + 24]
+
+fld qword [rdx + 8 * 0]
+fld qword [rdx + 8 * 1]
+fsubp st1, st0
+fld qword [rdx + 8 * 2]
+fmulp st1, st0
+fstp qword [rdx + 256 + 32]
+
+fld qword [rdx + 8 * 0]
+fld qword [rdx + 8 * 2]
+fdivrp st1, st0
+fstp qword [rdx + 256 + 40]
+
+; Stack register stores
+fld qword [rdx + 8 * 0]
+fld qword [rdx + 8 * 1]
+fst st1
+fstp st1
+fadd st0, st0
+fstp qword [rdx + 256 + 48]
+
+mov rax, [rdx + 256]
+mov rbx, [rdx + 256 + 8]
+mov rcx, [rdx + 256 + 16]
+mov esi, [rdx + 256 + 24]
+mov rdi, [rdx + 256 + 32]
+mov rbp, [rdx + 256 + 40]
+mov r8, [rdx + 256 + 48]
+
+hlt
@@ -0,0 +1,69 @@
+%ifdef CONFIG
+{
+  "RegData": {
+    "RAX": "0xC90FDAA22168C235",
+    "RBX": "0x4000",
+    "RCX": "0x8000000000000000",
+    "RSI": "0x5000",
+    "RDI": "0x8000000000000000",
+    "RBP": "0xA000",
+    "R8":  "0xC90FDAA22168C235",
+    "R9":  "0xC000",
+    "R10": "0x0",
+    "R12": "0x0"
+  },
+  "MemoryRegions": {
+    "0x100000000": "4096"
+  }
+}
+%endif
+
+; m80 values round trip through ST(0) without losing anything
+mov rdx, 0xe0000000
+
+mov rax, 0xC90FDAA22168C235 ; pi
+mov [rdx + 16 * 0], rax
+mov word [rdx + 16 * 0 + 8], 0x4000
+
+mov rax, 0x8000000000000000 ; 2^4097
+mov [rdx + 16 * 1], rax
+mov word [rdx + 16 * 1 + 8], 0x5000
+
+mov rax, 0x8000000000000000 ; -2^-8191
+mov [rdx + 16 * 2], rax
+mov word [rdx + 16 * 2 + 8], 0xA000
+
+fld tword [rdx + 16 * 0]
+fld tword [rdx + 16 * 1]
+fld tword [rdx + 16 * 2]
+fstp tword [rdx + 16 * 2 + 256]
+fstp tword [rdx + 16 * 1 + 256]
+fstp tword [rdx + 16 * 0 + 256]
+
+; GS override, without it the load and store would hit the other slots
+mov rax, 0xC90FDAA22168C235 ; -pi
+mov [rdx + 16 * 3 + 0x100], rax
+mov word [rdx + 16 * 3 + 0x100 + 8], 0xC000
+mov qword [rdx + 16 * 3], 0
+mov word [rdx + 16 * 3 + 8], 0
+
+mov rax, 158 ; arch_prctl
+mov rdi, 0x1001 ; ARCH_SET_GS
+mov rsi, 0x100
+syscall
+mov r12, rax
+
+fld tword [gs:rdx + 16 * 3]
+fstp tword [gs:rdx + 16 * 4]
+
+mov rax, [rdx + 16 * 0 + 256]
+movzx rbx, word [rdx + 16 * 0 + 256 + 8]
+mov rcx, [rdx + 16 * 1 + 256]
+movzx rsi, word [rdx + 16 * 1 + 256 + 8]
+mov rdi, [rdx + 16 * 2 + 256]
+movzx rbp, word [rdx + 16 * 2 + 256 + 8]
+mov r8, [rdx + 16 * 4 + 0x100]
+movzx r9, word [rdx + 16 * 4 + 0x100 + 8]
+mov r10, [rdx + 16 * 4]
+
+hlt